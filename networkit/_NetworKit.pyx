@@ -2720,6 +2720,7 @@ cdef extern from "cpp/generators/LFRGenerator.h":
 		void setMu(double mu) nogil except +
 		void setMu(const vector[double] & mu) nogil except +
 		void setMuWithBinomialDistribution(double mu) nogil except +
+		void setScalableMode(bool scalable) nogil except +
 		_Graph getGraph() except +
 		_Partition getPartition() except +
 		_Graph generate() except +
@@ -2856,6 +2857,21 @@ cdef class LFRGenerator(Algorithm):
 			(<_LFRGenerator*>(self._this)).setMuWithBinomialDistribution(mu)
 		return self
 
+	def setScalableMode(self, bool scalable):
+		"""
+		Enables or disables the scalable mode, in which the inter-cluster graph and large communities are generated in parallel with
+		the configuration model and parallel rewiring instead of the sequential edge-switching markov-chain. The scalable mode is
+		disabled by default.
+
+		Parameters
+		----------
+		scalable : bool
+			If the scalable mode shall be used.
+		"""
+		with nogil:
+			(<_LFRGenerator*>(self._this)).setScalableMode(scalable)
+		return self
+
 	def getGraph(self):
 		"""
 		Return the generated Graph.
@@ -8189,6 +8205,7 @@ cdef extern from "cpp/generators/DynamicHyperbolicGenerator.h":
 	cdef cppclass _DynamicHyperbolicGenerator "NetworKit::DynamicHyperbolicGenerator":
 		_DynamicHyperbolicGenerator(count numNodes, double avgDegree, double gamma, double T, double moveEachStep, double moveDistance) except +
 		vector[_GraphEvent] generate(count nSteps) except +
+		vector[_GraphEvent] addNodes(count numNewNodes) except +
 		_Graph getGraph() except +
 		vector[Point[float]] getCoordinates() except +
 
@@ -8231,6 +8248,16 @@ cdef class DynamicHyperbolicGenerator:
 		"""
 		return [GraphEvent(ev.type, ev.u, ev.v, ev.w) for ev in self._this.generate(nSteps)]
 
+	def addNodes(self, numNewNodes):
+		""" Add nodes at random positions and generate the events for them and their edges.
+
+		Parameters
+		----------
+		numNewNodes : count
+			Number of nodes to add.
+		"""
+		return [GraphEvent(ev.type, ev.u, ev.v, ev.w) for ev in self._this.addNodes(numNewNodes)]
+
 	def getGraph(self):
 		return Graph().setThis(self._this.getGraph())
 
@@ -10981,7 +11008,7 @@ cdef class PivotMDS (GraphLayoutAlgorithm):
 
 cdef extern from "cpp/randomization/GlobalCurveball.h":
 	cdef cppclass _GlobalCurveball "NetworKit::GlobalCurveball"(_Algorithm):
-		_GlobalCurveball(_Graph, count) except +
+		_GlobalCurveball(_Graph, count, bool_t) except +
 		_Graph getGraph() except +
 
 cdef class GlobalCurveball(Algorithm):
@@ -11013,10 +11040,15 @@ cdef class GlobalCurveball(Algorithm):
 		asymptotically linearly in this parameter. Default: 20,
 		which yields good results experimentally (see Paper).
 
+	parallel:
+		If True, the independent trades of each global round are
+		executed concurrently. The result does not depend on the
+		number of threads. Default: False.
+
 	"""
-	def __cinit__(self, G, number_of_global_rounds = 20):
+	def __cinit__(self, G, number_of_global_rounds = 20, parallel = False):
 		if isinstance(G, Graph):
-			self._this = new _GlobalCurveball((<Graph>G)._this, number_of_global_rounds)
+			self._this = new _GlobalCurveball((<Graph>G)._this, number_of_global_rounds, parallel)
 		else:
 			raise RuntimeError("Parameter G has to be a graph")
 
@@ -11030,6 +11062,65 @@ cdef class GlobalCurveball(Algorithm):
 		return Graph().setThis((<_GlobalCurveball*>self._this).getGraph())
 
 
+cdef extern from "cpp/randomization/EdgeSwitching.h":
+	cdef cppclass _EdgeSwitching "NetworKit::EdgeSwitching"(_Algorithm):
+		_EdgeSwitching(_Graph, double) except +
+		_Graph getGraph() except +
+		void setBatchSize(count batchSize) except +
+		void setSeed(uint64_t seed) except +
+		count getNumberOfAttemptedSwitches() except +
+		count getNumberOfPerformedSwitches() except +
+
+cdef class EdgeSwitching(Algorithm):
+	"""
+	Randomizes an undirected graph without self-loops with the edge switching
+	Markov chain, which preserves the degree sequence. The switches are
+	executed in parallel batches; conflicting switches within a batch are
+	rejected deterministically, hence for a fixed seed the result does not
+	depend on the number of threads.
+
+	Parameters
+	----------
+
+	G : networkit.Graph
+		The graph to be randomized.
+
+	numberOfSwitchesPerEdge : double
+		Number of successful switches per edge. At most twice as many
+		switches are attempted. Default: 10.
+	"""
+	def __cinit__(self, G, double numberOfSwitchesPerEdge = 10.0):
+		if isinstance(G, Graph):
+			self._this = new _EdgeSwitching((<Graph>G)._this, numberOfSwitchesPerEdge)
+		else:
+			raise RuntimeError("Parameter G has to be a graph")
+
+	def getGraph(self):
+		"""
+		Get randomized graph after invocation of run().
+		"""
+		return Graph().setThis((<_EdgeSwitching*>self._this).getGraph())
+
+	def setBatchSize(self, count batchSize):
+		"""
+		Sets the number of switches per batch; 0 (the default) chooses m / 32.
+		"""
+		(<_EdgeSwitching*>self._this).setBatchSize(batchSize)
+		return self
+
+	def setSeed(self, uint64_t seed):
+		"""
+		Sets the seed of the switches; by default, run() draws it from the global random generator.
+		"""
+		(<_EdgeSwitching*>self._this).setSeed(seed)
+		return self
+
+	def getNumberOfAttemptedSwitches(self):
+		return (<_EdgeSwitching*>self._this).getNumberOfAttemptedSwitches()
+
+	def getNumberOfPerformedSwitches(self):
+		return (<_EdgeSwitching*>self._this).getNumberOfPerformedSwitches()
+
 cdef extern from "cpp/randomization/CurveballUniformTradeGenerator.h":
 	cdef cppclass _CurveballUniformTradeGenerator "NetworKit::CurveballUniformTradeGenerator":
 		_CurveballUniformTradeGenerator(count runLength, count numNodes) except +
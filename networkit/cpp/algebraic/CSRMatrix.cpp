@@ -6,14 +6,81 @@
  */
 
 #include "CSRMatrix.h"
+#include "GraphMatrixBuilder.h"
 
 #include <cassert>
 #include <atomic>
+#include <cmath>
 #include <numeric>
 #include "omp.h"
 
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
 namespace NetworKit {
 
+namespace {
+
+/**
+ * Computes the K sums of the row with the non-zeros [@a begin, @a end) times the row-major @a X into @a sums.
+ */
+template<count K>
+inline void rowTimesMultiVector(const double *values, const index *columns, index begin, index end, const DenseMatrix &X, double *sums) {
+#if defined(__AVX512F__)
+	if (K % 8 == 0) {
+		__m512d acc[(K + 7) / 8];
+		for (index l = 0; l < K / 8; ++l) {
+			acc[l] = _mm512_setzero_pd();
+		}
+		for (index cIdx = begin; cIdx < end; ++cIdx) {
+			const __m512d value = _mm512_set1_pd(values[cIdx]);
+			const double *row = X.rowData(columns[cIdx]);
+			for (index l = 0; l < K / 8; ++l) {
+				acc[l] = _mm512_fmadd_pd(value, _mm512_loadu_pd(row + 8 * l), acc[l]);
+			}
+		}
+		for (index l = 0; l < K / 8; ++l) {
+			_mm512_storeu_pd(sums + 8 * l, acc[l]);
+		}
+		return;
+	}
+#endif
+#if defined(__AVX2__)
+	if (K % 4 == 0) {
+		__m256d acc[(K + 3) / 4];
+		for (index l = 0; l < K / 4; ++l) {
+			acc[l] = _mm256_setzero_pd();
+		}
+		for (index cIdx = begin; cIdx < end; ++cIdx) {
+			const __m256d value = _mm256_set1_pd(values[cIdx]);
+			const double *row = X.rowData(columns[cIdx]);
+			for (index l = 0; l < K / 4; ++l) {
+				acc[l] = _mm256_add_pd(acc[l], _mm256_mul_pd(value, _mm256_loadu_pd(row + 4 * l)));
+			}
+		}
+		for (index l = 0; l < K / 4; ++l) {
+			_mm256_storeu_pd(sums + 4 * l, acc[l]);
+		}
+		return;
+	}
+#endif
+	// the local array can be held in registers, as it cannot alias the inputs
+	double local[K] = {};
+	for (index cIdx = begin; cIdx < end; ++cIdx) {
+		const double value = values[cIdx];
+		const double *row = X.rowData(columns[cIdx]);
+		for (index l = 0; l < K; ++l) {
+			local[l] += value * row[l];
+		}
+	}
+	for (index l = 0; l < K; ++l) {
+		sums[l] = local[l];
+	}
+}
+
+} // namespace
+
 CSRMatrix::CSRMatrix() : rowIdx(0), columnIdx(0), nonZeros(0), nRows(0), nCols(0), isSorted(true), zero(0.0) {
 }
 
@@ -62,12 +129,10 @@ CSRMatrix::CSRMatrix(const count nRows, const count nCols, const std::vector<Tri
 
 CSRMatrix::CSRMatrix(const count nRows, const count nCols, const std::vector<std::vector<index>> &columnIdx, const std::vector<std::vector<double>> &values,  const double zero, bool isSorted) : nRows(nRows), nCols(nCols), isSorted(isSorted), zero(zero) {
 	 rowIdx = std::vector<index>(nRows + 1, 0);
-	 count nnz = columnIdx[0].size();
-	 for (index i = 1; i < columnIdx.size(); ++i) {
-		 rowIdx[i] = rowIdx[i-1] + columnIdx[i-1].size();
-		 nnz += columnIdx[i].size();
+	 for (index i = 0; i < nRows; ++i) {
+		 rowIdx[i+1] = rowIdx[i] + columnIdx[i].size();
 	 }
-	 rowIdx[nRows] = nnz;
+	 count nnz = rowIdx[nRows];
 
 	 this->columnIdx = std::vector<index>(nnz);
 	 this->nonZeros = std::vector<double>(nnz);
@@ -336,89 +401,67 @@ Vector CSRMatrix::operator*(const Vector &vector) const {
 	assert(nCols == vector.getDimension());
 
 	Vector result(nRows, zero);
-#pragma omp parallel for
-	for (omp_index i = 0; i < static_cast<omp_index>(numberOfRows()); ++i) {
+	if (nRows == 0 || nCols == 0) return result;
+
+	// plain pointers let the compiler vectorize the inner loop without the bounds checks of Vector::operator[]
+	const index *rows = rowIdx.data();
+	const index *columns = columnIdx.data();
+	const double *values = nonZeros.data();
+	const double *x = &vector[0];
+	double *y = &result[0];
+
+#pragma omp parallel for schedule(guided)
+	for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
 		double sum = zero;
-		for (index cIdx = rowIdx[i]; cIdx < rowIdx[i+1]; ++cIdx) {
-			sum += nonZeros[cIdx] * vector[columnIdx[cIdx]];
+		for (index cIdx = rows[i]; cIdx < rows[i+1]; ++cIdx) {
+			sum += values[cIdx] * x[columns[cIdx]];
 		}
-		result[i] = sum;
+		y[i] = sum;
 	}
 
 	return result;
 }
 
-CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
-	assert(nCols == other.nRows);
-
-	std::vector<index> rowIdx(numberOfRows()+1, 0);
-	std::vector<index> columnIdx;
-	std::vector<double> nonZeros;
-
-#pragma omp parallel
-	{
-		std::vector<int64_t> marker(other.numberOfColumns(), -1);
-		count numThreads = omp_get_num_threads();
-		index threadId = omp_get_thread_num();
-
-		count chunkSize = (numberOfRows() + numThreads - 1) / numThreads;
-		index chunkStart = threadId * chunkSize;
-		index chunkEnd = std::min(numberOfRows(), chunkStart + chunkSize);
-
-		for (index i = chunkStart; i < chunkEnd; ++i) {
-			for (index jA = this->rowIdx[i]; jA < this->rowIdx[i+1]; ++jA) {
-				index k = this->columnIdx[jA];
-				for (index jB = other.rowIdx[k]; jB < other.rowIdx[k+1]; ++jB) {
-					index j = other.columnIdx[jB];
-					if (marker[j] != (int64_t) i) {
-						marker[j] = i;
-						++rowIdx[i+1];
-					}
-				}
-			}
-		}
-
-		std::fill(marker.begin(), marker.end(), -1);
-
-#pragma omp barrier
-#pragma omp single
-		{
-			for (index i = 0; i < numberOfRows(); ++i) {
-				rowIdx[i+1] += rowIdx[i];
-			}
+template<count K>
+void CSRMatrix::multiplyMultiVector(const DenseMatrix &X, std::vector<double> &result) const {
+	const double *values = nonZeros.data();
+	const index *columns = columnIdx.data();
+#pragma omp parallel for schedule(guided)
+	for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+		rowTimesMultiVector<K>(values, columns, rowIdx[i], rowIdx[i+1], X, &result[i * K]);
+	}
+}
 
-			columnIdx = std::vector<index>(rowIdx[numberOfRows()]);
-			nonZeros = std::vector<double>(rowIdx[numberOfRows()]);
-		}
+DenseMatrix CSRMatrix::operator*(const DenseMatrix &X) const {
+	assert(nCols == X.numberOfRows());
 
-		for (index i = chunkStart; i < chunkEnd; ++i) {
-			index rowBegin = rowIdx[i];
-			index rowEnd = rowBegin;
-
-			for (index jA = this->rowIdx[i]; jA < this->rowIdx[i+1]; ++jA) {
-				index k = this->columnIdx[jA];
-				double valA = this->nonZeros[jA];
-
-				for (index jB = other.rowIdx[k]; jB < other.rowIdx[k+1]; ++jB) {
-					index j = other.columnIdx[jB];
-					double valB = other.nonZeros[jB];
-
-					if (marker[j] < (int64_t) rowBegin) {
-						marker[j] = rowEnd;
-						columnIdx[rowEnd] = j;
-						nonZeros[rowEnd] = valA * valB;
-						++rowEnd;
-					} else {
-						nonZeros[marker[j]] += valA * valB;
+	const count k = X.numberOfColumns();
+	std::vector<double> result(nRows * k, 0.0);
+	switch (k) {
+		case 4: multiplyMultiVector<4>(X, result); break;
+		case 8: multiplyMultiVector<8>(X, result); break;
+		case 16: multiplyMultiVector<16>(X, result); break;
+		case 32: multiplyMultiVector<32>(X, result); break;
+		case 64: multiplyMultiVector<64>(X, result); break;
+		default:
+#pragma omp parallel for schedule(guided)
+			for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+				for (index cIdx = rowIdx[i]; cIdx < rowIdx[i+1]; ++cIdx) {
+					const double value = nonZeros[cIdx];
+					const index j = columnIdx[cIdx];
+					for (index l = 0; l < k; ++l) {
+						result[i * k + l] += value * X(j, l);
 					}
 				}
 			}
-		}
 	}
 
-	CSRMatrix result(numberOfRows(), other.numberOfColumns(), rowIdx, columnIdx, nonZeros);
-	if (sorted() && other.sorted()) result.sort();
-	return result;
+	return DenseMatrix(nRows, k, result, zero);
+}
+
+CSRMatrix CSRMatrix::operator*(const CSRMatrix &other) const {
+	assert(nCols == other.nRows);
+	return CSRMatrix::multiply(*this, other);
 }
 
 CSRMatrix CSRMatrix::operator/(const double &divisor) const {
@@ -431,63 +474,12 @@ CSRMatrix& CSRMatrix::operator/=(const double &divisor) {
 
 CSRMatrix CSRMatrix::mTmMultiply(const CSRMatrix &A, const CSRMatrix &B) {
 	assert(A.nRows == B.nRows);
-
-	std::vector<std::vector<index>> columnIdx(A.numberOfColumns());
-	std::vector<std::vector<double>> values(A.numberOfColumns());
-
-	for (index k = 0; k < A.numberOfRows(); ++k) {
-		A.forNonZeroElementsInRow(k, [&](index i, double vA) {
-			B.forNonZeroElementsInRow(k, [&](index j, double vB) {
-				bool found = false;
-				for (index l = 0; l < columnIdx[i].size(); ++l) {
-					if (columnIdx[i][l] == j) {
-						values[i][l] += vA * vB;
-						found = true;
-						break;
-					}
-				}
-
-				if (!found) {
-					columnIdx[i].push_back(j);
-					values[i].push_back(vA * vB);
-				}
-			});
-		});
-	}
-
-	return CSRMatrix(A.nCols, B.nCols, columnIdx, values);
+	return CSRMatrix::multiply(A.transpose(), B);
 }
 
 CSRMatrix CSRMatrix::mmTMultiply(const CSRMatrix &A, const CSRMatrix &B) {
 	assert(A.nCols == B.nCols);
-
-	std::vector<std::vector<index>> columnIdx(A.numberOfRows());
-	std::vector<std::vector<double>> values(A.numberOfRows());
-
-	for (index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](index k, double vA) {
-			for (index j = 0; j < B.numberOfRows(); ++j) {
-				double vB = B(j,k);
-				if (vB != A.zero) {
-					bool found = false;
-					for (index l = 0; l < columnIdx[i].size(); ++l) {
-						if (columnIdx[i][l] == j) {
-							values[i][l] += vA * vB;
-							found = true;
-							break;
-						}
-					}
-
-					if (!found) {
-						columnIdx[i].push_back(j);
-						values[i].push_back(vA * vB);
-					}
-				}
-			}
-		});
-	}
-
-	return CSRMatrix(A.nRows, B.nRows, columnIdx, values);
+	return CSRMatrix::multiply(A, B.transpose());
 }
 
 Vector CSRMatrix::mTvMultiply(const CSRMatrix &matrix, const Vector &vector) {
@@ -571,17 +563,10 @@ void CSRMatrix::assign(const std::vector<index>& rowIndices, const std::vector<i
 }
 
 CSRMatrix CSRMatrix::adjacencyMatrix(const Graph &graph, double zero) {
-	count nonZeros = graph.isDirected()? graph.numberOfEdges() : graph.numberOfEdges() * 2;
-	std::vector<Triplet> triplets(nonZeros);
-	index idx = 0;
-	graph.forEdges([&](node i, node j, double val) {
-		triplets[idx++] = {i,j,val};
-		if (!graph.isDirected() && i != j) {
-			triplets[idx++] = {j,i,val};
-		}
-	});
-
-	return CSRMatrix(graph.upperNodeIdBound(), triplets, zero);
+	CSRMatrix matrix(graph.upperNodeIdBound(), zero);
+	GraphMatrixBuilder::adjacencyMatrix(graph, matrix.rowIdx, matrix.columnIdx, matrix.nonZeros);
+	matrix.isSorted = false;
+	return matrix;
 }
 
 CSRMatrix CSRMatrix::diagonalMatrix(const Vector& diagonalElements, double zero) {
@@ -632,51 +617,17 @@ CSRMatrix CSRMatrix::incidenceMatrix(const Graph& graph, double zero) {
 }
 
 CSRMatrix CSRMatrix::laplacianMatrix(const Graph &graph, double zero) {
-	std::vector<Triplet> triples;
-
-	graph.forNodes([&](const index i){
-		double weightedDegree = 0.0;
-		graph.forNeighborsOf(i, [&](const index j, double weight) { // - adjacency matrix
-			if (i != j) { // exclude diagonal since this would be subtracted by the adjacency weight
-				weightedDegree += weight;
-			}
-
-			triples.push_back({i,j,-weight});
-		});
-
-		triples.push_back({i,i, weightedDegree}); // degree matrix
-	});
-
-	return CSRMatrix(graph.upperNodeIdBound(), triples, zero);
+	CSRMatrix matrix(graph.upperNodeIdBound(), zero);
+	GraphMatrixBuilder::laplacianMatrix(graph, matrix.rowIdx, matrix.columnIdx, matrix.nonZeros);
+	matrix.isSorted = false;
+	return matrix;
 }
 
 CSRMatrix CSRMatrix::normalizedLaplacianMatrix(const Graph& graph, double zero) {
-	std::vector<Triplet> triples;
-
-	std::vector<double> weightedDegrees(graph.upperNodeIdBound(), 0.0);
-	graph.parallelForNodes([&](const node u) {
-		weightedDegrees[u] = graph.weightedDegree(u);
-	});
-
-	graph.forNodes([&](const node i){
-		graph.forNeighborsOf(i, [&](const node j, double weight){
-			if (i != j) {
-				triples.push_back({i, j, -weight/sqrt(weightedDegrees[i] * weightedDegrees[j])});
-			}
-		});
-
-		if (weightedDegrees[i] != 0.0) {
-			if (graph.isWeighted()) {
-				triples.push_back({i, i, 1-(graph.weight(i, i)) / weightedDegrees[i]});
-			} else {
-				triples.push_back({i, i, 1});
-			}
-		}
-	});
-
-	return CSRMatrix(graph.upperNodeIdBound(), triples, zero);
+	CSRMatrix matrix(graph.upperNodeIdBound(), zero);
+	GraphMatrixBuilder::normalizedLaplacianMatrix(graph, matrix.rowIdx, matrix.columnIdx, matrix.nonZeros);
+	matrix.isSorted = false;
+	return matrix;
 }
 
-
-
 } /* namespace NetworKit */
@@ -9,11 +9,14 @@
 #define CSRMATRIX_H_
 
 #include <vector>
+#include <algorithm>
 #include "../Globals.h"
 #include "AlgebraicGlobals.h"
 #include "Vector.h"
+#include "DenseMatrix.h"
 #include "../graph/Graph.h"
 #include "../algebraic/SparseAccumulator.h"
+#include "../algebraic/Semirings.h"
 #include "../auxiliary/Timer.h"
 
 namespace NetworKit {
@@ -61,6 +64,13 @@ private:
 	 */
 	index binarySearchColumns(index left, index right, index j) const;
 
+	/**
+	 * Computes the product of this matrix and the multi-vector @a X with exactly @a K columns into the row-major
+	 * @a result. The @a K partial sums of a row are kept in (vector) registers; AVX-512 and AVX2 kernels are used
+	 * if the build targets them, a plain loop otherwise.
+	 */
+	template<count K> void multiplyMultiVector(const DenseMatrix &X, std::vector<double> &result) const;
+
 public:
 	/** Default constructor */
 	CSRMatrix();
@@ -282,6 +292,14 @@ public:
 	 */
 	CSRMatrix operator*(const CSRMatrix &other) const;
 
+	/**
+	 * Multiplies this matrix with the dense multi-vector @a X, i.e. the k columns of @a X are multiplied at once.
+	 * Compared to k separate products, every non-zero of this matrix is only loaded once and the k values of a row
+	 * of @a X are contiguous in memory. Widths of 4, 8, 16, 32 and 64 use specialized kernels.
+	 * @return The result of multiplying this matrix with @a X.
+	 */
+	DenseMatrix operator*(const DenseMatrix &X) const;
+
 	/**
 	 * Divides this matrix by a divisor specified in @a divisor and returns the result in a new matrix.
 	 * @return The result of dividing this matrix by @a divisor.
@@ -304,6 +322,18 @@ public:
 	 */
 	template<typename L> static CSRMatrix binaryOperator(const CSRMatrix &A, const CSRMatrix &B, L binaryOp);
 
+	/**
+	 * Computes @a A * @a B over the semiring @a SemiRing. The rows of the result are computed in parallel in two
+	 * phases: a symbolic phase counts the non-zeros of each row, a numeric phase accumulates the products of each
+	 * row in a thread-local dense accumulator and writes the row with sorted column indices. The default Semiring is
+	 * the ArithmeticSemiring.
+	 * @param A
+	 * @param B
+	 * @return @a A * @a B as sorted CSRMatrix with the zero element of @a A.
+	 * @note The number of columns of @a A must be equal to the number of rows of @a B.
+	 */
+	template<class SemiRing = ArithmeticSemiring> static CSRMatrix multiply(const CSRMatrix &A, const CSRMatrix &B);
+
 	/**
 	 * Computes @a A^T * @a B.
 	 * @param A
@@ -556,6 +586,77 @@ template<typename L> inline CSRMatrix CSRMatrix::binaryOperator(const CSRMatrix
 	}
 }
 
+template<class SemiRing> inline CSRMatrix CSRMatrix::multiply(const CSRMatrix &A, const CSRMatrix &B) {
+	assert(A.nCols == B.nRows);
+
+	std::vector<index> rowIdx(A.nRows+1, 0);
+
+	// symbolic phase: count the distinct columns of each row
+#pragma omp parallel
+	{
+		std::vector<index> marker(B.nCols, none);
+#pragma omp for schedule(guided)
+		for (omp_index i = 0; i < static_cast<omp_index>(A.nRows); ++i) {
+			count nnz = 0;
+			for (index jA = A.rowIdx[i]; jA < A.rowIdx[i+1]; ++jA) {
+				index k = A.columnIdx[jA];
+				for (index jB = B.rowIdx[k]; jB < B.rowIdx[k+1]; ++jB) {
+					index j = B.columnIdx[jB];
+					if (marker[j] != (index) i) {
+						marker[j] = i;
+						++nnz;
+					}
+				}
+			}
+			rowIdx[i+1] = nnz;
+		}
+	}
+
+	for (index i = 0; i < A.nRows; ++i) {
+		rowIdx[i+1] += rowIdx[i];
+	}
+
+	std::vector<index> columnIdx(rowIdx[A.nRows]);
+	std::vector<double> nonZeros(rowIdx[A.nRows]);
+
+	// numeric phase: accumulate each row densely and write it in sorted order
+#pragma omp parallel
+	{
+		std::vector<double> values(B.nCols);
+		std::vector<bool> occupied(B.nCols, false);
+#pragma omp for schedule(guided)
+		for (omp_index i = 0; i < static_cast<omp_index>(A.nRows); ++i) {
+			index rowBegin = rowIdx[i];
+			index rowEnd = rowBegin;
+			for (index jA = A.rowIdx[i]; jA < A.rowIdx[i+1]; ++jA) {
+				index k = A.columnIdx[jA];
+				double valA = A.nonZeros[jA];
+				for (index jB = B.rowIdx[k]; jB < B.rowIdx[k+1]; ++jB) {
+					index j = B.columnIdx[jB];
+					double value = SemiRing::mult(valA, B.nonZeros[jB]);
+					if (!occupied[j]) {
+						occupied[j] = true;
+						values[j] = value;
+						columnIdx[rowEnd++] = j;
+					} else {
+						values[j] = SemiRing::add(values[j], value);
+					}
+				}
+			}
+			assert(rowEnd == rowIdx[i+1]);
+
+			std::sort(columnIdx.begin() + rowBegin, columnIdx.begin() + rowEnd);
+			for (index cIdx = rowBegin; cIdx < rowEnd; ++cIdx) {
+				index j = columnIdx[cIdx];
+				nonZeros[cIdx] = values[j];
+				occupied[j] = false;
+			}
+		}
+	}
+
+	return CSRMatrix(A.nRows, B.nCols, rowIdx, columnIdx, nonZeros, A.zero, true);
+}
+
 template<typename F>
 void CSRMatrix::apply(const F unaryElementFunction) {
 #pragma omp parallel for
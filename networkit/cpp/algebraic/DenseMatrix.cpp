@@ -7,6 +7,8 @@
 
 #include "DenseMatrix.h"
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 
 namespace NetworKit {
 
@@ -49,14 +51,6 @@ count DenseMatrix::nnz() const {
 	return nnz;
 }
 
-double DenseMatrix::operator()(const index i, const index j) const {
-	return entries[i * numberOfColumns() + j];
-}
-
-void DenseMatrix::setValue(const index i, const index j, const double value) {
-	entries[i * numberOfColumns() + j] = value;
-}
-
 Vector DenseMatrix::row(const index i) const {
 	Vector row(numberOfColumns(), zero, true);
 	index offset = i * numberOfColumns();
@@ -106,7 +100,7 @@ DenseMatrix DenseMatrix::operator-(const DenseMatrix &other) const {
 
 DenseMatrix& DenseMatrix::operator-=(const DenseMatrix &other) {
 	assert(numberOfRows() == other.numberOfRows() && numberOfColumns() == other.numberOfColumns());
-	*this = DenseMatrix::binaryOperator(*this, other, [](double val1, double val2){return val1 + val2;});
+	*this = DenseMatrix::binaryOperator(*this, other, [](double val1, double val2){return val1 - val2;});
 	return *this;
 }
 
@@ -230,6 +224,205 @@ Vector DenseMatrix::LUSolve(const DenseMatrix &LU, const Vector &b) {
 	return x;
 }
 
+DenseMatrix DenseMatrix::LUSolve(const DenseMatrix &LU, const DenseMatrix &B) {
+	assert(LU.numberOfRows() == B.numberOfRows());
+	DenseMatrix X = B;
+
+	// the substitutions run on whole rows, so all right-hand sides are processed in the same pass
+	for (index i = 0; i < LU.numberOfRows(); ++i) { // forward substitution
+		for (index j = i+1; j < LU.numberOfRows(); ++j) {
+			double l = LU(j,i);
+			for (index c = 0; c < X.numberOfColumns(); ++c) {
+				X.setValue(j, c, X(j,c) - X(i,c) * l);
+			}
+		}
+	}
+
+	for (index i = LU.numberOfRows(); i-- > 0;) { // backward substitution
+		double u = LU(i,i);
+		for (index c = 0; c < X.numberOfColumns(); ++c) {
+			X.setValue(i, c, X(i,c) / u);
+		}
+		for (index j = 0; j < i; ++j) {
+			double l = LU(j,i);
+			for (index c = 0; c < X.numberOfColumns(); ++c) {
+				X.setValue(j, c, X(j,c) - X(i,c) * l);
+			}
+		}
+	}
+
+	return X;
+}
+
+DenseMatrix DenseMatrix::mTmMultiply(const DenseMatrix &A, const DenseMatrix &B) {
+	assert(A.numberOfRows() == B.numberOfRows());
+	const count a = A.numberOfColumns();
+	const count b = B.numberOfColumns();
+	std::vector<double> resultEntries(a * b, 0.0);
+
+	// every thread sums up the outer products of its rows, the partial sums are added afterwards
+#pragma omp parallel
+	{
+		std::vector<double> local(a * b, 0.0);
+#pragma omp for
+		for (omp_index i = 0; i < static_cast<omp_index>(A.numberOfRows()); ++i) {
+			for (index r = 0; r < a; ++r) {
+				double val_i_r = A(i,r);
+				for (index c = 0; c < b; ++c) {
+					local[r * b + c] += val_i_r * B(i,c);
+				}
+			}
+		}
+
+#pragma omp critical
+		{
+			for (index k = 0; k < a * b; ++k) {
+				resultEntries[k] += local[k];
+			}
+		}
+	}
+
+	return DenseMatrix(a, b, resultEntries);
+}
+
+DenseMatrix DenseMatrix::orthonormalizeColumns(const DenseMatrix &matrix) {
+	const count n = matrix.numberOfRows();
+	const count m = matrix.numberOfColumns();
+	std::vector<double> basis(n * m, 0.0); // the first rank columns hold the basis
+	std::vector<double> v(n);
+	count rank = 0;
+	double maxNorm = 0.0;
+
+	auto length = [&]() {
+		double sum = 0.0;
+#pragma omp parallel for reduction(+:sum)
+		for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+			sum += v[i] * v[i];
+		}
+		return std::sqrt(sum);
+	};
+
+	for (index c = 0; c < m; ++c) {
+		for (index i = 0; i < n; ++i) {
+			v[i] = matrix(i,c);
+		}
+		double norm = length();
+		maxNorm = std::max(maxNorm, norm);
+
+		// Gram-Schmidt twice is enough for numerical orthogonality
+		for (count pass = 0; pass < 2 && rank > 0; ++pass) {
+			std::vector<double> h(rank, 0.0);
+#pragma omp parallel
+			{
+				std::vector<double> local(rank, 0.0);
+#pragma omp for
+				for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+					for (index r = 0; r < rank; ++r) {
+						local[r] += basis[i * m + r] * v[i];
+					}
+				}
+
+#pragma omp critical
+				{
+					for (index r = 0; r < rank; ++r) {
+						h[r] += local[r];
+					}
+				}
+			}
+
+#pragma omp parallel for
+			for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+				for (index r = 0; r < rank; ++r) {
+					v[i] -= basis[i * m + r] * h[r];
+				}
+			}
+		}
+
+		double residualNorm = length();
+		if (residualNorm > 0.0 && residualNorm > 1e-10 * std::max(norm, 1e-10 * maxNorm)) {
+#pragma omp parallel for
+			for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+				basis[i * m + rank] = v[i] / residualNorm;
+			}
+			++rank;
+		}
+	}
+
+	DenseMatrix Q(n, rank);
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+		for (index r = 0; r < rank; ++r) {
+			Q.setValue(i, r, basis[i * m + r]);
+		}
+	}
+
+	return Q;
+}
+
+void DenseMatrix::symmetricEigenDecomposition(const DenseMatrix &matrix, Vector &eigenvalues, DenseMatrix &eigenvectors) {
+	assert(matrix.numberOfRows() == matrix.numberOfColumns());
+	const count n = matrix.numberOfRows();
+	DenseMatrix A = matrix;
+	DenseMatrix V(n, n);
+	for (index i = 0; i < n; ++i) {
+		V.setValue(i, i, 1.0);
+	}
 
+	for (count sweep = 0; sweep < 100; ++sweep) {
+		double offDiagonal = 0.0;
+		double total = 0.0;
+		for (index i = 0; i < n; ++i) {
+			for (index j = 0; j < n; ++j) {
+				total += A(i,j) * A(i,j);
+				if (i != j) offDiagonal += A(i,j) * A(i,j);
+			}
+		}
+		if (offDiagonal <= 1e-30 * total) break;
+
+		for (index p = 0; p + 1 < n; ++p) {
+			for (index q = p + 1; q < n; ++q) {
+				double apq = A(p,q);
+				if (apq == 0.0) continue;
+
+				// rotation that annihilates A(p,q), see Numerical Recipes, Section 11.1
+				double theta = (A(q,q) - A(p,p)) / (2.0 * apq);
+				double t = std::abs(theta) > 1e150? 0.5 / theta : (theta >= 0.0? 1.0 : -1.0) / (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+				double c = 1.0 / std::sqrt(t * t + 1.0);
+				double s = t * c;
+
+				for (index k = 0; k < n; ++k) {
+					double akp = A(k,p), akq = A(k,q);
+					A.setValue(k, p, c * akp - s * akq);
+					A.setValue(k, q, s * akp + c * akq);
+				}
+				for (index k = 0; k < n; ++k) {
+					double apk = A(p,k), aqk = A(q,k);
+					A.setValue(p, k, c * apk - s * aqk);
+					A.setValue(q, k, s * apk + c * aqk);
+				}
+				for (index k = 0; k < n; ++k) {
+					double vkp = V(k,p), vkq = V(k,q);
+					V.setValue(k, p, c * vkp - s * vkq);
+					V.setValue(k, q, s * vkp + c * vkq);
+				}
+			}
+		}
+	}
+
+	std::vector<index> order(n);
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [&](index i, index j) {
+		return A(i,i) < A(j,j);
+	});
+
+	eigenvalues = Vector(n);
+	eigenvectors = DenseMatrix(n, n);
+	for (index c = 0; c < n; ++c) {
+		eigenvalues[c] = A(order[c], order[c]);
+		for (index k = 0; k < n; ++k) {
+			eigenvectors.setValue(k, c, V(k, order[c]));
+		}
+	}
+}
 
 } /* namespace NetworKit */
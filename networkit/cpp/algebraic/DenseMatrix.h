@@ -127,12 +127,23 @@ public:
 	/**
 	 * @return Value at matrix position (i,j).
 	 */
-	double operator()(const index i, const index j) const;
+	inline double operator()(const index i, const index j) const {
+		return entries[i * numberOfColumns() + j];
+	}
 
 	/**
 	 * Set the matrix at position (@a i, @a j) to @a value.
 	 */
-	void setValue(const index i, const index j, const double value);
+	inline void setValue(const index i, const index j, const double value) {
+		entries[i * numberOfColumns() + j] = value;
+	}
+
+	/**
+	 * @return Pointer to the entries of row @a i, which are stored consecutively.
+	 */
+	inline const double* rowData(const index i) const {
+		return entries.data() + i * numberOfColumns();
+	}
 
 
 	/**
@@ -258,6 +269,40 @@ public:
 	 */
 	static Vector LUSolve(const DenseMatrix &LU, const Vector &b);
 
+	/**
+	 * Computes the solution matrix X to the systems @a LU * X = @a B for all columns of @a B at once.
+	 * @param LU Matrix decomposed into lower L and upper U matrix.
+	 * @param B Right-hand sides.
+	 * @return Solution matrix X to the linear equation systems LU * X = B.
+	 */
+	static DenseMatrix LUSolve(const DenseMatrix &LU, const DenseMatrix &B);
+
+	/**
+	 * Computes \f$A^T * B\f$ without forming the transpose of @a A.
+	 * @param A
+	 * @param B
+	 * @return The product of the transpose of @a A with @a B.
+	 */
+	static DenseMatrix mTmMultiply(const DenseMatrix &A, const DenseMatrix &B);
+
+	/**
+	 * Computes an orthonormal basis of the space spanned by the columns of @a matrix with Gram-Schmidt. The
+	 * columns are processed from left to right, and columns that are numerically linearly dependent on the
+	 * previous ones are dropped. The result may therefore have fewer columns than @a matrix.
+	 * @param matrix
+	 * @return Matrix whose columns are the orthonormal basis.
+	 */
+	static DenseMatrix orthonormalizeColumns(const DenseMatrix &matrix);
+
+	/**
+	 * Computes the eigenvalues and eigenvectors of the symmetric @a matrix with the cyclic Jacobi method. Since
+	 * each sweep takes cubic time, this is meant for small matrices like projections onto Krylov subspaces.
+	 * @param matrix Symmetric matrix.
+	 * @param eigenvalues The eigenvalues in ascending order.
+	 * @param eigenvectors Column i holds the normalized eigenvector of the i-th eigenvalue.
+	 */
+	static void symmetricEigenDecomposition(const DenseMatrix &matrix, Vector &eigenvalues, DenseMatrix &eigenvectors);
+
 	/**
 	 * Computes @a A @a binaryOp @a B on the elements of matrix @a A and matrix @a B.
 	 * @param A
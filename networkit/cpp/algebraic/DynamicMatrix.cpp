@@ -7,21 +7,24 @@
 
 #include "DynamicMatrix.h"
 
+#include <numeric>
+#include <omp.h>
+
 namespace NetworKit {
 
-DynamicMatrix::DynamicMatrix() : graph(0, true, true), nRows(0), nCols(0), zero(0.0) {
+DynamicMatrix::DynamicMatrix() : graph(0, true, true), nRows(0), nCols(0), zero(0.0), allRowsDirty(true), trackDelta(false) {
 }
 
-DynamicMatrix::DynamicMatrix(const count dimension, const double zero) : graph(dimension, true, true), nRows(dimension), nCols(dimension), zero(zero) {
+DynamicMatrix::DynamicMatrix(const count dimension, const double zero) : graph(dimension, true, true), nRows(dimension), nCols(dimension), zero(zero), isDirty(dimension, false), allRowsDirty(true), trackDelta(false) {
 }
 
-DynamicMatrix::DynamicMatrix(const count nRows, const count nCols, const double zero) : graph(std::max(nRows, nCols), true, true), nRows(nRows), nCols(nCols), zero(zero) {
+DynamicMatrix::DynamicMatrix(const count nRows, const count nCols, const double zero) : graph(std::max(nRows, nCols), true, true), nRows(nRows), nCols(nCols), zero(zero), isDirty(nRows, false), allRowsDirty(true), trackDelta(false) {
 }
 
 DynamicMatrix::DynamicMatrix(const count dimension, const std::vector<Triplet>& triplets, const double zero) : DynamicMatrix(dimension, dimension, triplets, zero) {
 }
 
-DynamicMatrix::DynamicMatrix(const count nRows, const count nCols, const std::vector<Triplet>& triplets, const double zero) : graph(std::max(nRows, nCols), true, true), nRows(nRows), nCols(nCols), zero(zero) {
+DynamicMatrix::DynamicMatrix(const count nRows, const count nCols, const std::vector<Triplet>& triplets, const double zero) : graph(std::max(nRows, nCols), true, true), nRows(nRows), nCols(nCols), zero(zero), isDirty(nRows, false), allRowsDirty(true), trackDelta(false) {
 	for (size_t k = 0; k < triplets.size(); ++k) {
 		assert(triplets[k].row < nRows && triplets[k].column < nCols);
 		graph.addEdge(triplets[k].row, triplets[k].column, triplets[k].value);
@@ -55,11 +58,180 @@ void DynamicMatrix::setValue(const index i, const index j, const double value) {
 	assert(i >= 0 && i < nRows);
 	assert(j >= 0 && j < nCols);
 
-	if (value == getZero() && graph.hasEdge(i,j)) {
+	bool exists = graph.hasEdge(i,j);
+	double oldValue = exists? graph.weight(i,j) : zero;
+	if (exists && oldValue == value) return;
+
+	if (value == getZero()) {
+		if (!exists) return;
 		graph.removeEdge(i,j);
 	} else {
 		graph.setWeight(i, j, value);
 	}
+
+	markDirty(i);
+	recordDelta(i, j, value - oldValue);
+}
+
+void DynamicMatrix::setValues(const std::vector<Triplet>& triplets) {
+	// group the triplets by row, the counting sort keeps their order within each row
+	std::vector<index> offset(nRows + 1, 0);
+	for (const Triplet& triplet : triplets) {
+		assert(triplet.row < nRows && triplet.column < nCols);
+		++offset[triplet.row + 1];
+	}
+	for (index i = 0; i < nRows; ++i) {
+		offset[i+1] += offset[i];
+	}
+
+	std::vector<index> order(triplets.size());
+	std::vector<index> position(offset.begin(), offset.end() - 1);
+	for (index k = 0; k < triplets.size(); ++k) {
+		order[position[triplets[k].row]++] = k;
+	}
+
+	// The values of existing non-zeros are changed in place in parallel, which only writes the weights of distinct
+	// edges. Insertions and removals change the adjacency arrays of the columns as well and are collected.
+	std::vector<std::vector<Triplet>> structuralChanges(omp_get_max_threads());
+	std::vector<std::vector<Triplet>> deltas(omp_get_max_threads());
+	std::vector<char> rowChanged(nRows, false);
+#pragma omp parallel for schedule(guided)
+	for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+		if (offset[i] == offset[i+1]) continue;
+		int thread = omp_get_thread_num();
+
+		// the last triplet of each column in the row determines its value
+		std::stable_sort(order.begin() + offset[i], order.begin() + offset[i+1], [&](index a, index b) {
+			return triplets[a].column < triplets[b].column;
+		});
+		for (index k = offset[i]; k < offset[i+1]; ++k) {
+			if (k + 1 < offset[i+1] && triplets[order[k+1]].column == triplets[order[k]].column) continue;
+			index j = triplets[order[k]].column;
+			double value = triplets[order[k]].value;
+
+			bool exists = graph.hasEdge(i, j);
+			double oldValue = exists? graph.weight(i, j) : zero;
+			if ((exists && oldValue == value) || (!exists && value == zero)) continue;
+
+			if (exists && value != zero) {
+				graph.setWeight(i, j, value);
+			} else {
+				structuralChanges[thread].push_back({(index) i, j, value});
+			}
+			rowChanged[i] = true;
+			if (trackDelta) deltas[thread].push_back({(index) i, j, value - oldValue});
+		}
+	}
+
+	for (const std::vector<Triplet>& changes : structuralChanges) {
+		for (const Triplet& change : changes) {
+			if (change.value == zero) {
+				graph.removeEdge(change.row, change.column);
+			} else {
+				graph.addEdge(change.row, change.column, change.value);
+			}
+		}
+	}
+
+	for (index i = 0; i < nRows; ++i) {
+		if (rowChanged[i]) markDirty(i);
+	}
+	for (const std::vector<Triplet>& delta : deltas) {
+		deltaTriplets.insert(deltaTriplets.end(), delta.begin(), delta.end());
+	}
+}
+
+std::vector<index> DynamicMatrix::dirtyRows() const {
+	std::vector<index> rows;
+	if (allRowsDirty) {
+		rows.resize(nRows);
+		std::iota(rows.begin(), rows.end(), 0);
+	} else {
+		rows = dirtyRowList;
+		std::sort(rows.begin(), rows.end());
+	}
+
+	return rows;
+}
+
+void DynamicMatrix::clearDirtyRows() {
+	for (index i : dirtyRowList) {
+		isDirty[i] = false;
+	}
+	dirtyRowList.clear();
+	allRowsDirty = false;
+}
+
+CSRMatrix DynamicMatrix::toCSRMatrix() const {
+	std::vector<index> rowIdx(nRows + 1, 0);
+	for (index i = 0; i < nRows; ++i) {
+		rowIdx[i+1] = rowIdx[i] + graph.degree(i);
+	}
+
+	std::vector<index> columnIdx(rowIdx[nRows]);
+	std::vector<double> nonZeros(rowIdx[nRows]);
+#pragma omp parallel for schedule(guided)
+	for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+		index k = rowIdx[i];
+		graph.forEdgesOf(i, [&](index j, edgeweight weight) {
+			columnIdx[k] = j;
+			nonZeros[k] = weight;
+			++k;
+		});
+	}
+
+	return CSRMatrix(nRows, nCols, rowIdx, columnIdx, nonZeros, zero);
+}
+
+void DynamicMatrix::updateCSRMatrix(CSRMatrix& csr) {
+	if (allRowsDirty || csr.numberOfRows() != nRows || csr.numberOfColumns() != nCols) {
+		csr = toCSRMatrix();
+	} else if (!dirtyRowList.empty()) {
+		std::vector<index> rowIdx(nRows + 1, 0);
+		for (index i = 0; i < nRows; ++i) {
+			rowIdx[i+1] = rowIdx[i] + (isDirty[i]? graph.degree(i) : csr.nnzInRow(i));
+		}
+
+		std::vector<index> columnIdx(rowIdx[nRows]);
+		std::vector<double> nonZeros(rowIdx[nRows]);
+#pragma omp parallel for schedule(guided)
+		for (omp_index i = 0; i < static_cast<omp_index>(nRows); ++i) {
+			index k = rowIdx[i];
+			auto copy = [&](index j, double value) {
+				columnIdx[k] = j;
+				nonZeros[k] = value;
+				++k;
+			};
+
+			if (isDirty[i]) {
+				graph.forEdgesOf(i, copy);
+			} else {
+				csr.forNonZeroElementsInRow(i, copy);
+			}
+		}
+
+		csr = CSRMatrix(nRows, nCols, rowIdx, columnIdx, nonZeros, zero);
+	}
+
+	clearDirtyRows();
+}
+
+void DynamicMatrix::setDeltaTracking(bool enable) {
+	trackDelta = enable;
+	if (!enable) clearDelta();
+}
+
+CSRMatrix DynamicMatrix::deltaMatrix() const {
+	DynamicMatrix delta(nRows, nCols);
+	for (const Triplet& triplet : deltaTriplets) {
+		delta.graph.increaseWeight(triplet.row, triplet.column, triplet.value);
+	}
+
+	return delta.toCSRMatrix();
+}
+
+void DynamicMatrix::clearDelta() {
+	deltaTriplets.clear();
 }
 
 Vector DynamicMatrix::row(const index i) const {
@@ -104,6 +276,8 @@ DynamicMatrix& DynamicMatrix::operator+=(const DynamicMatrix &other) {
 
 	other.forNonZeroElementsInRowOrder([&](node i, node j, double value) {
 		graph.increaseWeight(i, j, value);
+		markDirty(i);
+		recordDelta(i, j, value);
 	});
 
 	return *this;
@@ -118,6 +292,8 @@ DynamicMatrix& DynamicMatrix::operator-=(const DynamicMatrix &other) {
 
 	other.forNonZeroElementsInRowOrder([&](node i, node j, double value) {
 		graph.increaseWeight(i, j, -value);
+		markDirty(i);
+		recordDelta(i, j, -value);
 	});
 
 	return *this;
@@ -128,9 +304,16 @@ DynamicMatrix DynamicMatrix::operator*(const double scalar) const {
 }
 
 DynamicMatrix& DynamicMatrix::operator*=(const double scalar) {
+	if (trackDelta) {
+		forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+			recordDelta(i, j, value * scalar - value);
+		});
+	}
+
 	graph.parallelForEdges([&](node i, node j, double value) {
 		graph.setWeight(i, j, value * scalar);
 	});
+	allRowsDirty = true;
 
 	return *this;
 }
@@ -151,7 +334,7 @@ DynamicMatrix DynamicMatrix::operator*(const DynamicMatrix &other) const {
 	assert(nCols == other.nRows);
 
 	DynamicMatrix result(numberOfRows(), other.numberOfColumns());
-	SparseAccumulator spa(other.numberOfRows());
+	SparseAccumulator spa(other.numberOfColumns());
 	for (index r = 0; r < numberOfRows(); ++r) {
 		graph.forNeighborsOf(r, [&](node v, double w1){
 			other.graph.forNeighborsOf(v, [&](node u, double w2){
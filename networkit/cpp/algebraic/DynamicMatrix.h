@@ -10,6 +10,7 @@
 
 #include "../graph/Graph.h"
 #include "Vector.h"
+#include "CSRMatrix.h"
 #include "SparseAccumulator.h"
 #include "AlgebraicGlobals.h"
 
@@ -19,6 +20,10 @@ namespace NetworKit {
  * @ingroup algebraic
  * The DynamicMatrix class represents a matrix that is optimized for sparse matrices and internally uses a graph data structure.
  * DynamicMatrix should be used when changes to the structure of the matrix are frequent.
+ *
+ * The matrix keeps track of the rows that changed since the last call of updateCSRMatrix(), so that a CSRMatrix
+ * copy for fast products can be updated by rebuilding only these rows. Optionally, it records the delta of all
+ * changes for algorithms that update their results incrementally.
  */
 class DynamicMatrix {
 protected:
@@ -29,6 +34,25 @@ protected:
 
 	double zero;
 
+	/** Rows changed since the last CSR update, allRowsDirty marks all rows as changed. */
+	std::vector<bool> isDirty;
+	std::vector<index> dirtyRowList;
+	bool allRowsDirty;
+
+	bool trackDelta;
+	std::vector<Triplet> deltaTriplets;
+
+	inline void markDirty(const index i) {
+		if (!allRowsDirty && !isDirty[i]) {
+			isDirty[i] = true;
+			dirtyRowList.push_back(i);
+		}
+	}
+
+	inline void recordDelta(const index i, const index j, const double difference) {
+		if (trackDelta) deltaTriplets.push_back({i, j, difference});
+	}
+
 public:
 	/** Default constructor */
 	DynamicMatrix();
@@ -151,6 +175,72 @@ public:
 	 */
 	void setValue(const index i, const index j, const double value);
 
+	/**
+	 * Sets the matrix at the positions of @a triplets to their values. The result is the same as calling setValue()
+	 * for the triplets in the given order. The rows are updated in parallel, only the insertion and removal of
+	 * non-zeros is sequential.
+	 * @param triplets
+	 */
+	void setValues(const std::vector<Triplet>& triplets);
+
+	/**
+	 * @return The rows changed since the last call of updateCSRMatrix() or clearDirtyRows() in ascending order.
+	 */
+	std::vector<index> dirtyRows() const;
+
+	/**
+	 * Marks all rows as unchanged.
+	 */
+	void clearDirtyRows();
+
+	/**
+	 * @return This matrix in CSR format.
+	 */
+	CSRMatrix toCSRMatrix() const;
+
+	/**
+	 * Updates @a csr, which must be the result of the last toCSRMatrix() or updateCSRMatrix() call of this matrix,
+	 * to the current values of this matrix. Only the changed rows are rebuilt from this matrix, the other rows are
+	 * copied from @a csr. If @a csr has another shape or all rows changed, it is rebuilt completely. Afterwards,
+	 * all rows are marked as unchanged.
+	 * @param csr
+	 */
+	void updateCSRMatrix(CSRMatrix& csr);
+
+	/**
+	 * Enables or disables the recording of changes, see getDelta().
+	 * @param enable
+	 */
+	void setDeltaTracking(bool enable = true);
+
+	/**
+	 * @return True if the changes of this matrix are recorded.
+	 */
+	inline bool isTrackingDelta() const {
+		return trackDelta;
+	}
+
+	/**
+	 * Returns the changes recorded since delta tracking was enabled or the last call of clearDelta(). Every change
+	 * of an entry (i,j) is a triplet (i, j, newValue - oldValue) where missing entries count as the zero element,
+	 * i.e. the sum of the triplets is the difference between the current matrix and the one at the last reset. A
+	 * position can occur more than once.
+	 */
+	inline const std::vector<Triplet>& getDelta() const {
+		return deltaTriplets;
+	}
+
+	/**
+	 * Returns the recorded changes as a matrix, i.e. the difference between the current matrix and the one at the
+	 * last reset.
+	 */
+	CSRMatrix deltaMatrix() const;
+
+	/**
+	 * Discards the recorded changes.
+	 */
+	void clearDelta();
+
 	/**
 	 * @return Row @a i of this matrix as vector.
 	 */
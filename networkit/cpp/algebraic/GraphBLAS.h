@@ -9,10 +9,16 @@
 #define NETWORKIT_CPP_ALGEBRAIC_GRAPHBLAS_H_
 
 #include <limits>
+#include <type_traits>
+#include <utility>
+#include <omp.h>
 #include "Semirings.h"
 #include "SparseAccumulator.h"
 #include "AlgebraicGlobals.h"
 #include "Vector.h"
+#include "SparseVector.h"
+#include "CSRMatrix.h"
+#include "../auxiliary/Parallel.h"
 
 /**
  * @ingroup algebraic
@@ -89,6 +95,22 @@ Matrix eWiseBinOp(const Matrix& A, const Matrix& B, L binOp) {
 	return Matrix(A.numberOfRows(), A.numberOfColumns(), triplets, A.getZero());
 }
 
+/**
+ * Computes the matrix-matrix multiplication of the CSRMatrices @a A and @a B in parallel
+ * (see CSRMatrix::multiply). Note that A.numberOfColumns() must be equal to B.numberOfRows()
+ * and the zero elements must be the same. The default Semiring is the ArithmeticSemiring.
+ * @param A
+ * @param B
+ * @return The result of the multiplication A * B.
+ */
+template<class SemiRing = ArithmeticSemiring>
+NetworKit::CSRMatrix MxM(const NetworKit::CSRMatrix& A, const NetworKit::CSRMatrix& B) {
+	assert(A.numberOfColumns() == B.numberOfRows());
+	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
+
+	return NetworKit::CSRMatrix::multiply<SemiRing>(A, B);
+}
+
 /**
  * Computes the matrix-matrix multiplication of @a A and @a B. Note that
  * A.numberOfColumns() must be equal to B.numberOfRows() and the zero elements
@@ -103,7 +125,7 @@ Matrix MxM(const Matrix& A, const Matrix& B) {
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero());
 
 	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
+	NetworKit::SparseAccumulator spa(B.numberOfColumns());
 	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
 		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
 			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
@@ -134,23 +156,7 @@ void MxM(const Matrix& A, const Matrix& B, Matrix& C) {
 	assert(A.numberOfColumns() == B.numberOfRows() && A.numberOfRows() == C.numberOfRows() && B.numberOfColumns() == C.numberOfColumns());
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero() && C.getZero() == SemiRing::zero());
 
-	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
-	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-				spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
-			});
-		});
-
-		spa.gather([&](NetworKit::index i, NetworKit::index j, double value){
-			triplets.push_back({i,j,value});
-		});
-
-		spa.increaseRow();
-	}
-
-	Matrix temp(A.numberOfRows(), B.numberOfRows(), triplets, A.getZero());
+	Matrix temp = MxM<SemiRing>(A, B);
 	C = eWiseBinOp<SemiRing, Matrix>(C, temp, *SemiRing::add);
 }
 
@@ -168,24 +174,51 @@ void MxM(const Matrix& A, const Matrix& B, Matrix& C, F accum) {
 	assert(A.numberOfColumns() == B.numberOfRows() && A.numberOfRows() == C.numberOfRows() && B.numberOfColumns() == C.numberOfColumns());
 	assert(A.getZero() == SemiRing::zero() && B.getZero() == SemiRing::zero() && C.getZero() == SemiRing::zero());
 
-	std::vector<NetworKit::Triplet> triplets;
-	NetworKit::SparseAccumulator spa(B.numberOfRows());
-	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
-		A.forNonZeroElementsInRow(i, [&](NetworKit::index k, double w1) {
-			B.forNonZeroElementsInRow(k, [&](NetworKit::index j, double w2) {
-				spa.scatter(SemiRing::mult(w1,w2), j, *SemiRing::add);
-			});
-		});
+	Matrix temp = MxM<SemiRing>(A, B);
+	C = eWiseBinOp<SemiRing, Matrix>(C, temp, accum);
+}
 
-		spa.gather([&](NetworKit::index i, NetworKit::index j, double value){
-			triplets.push_back({i,j,value});
+/**
+ * Computes the product of matrix @a A with the dense multi-vector @a X, i.e. with all columns of @a X at once, in
+ * parallel. The default Semiring is the ArithmeticSemiring.
+ * @param A
+ * @param X
+ * @return The dense result of the multiplication A * X.
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix>
+NetworKit::DenseMatrix MxMultiV(const Matrix& A, const NetworKit::DenseMatrix& X) {
+	assert(A.numberOfColumns() == X.numberOfRows());
+	assert(A.getZero() == SemiRing::zero());
+	NetworKit::DenseMatrix Y(A.numberOfRows(), X.numberOfColumns(), SemiRing::zero());
+
+#pragma omp parallel for
+	for (NetworKit::omp_index i = 0; i < static_cast<NetworKit::omp_index>(A.numberOfRows()); ++i) {
+		A.forNonZeroElementsInRow(i, [&](NetworKit::index j, double value) {
+			for (NetworKit::index c = 0; c < X.numberOfColumns(); ++c) {
+				Y.setValue(i, c, SemiRing::add(Y(i,c), SemiRing::mult(value, X(j,c))));
+			}
 		});
+	}
 
-		spa.increaseRow();
+	return Y;
+}
+
+/**
+ * Computes the product of the CSRMatrix @a A with the dense multi-vector @a X in parallel. For the
+ * ArithmeticSemiring, the register-blocked product of CSRMatrix is used. The default Semiring is the
+ * ArithmeticSemiring.
+ * @param A
+ * @param X
+ * @return The dense result of the multiplication A * X.
+ */
+template<class SemiRing = ArithmeticSemiring>
+NetworKit::DenseMatrix MxMultiV(const NetworKit::CSRMatrix& A, const NetworKit::DenseMatrix& X) {
+	if (std::is_same<SemiRing, ArithmeticSemiring>::value) {
+		assert(A.numberOfColumns() == X.numberOfRows());
+		return A * X;
 	}
 
-	Matrix temp(A.numberOfRows(), B.numberOfRows(), triplets, A.getZero());
-	C = eWiseBinOp<SemiRing, Matrix>(C, temp, accum);
+	return MxMultiV<SemiRing, NetworKit::CSRMatrix>(A, X);
 }
 
 /**
@@ -245,6 +278,127 @@ void MxV(const Matrix& A, const NetworKit::Vector& v, NetworKit::Vector& c, F ac
 	});
 }
 
+/**
+ * Computes the product of matrix @a A and the sparse vector @a v by pulling: each row i of @a A that is allowed by
+ * the mask gathers the non-zeros of @a v in its columns. The work is proportional to the number of non-zeros in the
+ * allowed rows of @a A, which pays off for dense vectors or masks that allow few rows. Row i is allowed if @a mask
+ * is empty or if mask[i] != @a complementMask. The default Semiring is the ArithmeticSemiring.
+ * @param A
+ * @param v
+ * @param mask Empty or of dimension A.numberOfRows().
+ * @param complementMask If true, exactly the rows with mask[i] == false are allowed.
+ * @return The result with sorted indices.
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix>
+NetworKit::SparseVector MxSpVPull(const Matrix& A, const NetworKit::SparseVector& v, const std::vector<bool>& mask = std::vector<bool>(), bool complementMask = false) {
+	assert(A.numberOfColumns() == v.getDimension());
+	assert(mask.empty() || mask.size() == A.numberOfRows());
+	assert(A.getZero() == SemiRing::zero() && v.getZero() == SemiRing::zero());
+
+	std::vector<double> denseV(v.getDimension(), SemiRing::zero());
+	std::vector<bool> present(v.getDimension(), false);
+	v.forNonZeroElements([&](NetworKit::index j, double value) {
+		denseV[j] = value;
+		present[j] = true;
+	});
+
+	std::vector<double> values(A.numberOfRows(), SemiRing::zero());
+	std::vector<char> found(A.numberOfRows(), false);
+#pragma omp parallel for schedule(guided)
+	for (NetworKit::omp_index i = 0; i < static_cast<NetworKit::omp_index>(A.numberOfRows()); ++i) {
+		if (!mask.empty() && mask[i] == complementMask) continue;
+		A.forNonZeroElementsInRow(i, [&](NetworKit::index j, double value) {
+			if (present[j]) {
+				values[i] = SemiRing::add(values[i], SemiRing::mult(value, denseV[j]));
+				found[i] = true;
+			}
+		});
+	}
+
+	NetworKit::SparseVector result(A.numberOfRows(), SemiRing::zero());
+	for (NetworKit::index i = 0; i < A.numberOfRows(); ++i) {
+		if (found[i]) result.insert(i, values[i]);
+	}
+
+	return result;
+}
+
+/**
+ * Computes the product of the transposed sparse vector @a v and matrix @a A (i.e. v^T * A) by pushing: the rows of
+ * @a A that belong to the non-zeros of @a v are scattered into the result. The work is proportional to the number of
+ * non-zeros in these rows and independent of the dimension, which pays off for sparse vectors. Entry i of the
+ * result is only computed if @a mask is empty or if mask[i] != @a complementMask. Since v^T * A^T = (A * v)^T,
+ * pushing along the rows of A^T computes the same as MxSpVPull on A. The default Semiring is the ArithmeticSemiring.
+ * @param v
+ * @param A
+ * @param mask Empty or of dimension A.numberOfColumns().
+ * @param complementMask If true, exactly the entries with mask[i] == false are computed.
+ * @return The result with sorted indices.
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix>
+NetworKit::SparseVector SpVxMPush(const NetworKit::SparseVector& v, const Matrix& A, const std::vector<bool>& mask = std::vector<bool>(), bool complementMask = false) {
+	assert(A.numberOfRows() == v.getDimension());
+	assert(mask.empty() || mask.size() == A.numberOfColumns());
+	assert(A.getZero() == SemiRing::zero() && v.getZero() == SemiRing::zero());
+
+	const std::vector<NetworKit::index>& indices = v.getIndices();
+	const std::vector<double>& vValues = v.getValues();
+
+	std::vector<std::vector<std::pair<NetworKit::index, double>>> threadProducts(omp_get_max_threads());
+#pragma omp parallel for schedule(guided)
+	for (NetworKit::omp_index k = 0; k < static_cast<NetworKit::omp_index>(indices.size()); ++k) {
+		std::vector<std::pair<NetworKit::index, double>>& products = threadProducts[omp_get_thread_num()];
+		A.forNonZeroElementsInRow(indices[k], [&](NetworKit::index i, double value) {
+			if (mask.empty() || mask[i] != complementMask) {
+				products.emplace_back(i, SemiRing::mult(vValues[k], value));
+			}
+		});
+	}
+
+	std::vector<std::pair<NetworKit::index, double>> products;
+	for (auto& localProducts : threadProducts) {
+		products.insert(products.end(), localProducts.begin(), localProducts.end());
+	}
+	// sorting by index and value also fixes the order of the additions independently of the threads
+	Aux::Parallel::sort(products.begin(), products.end());
+
+	NetworKit::SparseVector result(A.numberOfColumns(), SemiRing::zero());
+	for (NetworKit::index k = 0; k < products.size();) {
+		NetworKit::index i = products[k].first;
+		double value = products[k].second;
+		for (++k; k < products.size() && products[k].first == i; ++k) {
+			value = SemiRing::add(value, products[k].second);
+		}
+		result.insert(i, value);
+	}
+
+	return result;
+}
+
+/**
+ * Computes the product of matrix @a A and the sparse vector @a v, where @a At is the transpose of @a A. If the
+ * fraction of non-zeros in @a v is below @a pushThreshold, the product is pushed along the rows of @a At (see
+ * SpVxMPush), otherwise it is pulled along the rows of @a A (see MxSpVPull). Entry i of the result is only computed
+ * if @a mask is empty or if mask[i] != @a complementMask. The default Semiring is the ArithmeticSemiring.
+ * @param A
+ * @param At
+ * @param v
+ * @param mask Empty or of dimension A.numberOfRows().
+ * @param complementMask If true, exactly the entries with mask[i] == false are computed.
+ * @param pushThreshold
+ * @return The result with sorted indices.
+ */
+template<class SemiRing = ArithmeticSemiring, class Matrix>
+NetworKit::SparseVector MxSpV(const Matrix& A, const Matrix& At, const NetworKit::SparseVector& v, const std::vector<bool>& mask = std::vector<bool>(), bool complementMask = false, double pushThreshold = 0.05) {
+	assert(A.numberOfRows() == At.numberOfColumns() && A.numberOfColumns() == At.numberOfRows());
+
+	if (v.nnz() < pushThreshold * v.getDimension()) {
+		return SpVxMPush<SemiRing>(v, At, mask, complementMask);
+	} else {
+		return MxSpVPull<SemiRing>(A, v, mask, complementMask);
+	}
+}
+
 /**
  * Computes SemiRing::add(A(i,j), B(i,j)) for all i,j element-wise and returns the resulting matrix. The default
  * Semiring is the ArithmeticSemiring.
@@ -0,0 +1,140 @@
+/*
+ * GraphMatrixBuilder.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_ALGEBRAIC_GRAPHMATRIXBUILDER_H_
+#define NETWORKIT_CPP_ALGEBRAIC_GRAPHMATRIXBUILDER_H_
+
+#include <cmath>
+#include <vector>
+#include "../Globals.h"
+#include "../graph/Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup algebraic
+ * Builds the CSR arrays of the matrices of a graph directly from its neighborhoods, i.e. without an intermediate
+ * triplet list or matrix. The values and column indices are written with the types @a ValueType and @a IndexType,
+ * so that the compact matrix types are filled without a double precision copy. The row offsets keep 64 bit.
+ */
+namespace GraphMatrixBuilder {
+
+/**
+ * Builds a matrix with one row per node id of @a graph into @a rowIdx, @a columnIdx and @a nonZeros. The rows are
+ * sized by @a rowSize(u) and filled by @a fillRow(u, columns, values) in parallel. Rows of non-existing nodes are
+ * empty.
+ */
+template<typename ValueType, typename IndexType, typename S, typename F>
+void fromGraphRows(const Graph& graph, S rowSize, F fillRow, std::vector<index>& rowIdx, std::vector<IndexType>& columnIdx, std::vector<ValueType>& nonZeros) {
+	const count n = graph.upperNodeIdBound();
+	rowIdx.assign(n + 1, 0);
+#pragma omp parallel for
+	for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+		if (graph.hasNode(u)) {
+			rowIdx[u+1] = rowSize(u);
+		}
+	}
+
+	for (index u = 0; u < n; ++u) {
+		rowIdx[u+1] += rowIdx[u];
+	}
+
+	columnIdx.resize(rowIdx[n]);
+	nonZeros.resize(rowIdx[n]);
+	IndexType *columns = columnIdx.data();
+	ValueType *values = nonZeros.data();
+#pragma omp parallel for schedule(guided)
+	for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+		if (graph.hasNode(u)) {
+			fillRow(u, columns + rowIdx[u], values + rowIdx[u]);
+		}
+	}
+}
+
+/**
+ * Builds the (weighted) adjacency matrix of @a graph.
+ */
+template<typename ValueType, typename IndexType>
+void adjacencyMatrix(const Graph& graph, std::vector<index>& rowIdx, std::vector<IndexType>& columnIdx, std::vector<ValueType>& nonZeros) {
+	// the rows are the (out-)neighborhoods, which contain a self-loop only once
+	fromGraphRows(graph, [&](node u) {
+		return graph.degree(u);
+	}, [&](node u, IndexType *columns, ValueType *values) {
+		index k = 0;
+		graph.forNeighborsOf(u, [&](node v, edgeweight w) {
+			columns[k] = static_cast<IndexType>(v);
+			values[k] = static_cast<ValueType>(w);
+			++k;
+		});
+	}, rowIdx, columnIdx, nonZeros);
+}
+
+/**
+ * Builds the (weighted) Laplacian matrix of @a graph.
+ */
+template<typename ValueType, typename IndexType>
+void laplacianMatrix(const Graph& graph, std::vector<index>& rowIdx, std::vector<IndexType>& columnIdx, std::vector<ValueType>& nonZeros) {
+	fromGraphRows(graph, [&](node u) {
+		return graph.degree(u) + 1;
+	}, [&](node u, IndexType *columns, ValueType *values) {
+		double weightedDegree = 0.0;
+		index k = 0;
+		graph.forNeighborsOf(u, [&](node v, edgeweight w) { // - adjacency matrix
+			if (u != v) { // exclude diagonal since this would be subtracted by the adjacency weight
+				weightedDegree += w;
+			}
+
+			columns[k] = static_cast<IndexType>(v);
+			values[k] = static_cast<ValueType>(-w);
+			++k;
+		});
+
+		columns[k] = static_cast<IndexType>(u); // degree matrix
+		values[k] = static_cast<ValueType>(weightedDegree);
+	}, rowIdx, columnIdx, nonZeros);
+}
+
+/**
+ * Builds the (weighted) normalized Laplacian matrix of @a graph.
+ */
+template<typename ValueType, typename IndexType>
+void normalizedLaplacianMatrix(const Graph& graph, std::vector<index>& rowIdx, std::vector<IndexType>& columnIdx, std::vector<ValueType>& nonZeros) {
+	std::vector<double> weightedDegrees(graph.upperNodeIdBound(), 0.0);
+	std::vector<double> selfLoopWeight(graph.upperNodeIdBound(), 0.0);
+	std::vector<count> numSelfLoops(graph.upperNodeIdBound(), 0);
+	graph.parallelForNodes([&](const node u) {
+		weightedDegrees[u] = graph.weightedDegree(u);
+		graph.forNeighborsOf(u, [&](node v, edgeweight w) {
+			if (u == v && numSelfLoops[u]++ == 0) {
+				selfLoopWeight[u] = w;
+			}
+		});
+	});
+
+	fromGraphRows(graph, [&](node u) {
+		return graph.degree(u) - numSelfLoops[u] + (weightedDegrees[u] != 0.0? 1 : 0);
+	}, [&](node u, IndexType *columns, ValueType *values) {
+		index k = 0;
+		graph.forNeighborsOf(u, [&](node v, edgeweight w) {
+			if (u != v) {
+				columns[k] = static_cast<IndexType>(v);
+				values[k] = static_cast<ValueType>(-w / std::sqrt(weightedDegrees[u] * weightedDegrees[v]));
+				++k;
+			}
+		});
+
+		if (weightedDegrees[u] != 0.0) {
+			columns[k] = static_cast<IndexType>(u);
+			values[k] = static_cast<ValueType>(graph.isWeighted()? 1 - selfLoopWeight[u] / weightedDegrees[u] : 1);
+		}
+	}, rowIdx, columnIdx, nonZeros);
+}
+
+} /* namespace GraphMatrixBuilder */
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_ALGEBRAIC_GRAPHMATRIXBUILDER_H_ */
@@ -0,0 +1,163 @@
+/*
+ * SellCSigmaMatrix.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "SellCSigmaMatrix.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace NetworKit {
+
+namespace {
+
+/**
+ * Adds the products of the @a C rows of a chunk with @a x to @a sums. The chunk has @a length columns starting at
+ * @a columns and @a values, row r has @a lengths[r] non-zeros. A padding entry would compute 0 * x[0], which is NaN
+ * if x[0] is infinite, so the padding is masked out.
+ */
+inline void chunkTimesVector(const index *columns, const double *values, const index *lengths, count length, count C, const double *x, double *sums) {
+#if defined(__AVX512F__)
+	if (C % 8 == 0) {
+		for (index g = 0; g < C; g += 8) {
+			__m512d sum = _mm512_loadu_pd(sums + g);
+			const __m512i rowLengths = _mm512_loadu_si512(lengths + g);
+			for (index k = 0; k < length; ++k) {
+				const index offset = k * C + g;
+				const __mmask8 active = _mm512_cmpgt_epu64_mask(rowLengths, _mm512_set1_epi64(k));
+				const __m512i cols = _mm512_loadu_si512(columns + offset);
+				const __m512d xs = _mm512_mask_i64gather_pd(_mm512_setzero_pd(), active, cols, x, sizeof(double));
+				sum = _mm512_fmadd_pd(_mm512_loadu_pd(values + offset), xs, sum);
+			}
+			_mm512_storeu_pd(sums + g, sum);
+		}
+		return;
+	}
+#endif
+#if defined(__AVX2__)
+	if (C % 4 == 0) {
+		for (index g = 0; g < C; g += 4) {
+			__m256d sum = _mm256_loadu_pd(sums + g);
+			const __m256i rowLengths = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lengths + g));
+			for (index k = 0; k < length; ++k) {
+				const index offset = k * C + g;
+				const __m256i active = _mm256_cmpgt_epi64(rowLengths, _mm256_set1_epi64x(k));
+				const __m256i cols = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns + offset));
+				const __m256d xs = _mm256_mask_i64gather_pd(_mm256_setzero_pd(), x, cols, _mm256_castsi256_pd(active), sizeof(double));
+				sum = _mm256_add_pd(sum, _mm256_mul_pd(_mm256_loadu_pd(values + offset), xs));
+			}
+			_mm256_storeu_pd(sums + g, sum);
+		}
+		return;
+	}
+#endif
+	for (index k = 0; k < length; ++k) {
+		const index offset = k * C;
+		for (index r = 0; r < C; ++r) {
+			const double product = values[offset + r] * x[columns[offset + r]];
+			sums[r] += k < lengths[r]? product : 0.0;
+		}
+	}
+}
+
+} // namespace
+
+const count SellCSigmaMatrix::MAX_CHUNK_HEIGHT;
+
+SellCSigmaMatrix::SellCSigmaMatrix() : nRows(0), nCols(0), chunkHeight(1), sigma(1), zero(0.0), chunkOffset(1, 0), numberOfNonZeros(0) {
+}
+
+SellCSigmaMatrix::SellCSigmaMatrix(const CSRMatrix& matrix, count chunkHeight, count sigma) : nRows(matrix.numberOfRows()), nCols(matrix.numberOfColumns()), chunkHeight(chunkHeight), sigma(std::max<count>(sigma, 1)), zero(matrix.getZero()), numberOfNonZeros(matrix.nnz()) {
+	if (chunkHeight == 0 || chunkHeight > MAX_CHUNK_HEIGHT) {
+		throw std::runtime_error("The chunk height must be between 1 and 64");
+	}
+
+	// sort the rows by descending length within each window of sigma rows
+	rowPermutation.resize(nRows);
+	std::iota(rowPermutation.begin(), rowPermutation.end(), 0);
+	const count numWindows = (nRows + this->sigma - 1) / this->sigma;
+#pragma omp parallel for schedule(guided)
+	for (omp_index w = 0; w < static_cast<omp_index>(numWindows); ++w) {
+		auto begin = rowPermutation.begin() + w * this->sigma;
+		auto end = rowPermutation.begin() + std::min(nRows, (w + 1) * this->sigma);
+		std::stable_sort(begin, end, [&](index a, index b) {
+			return matrix.nnzInRow(a) > matrix.nnzInRow(b);
+		});
+	}
+
+	rowPosition.resize(nRows);
+#pragma omp parallel for
+	for (omp_index r = 0; r < static_cast<omp_index>(nRows); ++r) {
+		rowPosition[rowPermutation[r]] = r;
+	}
+
+	const count numChunks = (nRows + chunkHeight - 1) / chunkHeight;
+	chunkLength.assign(numChunks, 0);
+	rowLength.assign(numChunks * chunkHeight, 0);
+#pragma omp parallel for
+	for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+		for (index r = c * chunkHeight; r < std::min(nRows, (c + 1) * chunkHeight); ++r) {
+			rowLength[r] = matrix.nnzInRow(rowPermutation[r]);
+			chunkLength[c] = std::max(chunkLength[c], rowLength[r]);
+		}
+	}
+
+	chunkOffset.assign(numChunks + 1, 0);
+	for (index c = 0; c < numChunks; ++c) {
+		chunkOffset[c+1] = chunkOffset[c] + chunkLength[c] * chunkHeight;
+	}
+
+	// padding entries hold the value 0.0 in column 0, which is a valid position to load, and are skipped in products
+	columnIdx.assign(chunkOffset[numChunks], 0);
+	nonZeros.assign(chunkOffset[numChunks], 0.0);
+#pragma omp parallel for schedule(guided)
+	for (omp_index c = 0; c < static_cast<omp_index>(numChunks); ++c) {
+		for (index r = c * chunkHeight; r < std::min(nRows, (c + 1) * chunkHeight); ++r) {
+			index pos = chunkOffset[c] + (r - c * chunkHeight);
+			matrix.forNonZeroElementsInRow(rowPermutation[r], [&](index j, double value) {
+				columnIdx[pos] = j;
+				nonZeros[pos] = value;
+				pos += this->chunkHeight;
+			});
+		}
+	}
+}
+
+Vector SellCSigmaMatrix::operator*(const Vector &vector) const {
+	assert(!vector.isTransposed());
+	assert(nCols == vector.getDimension());
+
+	Vector result(nRows, zero);
+	if (nRows == 0 || nCols == 0) return result;
+
+	const index *columns = columnIdx.data();
+	const double *values = nonZeros.data();
+	const double *x = &vector[0];
+	const count C = chunkHeight;
+
+#pragma omp parallel for schedule(guided)
+	for (omp_index c = 0; c < static_cast<omp_index>(chunkLength.size()); ++c) {
+		double sums[MAX_CHUNK_HEIGHT];
+		for (index r = 0; r < C; ++r) {
+			sums[r] = zero;
+		}
+
+		// the rows of the chunk are processed in lockstep
+		chunkTimesVector(columns + chunkOffset[c], values + chunkOffset[c], &rowLength[c * C], chunkLength[c], C, x, sums);
+
+		for (index r = 0; r < C && c * C + r < nRows; ++r) {
+			result[rowPermutation[c * C + r]] = sums[r];
+		}
+	}
+
+	return result;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,130 @@
+/*
+ * SellCSigmaMatrix.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_ALGEBRAIC_SELLCSIGMAMATRIX_H_
+#define NETWORKIT_CPP_ALGEBRAIC_SELLCSIGMAMATRIX_H_
+
+#include <vector>
+#include "../Globals.h"
+#include "CSRMatrix.h"
+#include "Vector.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup algebraic
+ * Read-only sparse matrix in the SELL-C-sigma format of Kreutzer et al.: A unified sparse matrix data format for
+ * efficient general sparse matrix-vector multiplication on modern processors with wide SIMD units (SIAM J. Sci.
+ * Comput. 2014).
+ *
+ * The rows are grouped into chunks of @a chunkHeight rows. The non-zeros of a chunk are stored column by column,
+ * i.e. the k-th non-zeros of all rows of the chunk are consecutive, and every row is padded to the longest row of
+ * its chunk. A matrix-vector product then processes all rows of a chunk in lockstep. If the build targets AVX-512
+ * or AVX2, chunk heights that are multiples of 8 or 4 use gather kernels, other heights a plain loop that the
+ * compiler can vectorize. The padding entries are masked out by the row lengths, so that infinite or NaN entries of
+ * the vector only affect the rows that actually refer to them. To reduce the padding, the rows within each window of
+ * @a sigma rows are sorted by their number of non-zeros.
+ *
+ * Converting a CSRMatrix takes time linear in its size, which pays off if many products with the same matrix are
+ * computed, e.g. in eigenvector or power iterations. The matrix can be passed to the Lanczos eigensolver instead of
+ * a CSRMatrix for this purpose.
+ */
+class SellCSigmaMatrix {
+private:
+	count nRows;
+	count nCols;
+	count chunkHeight;
+	count sigma;
+	double zero;
+
+	/** the non-zeros of chunk c are at [chunkOffset[c], chunkOffset[c+1]) */
+	std::vector<index> chunkOffset;
+	/** the padded length of the rows of chunk c */
+	std::vector<count> chunkLength;
+	/** row r of the layout is row rowPermutation[r] of the original matrix */
+	std::vector<index> rowPermutation;
+	/** row i of the original matrix is row rowPosition[i] of the layout */
+	std::vector<index> rowPosition;
+	/** number of non-zeros of row r of the layout, 0 for the rows that fill up the last chunk */
+	std::vector<index> rowLength;
+	std::vector<index> columnIdx;
+	std::vector<double> nonZeros;
+	count numberOfNonZeros;
+
+public:
+	/** Maximal supported chunk height */
+	static const count MAX_CHUNK_HEIGHT = 64;
+
+	/** Default constructor */
+	SellCSigmaMatrix();
+
+	/**
+	 * Converts @a matrix into the SELL-C-sigma format.
+	 * @param matrix
+	 * @param chunkHeight Number of rows per chunk; should be a multiple of the SIMD width (default = 8).
+	 * @param sigma Size of the windows in which rows are sorted by length; 1 disables sorting (default = 256).
+	 */
+	SellCSigmaMatrix(const CSRMatrix& matrix, count chunkHeight = 8, count sigma = 256);
+
+	/**
+	 * @return Number of rows.
+	 */
+	inline count numberOfRows() const {
+		return nRows;
+	}
+
+	/**
+	 * @return Number of columns.
+	 */
+	inline count numberOfColumns() const {
+		return nCols;
+	}
+
+	/**
+	 * @return The zero element of the matrix.
+	 */
+	inline double getZero() const {
+		return zero;
+	}
+
+	/**
+	 * @return Number of non-zeros of the original matrix.
+	 */
+	inline count nnz() const {
+		return numberOfNonZeros;
+	}
+
+	/**
+	 * @return Number of stored entries including the padding.
+	 */
+	inline count storedEntries() const {
+		return nonZeros.size();
+	}
+
+	/**
+	 * Iterate over all non-zero elements of row @a row in the matrix and call handle(index column, double value).
+	 */
+	template<typename L> void forNonZeroElementsInRow(index row, L handle) const;
+
+	/**
+	 * Multiplies this matrix with @a vector and returns the result.
+	 * @return The result of multiplying this matrix with @a vector.
+	 */
+	Vector operator*(const Vector &vector) const;
+};
+
+template<typename L>
+inline void SellCSigmaMatrix::forNonZeroElementsInRow(index row, L handle) const {
+	const index r = rowPosition[row];
+	const index chunk = r / chunkHeight;
+	for (index k = 0, pos = chunkOffset[chunk] + r % chunkHeight; k < rowLength[r]; ++k, pos += chunkHeight) {
+		handle(columnIdx[pos], nonZeros[pos]);
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_ALGEBRAIC_SELLCSIGMAMATRIX_H_ */
@@ -9,6 +9,7 @@
 #define NETWORKIT_CPP_ALGEBRAIC_SEMIRINGS_H_
 
 #include <algorithm>
+#include <limits>
 
 // *****************************************************
 // 					Semiring Definitions
@@ -0,0 +1,65 @@
+/*
+ * SparseVector.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include "SparseVector.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace NetworKit {
+
+SparseVector::SparseVector() : dimension(0), zero(0.0) {
+}
+
+SparseVector::SparseVector(const count dimension, const double zero) : dimension(dimension), zero(zero) {
+}
+
+SparseVector::SparseVector(const count dimension, const std::vector<index>& indices, const std::vector<double>& values, const double zero) : indices(indices), values(values), dimension(dimension), zero(zero) {
+	assert(indices.size() == values.size());
+}
+
+SparseVector::SparseVector(const Vector& vector, const double zero) : dimension(vector.getDimension()), zero(zero) {
+	for (index i = 0; i < vector.getDimension(); ++i) {
+		if (vector[i] != zero) {
+			insert(i, vector[i]);
+		}
+	}
+}
+
+void SparseVector::clear() {
+	indices.clear();
+	values.clear();
+}
+
+void SparseVector::sort() {
+	if (std::is_sorted(indices.begin(), indices.end())) return;
+
+	std::vector<index> permutation(indices.size());
+	std::iota(permutation.begin(), permutation.end(), 0);
+	std::sort(permutation.begin(), permutation.end(), [&](index a, index b) {
+		return indices[a] < indices[b];
+	});
+
+	std::vector<index> sortedIndices(indices.size());
+	std::vector<double> sortedValues(values.size());
+	for (index k = 0; k < permutation.size(); ++k) {
+		sortedIndices[k] = indices[permutation[k]];
+		sortedValues[k] = values[permutation[k]];
+	}
+	indices = std::move(sortedIndices);
+	values = std::move(sortedValues);
+}
+
+Vector SparseVector::toVector() const {
+	Vector result(dimension, zero);
+	forNonZeroElements([&](index i, double value) {
+		result[i] = value;
+	});
+
+	return result;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,146 @@
+/*
+ * SparseVector.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_ALGEBRAIC_SPARSEVECTOR_H_
+#define NETWORKIT_CPP_ALGEBRAIC_SPARSEVECTOR_H_
+
+#include <vector>
+#include <cassert>
+#include "../Globals.h"
+#include "Vector.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup algebraic
+ * The SparseVector class represents a vector of which only the non-zero elements are stored as (index, value) pairs.
+ * Operations on a SparseVector are proportional to its number of non-zeros instead of its dimension, which makes it
+ * suitable for the frontiers of graph traversals.
+ */
+class SparseVector {
+private:
+	std::vector<index> indices;
+	std::vector<double> values;
+	count dimension;
+	double zero;
+
+public:
+	/** Default constructor */
+	SparseVector();
+
+	/**
+	 * Constructs an empty SparseVector with dimension @a dimension.
+	 * @param dimension
+	 * @param zero The zero element (default = 0.0).
+	 */
+	SparseVector(const count dimension, const double zero = 0.0);
+
+	/**
+	 * Constructs the SparseVector with dimension @a dimension and the non-zeros at @a indices with values @a values.
+	 * @param dimension
+	 * @param indices Indices of the non-zeros, each index must occur at most once.
+	 * @param values Values of the non-zeros. Must be as long as @a indices.
+	 * @param zero The zero element (default = 0.0).
+	 */
+	SparseVector(const count dimension, const std::vector<index>& indices, const std::vector<double>& values, const double zero = 0.0);
+
+	/**
+	 * Constructs the SparseVector from the non-zeros of @a vector.
+	 * @param vector
+	 * @param zero The zero element (default = 0.0).
+	 */
+	SparseVector(const Vector& vector, const double zero = 0.0);
+
+	/**
+	 * @return The dimension of this vector.
+	 */
+	inline count getDimension() const {
+		return dimension;
+	}
+
+	/**
+	 * @return The number of non-zeros of this vector.
+	 */
+	inline count nnz() const {
+		return indices.size();
+	}
+
+	/**
+	 * @return The zero element of this vector.
+	 */
+	inline double getZero() const {
+		return zero;
+	}
+
+	/**
+	 * Appends the non-zero @a value at index @a i. The index must not be present yet.
+	 * @param i
+	 * @param value
+	 */
+	inline void insert(const index i, const double value) {
+		assert(i < dimension);
+		indices.push_back(i);
+		values.push_back(value);
+	}
+
+	/**
+	 * Removes all non-zeros from this vector.
+	 */
+	void clear();
+
+	/**
+	 * Sorts the non-zeros by their index.
+	 */
+	void sort();
+
+	/**
+	 * @return The indices of the non-zeros.
+	 */
+	inline const std::vector<index>& getIndices() const {
+		return indices;
+	}
+
+	/**
+	 * @return The values of the non-zeros in the order of getIndices().
+	 */
+	inline const std::vector<double>& getValues() const {
+		return values;
+	}
+
+	/**
+	 * @return The dense representation of this vector.
+	 */
+	Vector toVector() const;
+
+	/**
+	 * Iterate over all non-zeros of the vector and call handle(index i, double value).
+	 */
+	template<typename L> void forNonZeroElements(L handle) const;
+
+	/**
+	 * Iterate in parallel over all non-zeros of the vector and call handle(index i, double value).
+	 */
+	template<typename L> void parallelForNonZeroElements(L handle) const;
+};
+
+template<typename L>
+inline void SparseVector::forNonZeroElements(L handle) const {
+	for (index k = 0; k < indices.size(); ++k) {
+		handle(indices[k], values[k]);
+	}
+}
+
+template<typename L>
+inline void SparseVector::parallelForNonZeroElements(L handle) const {
+#pragma omp parallel for
+	for (omp_index k = 0; k < static_cast<omp_index>(indices.size()); ++k) {
+		handle(indices[k], values[k]);
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_ALGEBRAIC_SPARSEVECTOR_H_ */
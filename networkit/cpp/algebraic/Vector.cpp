@@ -61,13 +61,27 @@ bool Vector::operator!=(const Vector &other) const {
 double Vector::innerProduct(const Vector &v1, const Vector &v2) {
 	assert(v1.getDimension() == v2.getDimension());
 	double scalar = 0.0;
-	for (index i = 0; i < v1.getDimension(); ++i) {
-		scalar += v1[i] * v2[i];
+#pragma omp parallel for reduction(+:scalar)
+	for (omp_index i = 0; i < static_cast<omp_index>(v1.getDimension()); ++i) {
+		scalar += v1.values[i] * v2.values[i];
 	}
 
 	return scalar;
 }
 
+std::pair<double, double> Vector::innerProducts(const Vector &v, const Vector &w1, const Vector &w2) {
+	assert(v.getDimension() == w1.getDimension() && v.getDimension() == w2.getDimension());
+	double first = 0.0;
+	double second = 0.0;
+#pragma omp parallel for reduction(+:first,second)
+	for (omp_index i = 0; i < static_cast<omp_index>(v.getDimension()); ++i) {
+		first += v.values[i] * w1.values[i];
+		second += v.values[i] * w2.values[i];
+	}
+
+	return std::make_pair(first, second);
+}
+
 double Vector::operator*(const Vector &other) const {
 	assert(isTransposed() && !other.isTransposed()); // vectors must be transposed correctly for inner product
 	assert(getDimension() == other.getDimension()); // dimensions of vectors must match
@@ -154,6 +168,44 @@ Vector& Vector::operator-=(const double value) {
 	return *this;
 }
 
+Vector& Vector::axpy(const double alpha, const Vector &x) {
+	assert(isTransposed() == x.isTransposed());
+	assert(getDimension() == x.getDimension());
+
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); ++i) {
+		values[i] += alpha * x.values[i];
+	}
+
+	return *this;
+}
+
+Vector& Vector::axpby(const double alpha, const Vector &x, const double beta) {
+	assert(isTransposed() == x.isTransposed());
+	assert(getDimension() == x.getDimension());
+
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); ++i) {
+		values[i] = alpha * x.values[i] + beta * values[i];
+	}
+
+	return *this;
+}
+
+double Vector::axpyAndSquaredLength(const double alpha, const Vector &x) {
+	assert(isTransposed() == x.isTransposed());
+	assert(getDimension() == x.getDimension());
+
+	double squaredLength = 0.0;
+#pragma omp parallel for reduction(+:squaredLength)
+	for (omp_index i = 0; i < static_cast<omp_index>(getDimension()); ++i) {
+		values[i] += alpha * x.values[i];
+		squaredLength += values[i] * values[i];
+	}
+
+	return squaredLength;
+}
+
 
 } /* namespace NetworKit */
 
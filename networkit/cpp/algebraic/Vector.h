@@ -9,6 +9,7 @@
 #define VECTOR_H_
 
 #include <vector>
+#include <utility>
 #include "../Globals.h"
 #include "AlgebraicGlobals.h"
 #include <cassert>
@@ -161,6 +162,13 @@ public:
 	 */
 	static double innerProduct(const Vector &v1, const Vector &v2);
 
+	/**
+	 * Computes the inner products of @a v with @a w1 and with @a w2 in a single pass over the vectors, e.g. the
+	 * squared length and an inner product if @a w1 is @a v.
+	 * @return The pair (v * w1, v * w2).
+	 */
+	static std::pair<double, double> innerProducts(const Vector &v, const Vector &w1, const Vector &w2);
+
 	/**
 	 * Computes the inner product (dot product) of this vector and @a other.
 	 * @return The result of the inner product.
@@ -248,6 +256,24 @@ public:
 	 */
 	Vector& operator-=(const double value);
 
+	/**
+	 * Adds @a alpha * @a x to this vector without creating temporary vectors.
+	 * @return Reference to this vector.
+	 */
+	Vector& axpy(const double alpha, const Vector &x);
+
+	/**
+	 * Sets this vector to @a alpha * @a x + @a beta * this in a single pass.
+	 * @return Reference to this vector.
+	 */
+	Vector& axpby(const double alpha, const Vector &x, const double beta);
+
+	/**
+	 * Adds @a alpha * @a x to this vector and computes the squared length of the result in the same pass.
+	 * @return The squared length of the updated vector.
+	 */
+	double axpyAndSquaredLength(const double alpha, const Vector &x);
+
 	/**
 	 * Applies the unary function @a unaryElementFunction to each value in the Vector. Note that it must hold that the
 	 * function applied to the zero element of this matrix returns the zero element.
@@ -11,13 +11,17 @@
 #include "../../base/Algorithm.h"
 #include "../../graph/Graph.h"
 #include "../Vector.h"
+#include "../SparseVector.h"
 #include "../GraphBLAS.h"
 
 namespace NetworKit {
 
 /**
  * @ingroup algebraic
- * Implementation of Breadth-First-Search using the GraphBLAS interface.
+ * Implementation of Breadth-First-Search using the GraphBLAS interface. Each level multiplies the adjacency
+ * matrix with the sparse frontier, masked by the complement of the visited nodes. Depending on the size of
+ * the frontier, the product is pushed along the out-edges of the frontier or pulled along the in-edges of
+ * the unvisited nodes (see GraphBLAS::MxSpV). Edge weights are ignored.
  */
 template<class Matrix>
 class AlgebraicBFS : public Algorithm {
@@ -27,7 +31,7 @@ public:
 	 * @param graph
 	 * @param source
 	 */
-	AlgebraicBFS(const Graph& graph, node source) : At(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero()).transpose()), source(source) {}
+	AlgebraicBFS(const Graph& graph, node source) : A(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero())), At(graph.isDirected()? A.transpose() : A), source(source) {}
 
 	/**
 	 * Runs a bfs using the GraphBLAS interface from the source node.
@@ -45,6 +49,7 @@ public:
 	}
 
 private:
+	Matrix A;
 	Matrix At;
 	node source;
 	Vector distances;
@@ -56,11 +61,18 @@ void AlgebraicBFS<Matrix>::run() {
 	distances = Vector(n, std::numeric_limits<double>::infinity());
 	distances[source] = 0;
 
-	Vector oldDist;
-	do {
-		oldDist = distances;
-		GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
-	} while (oldDist != distances);
+	std::vector<bool> visited(n, false);
+	visited[source] = true;
+
+	SparseVector frontier(n, MinPlusSemiring::zero());
+	frontier.insert(source, 0);
+	for (double level = 1; frontier.nnz() > 0; ++level) {
+		frontier = GraphBLAS::MxSpV<MinPlusSemiring>(At, A, frontier, visited, true);
+		frontier.forNonZeroElements([&](index v, double) {
+			visited[v] = true;
+			distances[v] = level;
+		});
+	}
 
 	hasRun = true;
 }
@@ -11,6 +11,7 @@
 #include "../../base/Algorithm.h"
 #include "../../graph/Graph.h"
 #include "../GraphBLAS.h"
+#include "../SparseVector.h"
 
 #include <iostream>
 
@@ -18,7 +19,9 @@ namespace NetworKit {
 
 /**
  * @ingroup algebraic
- * Implementation of the Bellman-Ford algorithm using the GraphBLAS interface.
+ * Implementation of the Bellman-Ford algorithm using the GraphBLAS interface. Each round only relaxes the
+ * out-edges of the nodes whose distance changed in the previous round, by multiplying the adjacency matrix
+ * with the sparse vector of their distances (see GraphBLAS::MxSpV).
  */
 template<class Matrix>
 class AlgebraicBellmanFord : public Algorithm {
@@ -28,7 +31,7 @@ public:
 	 * @param graph
 	 * @param source
 	 */
-	AlgebraicBellmanFord(const Graph& graph, node source) : At(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero()).transpose()), source(source), negCycle(false) {}
+	AlgebraicBellmanFord(const Graph& graph, node source) : A(Matrix::adjacencyMatrix(graph, MinPlusSemiring::zero())), At(graph.isDirected()? A.transpose() : A), source(source), negCycle(false) {}
 
 	/** Default destructor */
 	~AlgebraicBellmanFord() = default;
@@ -58,6 +61,7 @@ public:
 	}
 
 private:
+	const Matrix A;
 	const Matrix At;
 	node source;
 	Vector distances;
@@ -70,13 +74,22 @@ void AlgebraicBellmanFord<Matrix>::run() {
 	distances = Vector(n, std::numeric_limits<double>::infinity());
 	distances[source] = 0;
 
-	for (index k = 1; k < n; ++k) {
-		GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
+	SparseVector changed(n, MinPlusSemiring::zero());
+	changed.insert(source, 0);
+
+	// after n-1 rounds, a distance can only still decrease on a negative cycle
+	for (index k = 0; k < n && changed.nnz() > 0; ++k) {
+		SparseVector relaxed = GraphBLAS::MxSpV<MinPlusSemiring>(At, A, changed);
+		changed.clear();
+		relaxed.forNonZeroElements([&](index v, double distance) {
+			if (distance < distances[v]) {
+				distances[v] = distance;
+				changed.insert(v, distance);
+			}
+		});
 	}
 
-	Vector oldDist = distances;
-	GraphBLAS::MxV<MinPlusSemiring>(At, distances, distances);
-	negCycle = (oldDist != distances);
+	negCycle = changed.nnz() > 0;
 	hasRun = true;
 }
 
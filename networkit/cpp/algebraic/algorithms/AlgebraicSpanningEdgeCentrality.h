@@ -27,7 +27,7 @@ public:
 	 * @param graph
 	 * @param tol
 	 */
-	AlgebraicSpanningEdgeCentrality(const Graph& graph, double tol = 0.1) : Centrality(graph), tol(tol) {}
+	AlgebraicSpanningEdgeCentrality(const Graph& graph, double tol = 0.1) : Centrality(graph), tol(tol), lamg(1e-5) {}
 
 
 	/**
@@ -42,6 +42,7 @@ public:
 
 private:
 	double tol;
+	Lamg<Matrix> lamg; // keeps its hierarchy between runs on the same graph
 };
 
 template<class Matrix>
@@ -60,7 +61,6 @@ void AlgebraicSpanningEdgeCentrality<Matrix>::run() {
 
 	std::vector<Vector> solutions(m, Vector(n));
 
-	Lamg<Matrix> lamg(1e-5);
 	lamg.setupConnected(Matrix::laplacianMatrix(this->G));
 	lamg.parallelSolve(rhs, solutions);
 
@@ -95,7 +95,6 @@ void AlgebraicSpanningEdgeCentrality<Matrix>::runApproximation() {
 	});
 
 
-	Lamg<Matrix> lamg(1e-5);
 	lamg.setupConnected(Matrix::laplacianMatrix(this->G));
 	lamg.parallelSolve(yRows, zRows);
 
@@ -8,6 +8,10 @@
 #include <gtest/gtest.h>
 
 #include "../../CSRMatrix.h"
+#include "../../CompactCSRMatrix.h"
+#include "../../DynamicMatrix.h"
+#include "../../../generators/ErdosRenyiGenerator.h"
+#include "../../../auxiliary/Random.h"
 #include "../../../distance/BFS.h"
 #include "../AlgebraicBFS.h"
 #include "../../../io/METISGraphReader.h"
@@ -65,6 +69,30 @@ TEST(AlgebraicBFSGTest, testOnToyGraph) {
 	EXPECT_EQ(3, bfs.distance(6));
 }
 
+TEST(AlgebraicBFSGTest, testDirectedRandomGraph) {
+	Aux::Random::setSeed(42, false);
+	// sparse enough that the frontiers are pushed in the first and last levels and pulled in between
+	ErdosRenyiGenerator generator(2000, 0.002, true);
+	Graph G = generator.generate();
+
+	BFS bfs(G, 0, false);
+	bfs.run();
+
+	AlgebraicBFS<CSRMatrix> csrBfs(G, 0);
+	csrBfs.run();
+	AlgebraicBFS<DynamicMatrix> dynamicBfs(G, 0);
+	dynamicBfs.run();
+	AlgebraicBFS<CSRMatrix32> compactBfs(G, 0);
+	compactBfs.run();
+
+	G.forNodes([&](node u) {
+		double expected = bfs.distance(u) == std::numeric_limits<double>::max()? std::numeric_limits<double>::infinity() : bfs.distance(u);
+		EXPECT_EQ(expected, csrBfs.distance(u));
+		EXPECT_EQ(expected, dynamicBfs.distance(u));
+		EXPECT_EQ(expected, compactBfs.distance(u));
+	});
+}
+
 TEST(AlgebraicBFSGTest, benchmarkBFS) {
 	METISGraphReader reader;
 	Graph G = reader.read("input/caidaRouterLevel.graph");
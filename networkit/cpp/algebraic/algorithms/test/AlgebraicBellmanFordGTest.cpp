@@ -54,6 +54,24 @@ TEST_F(AlgebraicBellmanFordGTest, testOnToyGraph) {
 	EXPECT_FALSE(bf.hasNegativeCycle());
 }
 
+TEST_F(AlgebraicBellmanFordGTest, testNegativeCycle) {
+	Graph G(4, true, true);
+	G.addEdge(0, 1, 1);
+	G.addEdge(1, 2, 1);
+	G.addEdge(2, 1, -3);
+	G.addEdge(2, 3, 1);
+
+	AlgebraicBellmanFord<CSRMatrix> bf(G, 0);
+	bf.run();
+	EXPECT_TRUE(bf.hasNegativeCycle());
+
+	G.setWeight(2, 1, -1);
+	AlgebraicBellmanFord<DynamicMatrix> bf2(G, 0);
+	bf2.run();
+	EXPECT_FALSE(bf2.hasNegativeCycle());
+	EXPECT_EQ(3, bf2.distance(3));
+}
+
 TEST_F(AlgebraicBellmanFordGTest, benchmark) {
 	METISGraphReader reader;
 	Graph graph = reader.read("input/PGPgiantcompo.graph");
@@ -10,6 +10,8 @@
 
 #include "../GraphBLAS.h"
 #include "../CSRMatrix.h"
+#include "../SparseVector.h"
+#include "../../auxiliary/Random.h"
 
 namespace NetworKit {
 
@@ -430,4 +432,130 @@ TEST_F(GraphBLASGTest, columnReductionTest) {
 	EXPECT_EQ(-1, columnReduction[3]);
 }
 
+TEST_F(GraphBLASGTest, testMxMRandomMatrices) {
+	Aux::Random::setSeed(42, false);
+	const count n = 300, m = 200, l = 250;
+
+	auto randomTriplets = [](count rows, count cols, double density) {
+		std::vector<Triplet> triplets;
+		for (index i = 0; i < rows; ++i) {
+			for (index j = 0; j < cols; ++j) {
+				if (Aux::Random::probability() < density) {
+					triplets.push_back({i, j, (double) Aux::Random::integer(1, 10)});
+				}
+			}
+		}
+		return triplets;
+	};
+	std::vector<Triplet> tripletsA = randomTriplets(n, m, 0.02);
+	std::vector<Triplet> tripletsB = randomTriplets(m, l, 0.02);
+
+	std::vector<std::vector<double>> denseA(n, std::vector<double>(m, 0.0));
+	std::vector<std::vector<double>> denseB(m, std::vector<double>(l, 0.0));
+	for (const Triplet& t : tripletsA) denseA[t.row][t.column] = t.value;
+	for (const Triplet& t : tripletsB) denseB[t.row][t.column] = t.value;
+
+	// arithmetic semiring
+	CSRMatrix A(n, m, tripletsA);
+	CSRMatrix B(m, l, tripletsB);
+	CSRMatrix result = GraphBLAS::MxM(A, B);
+	ASSERT_EQ(n, result.numberOfRows());
+	ASSERT_EQ(l, result.numberOfColumns());
+	EXPECT_TRUE(result.sorted());
+	for (index i = 0; i < n; ++i) {
+		for (index j = 0; j < l; ++j) {
+			double expected = 0.0;
+			for (index k = 0; k < m; ++k) {
+				expected += denseA[i][k] * denseB[k][j];
+			}
+			EXPECT_EQ(expected, result(i,j));
+		}
+
+		index last = 0;
+		bool first = true;
+		result.forNonZeroElementsInRow(i, [&](index j, double) {
+			if (!first) {
+				EXPECT_LT(last, j);
+			}
+			last = j;
+			first = false;
+		});
+	}
+	EXPECT_EQ(result, A * B);
+
+	// min-plus semiring
+	A = CSRMatrix(n, m, tripletsA, MinPlusSemiring::zero());
+	B = CSRMatrix(m, l, tripletsB, MinPlusSemiring::zero());
+	result = GraphBLAS::MxM<MinPlusSemiring>(A, B);
+	for (index i = 0; i < n; ++i) {
+		for (index j = 0; j < l; ++j) {
+			double expected = MinPlusSemiring::zero();
+			for (index k = 0; k < m; ++k) {
+				if (denseA[i][k] != 0.0 && denseB[k][j] != 0.0) {
+					expected = std::min(expected, denseA[i][k] + denseB[k][j]);
+				}
+			}
+			EXPECT_EQ(expected, result(i,j));
+		}
+	}
+}
+
+TEST_F(GraphBLASGTest, testMxSpV) {
+	Aux::Random::setSeed(42, false);
+	const count n = 500;
+
+	std::vector<Triplet> triplets;
+	for (index i = 0; i < n; ++i) {
+		for (index j = 0; j < n; ++j) {
+			if (Aux::Random::probability() < 0.01) {
+				triplets.push_back({i, j, (double) Aux::Random::integer(1, 10)});
+			}
+		}
+	}
+	CSRMatrix A(n, n, triplets, MinPlusSemiring::zero());
+	CSRMatrix At = A.transpose();
+
+	std::vector<bool> mask(n);
+	for (index i = 0; i < n; ++i) {
+		mask[i] = Aux::Random::probability() < 0.5;
+	}
+
+	for (count vnnz : {5, 100, 400}) {
+		SparseVector v(n, MinPlusSemiring::zero());
+		for (index j = 0; j < n; j += n / vnnz) {
+			v.insert(j, (double) Aux::Random::integer(0, 5));
+		}
+		Vector denseV = v.toVector();
+
+		for (bool complement : {false, true}) {
+			std::vector<SparseVector> results = {
+				GraphBLAS::MxSpVPull<MinPlusSemiring>(A, v, mask, complement),
+				GraphBLAS::SpVxMPush<MinPlusSemiring>(v, At, mask, complement),
+				GraphBLAS::MxSpV<MinPlusSemiring>(A, At, v, mask, complement)
+			};
+
+			Vector expected(n, MinPlusSemiring::zero());
+			A.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+				if (mask[i] != complement) {
+					expected[i] = std::min(expected[i], value + denseV[j]);
+				}
+			});
+
+			for (const SparseVector& result : results) {
+				EXPECT_TRUE(std::is_sorted(result.getIndices().begin(), result.getIndices().end()));
+				EXPECT_EQ(expected, result.toVector());
+			}
+		}
+	}
+
+	// without mask, arithmetic semiring
+	CSRMatrix B(n, n, triplets);
+	SparseVector v(n);
+	v.insert(7, 2.0);
+	v.insert(3, 1.0);
+	Vector expected = B * v.toVector();
+	EXPECT_EQ(expected, GraphBLAS::MxSpVPull(B, v).toVector());
+	EXPECT_EQ(expected, GraphBLAS::SpVxMPush(v, B.transpose()).toVector());
+}
+
 } /* namespace NetworKit */
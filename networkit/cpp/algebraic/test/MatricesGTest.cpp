@@ -7,6 +7,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <limits>
+
 #include "../../auxiliary/Random.h"
 #include "../AlgebraicGlobals.h"
 #include "../Vector.h"
@@ -15,6 +18,8 @@
 #include "../CSRMatrix.h"
 #include "../DenseMatrix.h"
 #include "../DynamicMatrix.h"
+#include "../SellCSigmaMatrix.h"
+#include "../CompactCSRMatrix.h"
 
 namespace NetworKit {
 
@@ -76,6 +81,9 @@ public:
 	template<class Matrix>
 	void testBigMatrixMultiplication();
 
+	template<class Matrix>
+	void testTransposeMatrixMultiplication();
+
 	template<class Matrix>
 	void testAdjacencyMatrix();
 
@@ -89,8 +97,6 @@ public:
 	void testLaplacianOfGraph();
 
 	// TODO: Test other matrix classes
-
-	// TODO: Test mmT multiplication, etc.!
 };
 
 template<class Matrix>
@@ -649,6 +655,13 @@ void MatricesGTest::testMatrixSubtraction() {
 
 	EXPECT_EQ(0, result(0,1));
 	EXPECT_EQ(0, result(4,1));
+
+	// compound assignment
+	mat1 -= mat2;
+	EXPECT_EQ(1, mat1(0,0));
+	EXPECT_EQ(-1, mat1(2,0));
+	EXPECT_EQ(2, mat1(2,1));
+	EXPECT_EQ(0, mat1(4,1));
 }
 
 template<class Matrix>
@@ -879,6 +892,51 @@ void MatricesGTest::testBigMatrixMultiplication() {
 	ASSERT_EQ(mat.numberOfColumns(), result.numberOfColumns());
 }
 
+template<class Matrix>
+void MatricesGTest::testTransposeMatrixMultiplication() {
+	// 1 0 0 2
+	// 0 0 1 0
+	// 0 2 0 4
+	std::vector<Triplet> triplets = {{0,0,1}, {0,3,2}, {1,2,1}, {2,1,2}, {2,3,4}};
+	Matrix A(3, 4, triplets);
+
+	// 1 3 0 0
+	// 0 0 5 1
+	// 2 0 0 1
+	triplets = {{0,0,1}, {0,1,3}, {1,2,5}, {1,3,1}, {2,0,2}, {2,3,1}};
+	Matrix B(3, 4, triplets);
+
+	Matrix result = Matrix::mTmMultiply(A, B);
+	Matrix expected = A.transpose() * B;
+	ASSERT_EQ(4u, result.numberOfRows());
+	ASSERT_EQ(4u, result.numberOfColumns());
+	for (index i = 0; i < 4; ++i) {
+		for (index j = 0; j < 4; ++j) {
+			EXPECT_EQ(expected(i,j), result(i,j));
+		}
+	}
+	EXPECT_EQ(10, result(3,0));
+
+	result = Matrix::mmTMultiply(A, B);
+	expected = A * B.transpose();
+	ASSERT_EQ(3u, result.numberOfRows());
+	ASSERT_EQ(3u, result.numberOfColumns());
+	for (index i = 0; i < 3; ++i) {
+		for (index j = 0; j < 3; ++j) {
+			EXPECT_EQ(expected(i,j), result(i,j));
+		}
+	}
+	EXPECT_EQ(4, result(0,2));
+
+	Matrix mat = Matrix::adjacencyMatrix(graph);
+	result = Matrix::mTmMultiply(mat, mat);
+	expected = mat * mat;
+	ASSERT_EQ(expected.nnz(), result.nnz());
+	expected.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		EXPECT_EQ(value, result(i,j));
+	});
+}
+
 template<class Matrix>
 void MatricesGTest::testAdjacencyMatrix() {
 	Graph G(6);
@@ -1146,6 +1204,11 @@ TEST_F(MatricesGTest, testBigMatrixMultiplcation) {
 	testBigMatrixMultiplication<CSRMatrix>();
 }
 
+TEST_F(MatricesGTest, testTransposeMatrixMultiplication) {
+	testTransposeMatrixMultiplication<DynamicMatrix>();
+	testTransposeMatrixMultiplication<CSRMatrix>();
+}
+
 TEST_F(MatricesGTest, testAdjacencyMatrixOfGraph) {
 	testAdjacencyMatrix<DynamicMatrix>();
 	testAdjacencyMatrix<CSRMatrix>();
@@ -1166,4 +1229,338 @@ TEST_F(MatricesGTest, testLaplacianMatrixOfGraph) {
 	testLaplacianOfGraph<CSRMatrix>();
 }
 
+
+TEST_F(MatricesGTest, testDynamicMatrixBatchUpdates) {
+	DynamicMatrix A = DynamicMatrix::laplacianMatrix(graph);
+	const count n = A.numberOfRows();
+	CSRMatrix csr;
+	A.updateCSRMatrix(csr);
+	EXPECT_TRUE(A.dirtyRows().empty());
+	A.setDeltaTracking();
+	DynamicMatrix initial = A;
+
+	// changes, insertions, removals and repeated positions
+	std::vector<Triplet> triplets;
+	for (index k = 0; k < 2000; ++k) {
+		index i = Aux::Random::integer(n / 10 - 1);
+		if (k % 3 == 0 && A.nnzInRow(i) > 0) {
+			index j = 0;
+			A.forNonZeroElementsInRow(i, [&](index column, double) { j = column; });
+			triplets.push_back({i, j, k % 2 == 0? 0.0 : Aux::Random::real(1.0, 2.0)});
+		} else {
+			triplets.push_back({i, Aux::Random::integer(n - 1), Aux::Random::real(-1.0, 1.0)});
+		}
+	}
+
+	DynamicMatrix B = A;
+	for (const Triplet& triplet : triplets) {
+		B.setValue(triplet.row, triplet.column, triplet.value);
+	}
+	A.setValues(triplets);
+	EXPECT_TRUE(A == B);
+	EXPECT_EQ(A.nnz(), B.nnz());
+
+	for (index i : A.dirtyRows()) {
+		EXPECT_LT(i, n / 10);
+	}
+	EXPECT_FALSE(A.dirtyRows().empty());
+
+	// the partial update equals the full conversion
+	A.updateCSRMatrix(csr);
+	CSRMatrix expected = A.toCSRMatrix();
+	EXPECT_TRUE(A.dirtyRows().empty());
+	EXPECT_EQ(expected.nnz(), csr.nnz());
+	A.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		EXPECT_EQ(value, csr(i, j));
+	});
+
+	// the delta is the difference to the initial matrix
+	CSRMatrix delta = A.deltaMatrix();
+	for (index i = 0; i < n / 10; ++i) {
+		A.forNonZeroElementsInRow(i, [&](index j, double value) {
+			EXPECT_NEAR(value - initial(i, j), delta(i, j), 1e-12);
+		});
+		initial.forNonZeroElementsInRow(i, [&](index j, double value) {
+			EXPECT_NEAR(A(i, j) - value, delta(i, j), 1e-12);
+		});
+	}
+	A.clearDelta();
+	EXPECT_TRUE(A.getDelta().empty());
+
+	A *= 2.0;
+	EXPECT_EQ(n, A.dirtyRows().size());
+	EXPECT_EQ(A.nnz(), A.getDelta().size());
+}
+
+TEST_F(MatricesGTest, testCSRMatricesOfGraphWithoutTriplets) {
+	// weighted graphs with self-loops and a deleted node, the matrices have to match those built from triplets
+	for (bool directed : {false, true}) {
+		Graph G(8, true, directed);
+		G.addEdge(0, 1, 2.0);
+		G.addEdge(1, 2, 0.5);
+		G.addEdge(2, 2, 3.0);
+		G.addEdge(2, 4, 1.5);
+		G.addEdge(4, 0, 1.0);
+		G.addEdge(5, 6, 4.0);
+		G.addEdge(6, 5, 2.5);
+		G.addEdge(7, 7, 1.0);
+		G.removeNode(3);
+
+		std::vector<Triplet> adjacency, laplacian, normalized;
+		G.forEdges([&](node u, node v, edgeweight w) {
+			adjacency.push_back({u, v, w});
+			if (!directed && u != v) adjacency.push_back({v, u, w});
+		});
+		G.forNodes([&](node u) {
+			double degree = 0.0;
+			G.forNeighborsOf(u, [&](node v, edgeweight w) {
+				if (u != v) degree += w;
+				laplacian.push_back({u, v, -w});
+				if (u != v) normalized.push_back({u, v, -w / std::sqrt(G.weightedDegree(u) * G.weightedDegree(v))});
+			});
+			laplacian.push_back({u, u, degree});
+			if (G.weightedDegree(u) != 0.0) normalized.push_back({u, u, 1 - G.weight(u, u) / G.weightedDegree(u)});
+		});
+
+		std::vector<std::pair<CSRMatrix, CSRMatrix>> pairs = {
+			{CSRMatrix::adjacencyMatrix(G), CSRMatrix(G.upperNodeIdBound(), adjacency)},
+			{CSRMatrix::laplacianMatrix(G), CSRMatrix(G.upperNodeIdBound(), laplacian)},
+			{CSRMatrix::normalizedLaplacianMatrix(G), CSRMatrix(G.upperNodeIdBound(), normalized)}
+		};
+		for (auto &pair : pairs) {
+			CSRMatrix &direct = pair.first;
+			CSRMatrix &reference = pair.second;
+			ASSERT_EQ(reference.numberOfRows(), direct.numberOfRows());
+			ASSERT_EQ(reference.nnz(), direct.nnz());
+			direct.sort();
+			reference.sort();
+			for (index i = 0; i < reference.numberOfRows(); ++i) {
+				std::vector<std::pair<index, double>> expected, actual;
+				reference.forNonZeroElementsInRow(i, [&](index j, double value) {
+					expected.push_back({j, value});
+				});
+				direct.forNonZeroElementsInRow(i, [&](index j, double value) {
+					actual.push_back({j, value});
+				});
+				EXPECT_EQ(expected, actual);
+			}
+		}
+	}
+}
+
+TEST_F(MatricesGTest, testCompactCSRMatrix) {
+	CSRMatrix A = CSRMatrix::laplacianMatrix(graph);
+	CSRMatrix32 compact(A);
+	EXPECT_EQ(A.numberOfRows(), compact.numberOfRows());
+	EXPECT_EQ(A.numberOfColumns(), compact.numberOfColumns());
+	EXPECT_EQ(A.nnz(), compact.nnz());
+
+	Vector x(A.numberOfColumns());
+	for (index i = 0; i < x.getDimension(); ++i) {
+		x[i] = Aux::Random::real(-1.0, 1.0);
+	}
+	Vector expected = A * x;
+	Vector y = compact * x;
+	for (index i = 0; i < y.getDimension(); ++i) {
+		EXPECT_NEAR(expected[i], y[i], 1e-5 * (1.0 + std::abs(A(i,i))));
+	}
+
+	// the transpose and the conversion back keep all entries
+	CompactCSRMatrix<double, uint32_t> exact(CSRMatrix::adjacencyMatrix(graph));
+	CSRMatrix transposed = exact.transpose().toCSRMatrix();
+	CSRMatrix adjacency = CSRMatrix::adjacencyMatrix(graph);
+	adjacency.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		EXPECT_EQ(value, transposed(j, i));
+	});
+	EXPECT_EQ(adjacency.nnz(), transposed.nnz());
+
+	EXPECT_THROW((CompactCSRMatrix<float, uint8_t>(CSRMatrix(300))), std::runtime_error);
+
+	// the graph matrices built directly in the compact format equal the converted double precision matrices
+	auto expectEqual = [&](const CSRMatrix32& direct, const CSRMatrix32& converted) {
+		ASSERT_EQ(converted.numberOfRows(), direct.numberOfRows());
+		ASSERT_EQ(converted.nnz(), direct.nnz());
+		for (index i = 0; i < direct.numberOfRows(); ++i) {
+			std::vector<std::pair<index, double>> directRow, convertedRow;
+			direct.forNonZeroElementsInRow(i, [&](index j, double value) { directRow.emplace_back(j, value); });
+			converted.forNonZeroElementsInRow(i, [&](index j, double value) { convertedRow.emplace_back(j, value); });
+			EXPECT_EQ(convertedRow, directRow);
+		}
+	};
+	expectEqual(CSRMatrix32::adjacencyMatrix(graph), CSRMatrix32(CSRMatrix::adjacencyMatrix(graph)));
+	expectEqual(CSRMatrix32::laplacianMatrix(graph), CSRMatrix32(CSRMatrix::laplacianMatrix(graph)));
+	expectEqual(CSRMatrix32::normalizedLaplacianMatrix(graph), CSRMatrix32(CSRMatrix::normalizedLaplacianMatrix(graph)));
+	EXPECT_THROW((CompactCSRMatrix<float, uint8_t>::laplacianMatrix(Graph(300))), std::runtime_error);
+}
+
+TEST_F(MatricesGTest, testCSRMatrixMultiVectorProduct) {
+	CSRMatrix A = CSRMatrix::adjacencyMatrix(graph);
+	for (count k : {1, 3, 4, 8, 16, 33, 64}) {
+		std::vector<double> entries(A.numberOfColumns() * k);
+		for (double &entry : entries) {
+			entry = Aux::Random::real(-1.0, 1.0);
+		}
+		DenseMatrix X(A.numberOfColumns(), k, entries);
+
+		DenseMatrix Y = A * X;
+		ASSERT_EQ(A.numberOfRows(), Y.numberOfRows());
+		ASSERT_EQ(k, Y.numberOfColumns());
+
+		for (index j = 0; j < k; ++j) {
+			Vector x(A.numberOfColumns());
+			for (index i = 0; i < A.numberOfColumns(); ++i) {
+				x[i] = X(i, j);
+			}
+
+			Vector y = A * x;
+			for (index i = 0; i < A.numberOfRows(); ++i) {
+				EXPECT_NEAR(y[i], Y(i, j), 1e-9);
+			}
+		}
+	}
+}
+
+TEST_F(MatricesGTest, testDenseMatrixLUSolveMultipleRightHandSides) {
+	count n = 20;
+	count k = 5;
+	DenseMatrix A(n, n);
+	DenseMatrix B(n, k);
+	for (index i = 0; i < n; ++i) {
+		for (index j = 0; j < n; ++j) {
+			A.setValue(i, j, Aux::Random::real(-1.0, 1.0) + (i == j? n : 0.0));
+		}
+		for (index c = 0; c < k; ++c) {
+			B.setValue(i, c, Aux::Random::real(-1.0, 1.0));
+		}
+	}
+
+	DenseMatrix LU = A;
+	DenseMatrix::LUDecomposition(LU);
+	DenseMatrix X = DenseMatrix::LUSolve(LU, B);
+	ASSERT_EQ(n, X.numberOfRows());
+	ASSERT_EQ(k, X.numberOfColumns());
+	for (index c = 0; c < k; ++c) {
+		Vector x = DenseMatrix::LUSolve(LU, B.column(c));
+		EXPECT_NEAR(0.0, (A * x - B.column(c)).length(), 1e-10);
+		for (index i = 0; i < n; ++i) {
+			EXPECT_NEAR(x[i], X(i, c), 1e-12);
+		}
+	}
+}
+
+TEST_F(MatricesGTest, testDenseMatrixEigenDecomposition) {
+	count n = 30;
+	DenseMatrix A(n, n);
+	for (index i = 0; i < n; ++i) {
+		for (index j = i; j < n; ++j) {
+			double value = Aux::Random::real(-1.0, 1.0);
+			A.setValue(i, j, value);
+			A.setValue(j, i, value);
+		}
+	}
+
+	Vector eigenvalues;
+	DenseMatrix eigenvectors;
+	DenseMatrix::symmetricEigenDecomposition(A, eigenvalues, eigenvectors);
+	ASSERT_EQ(n, eigenvalues.getDimension());
+	for (index c = 0; c < n; ++c) {
+		if (c > 0) {
+			EXPECT_LE(eigenvalues[c-1], eigenvalues[c]);
+		}
+
+		Vector v = eigenvectors.column(c);
+		EXPECT_NEAR(1.0, v.length(), 1e-10);
+		EXPECT_NEAR(0.0, (A * v - eigenvalues[c] * v).length(), 1e-9);
+	}
+
+	// the eigenvectors are orthonormal
+	DenseMatrix VtV = DenseMatrix::mTmMultiply(eigenvectors, eigenvectors);
+	for (index i = 0; i < n; ++i) {
+		for (index j = 0; j < n; ++j) {
+			EXPECT_NEAR(i == j? 1.0 : 0.0, VtV(i, j), 1e-10);
+		}
+	}
+
+	// linearly dependent columns are dropped by the orthonormalization
+	DenseMatrix Z(n, (count) 3);
+	for (index i = 0; i < n; ++i) {
+		Z.setValue(i, 0, eigenvectors(i, 0));
+		Z.setValue(i, 1, 2.0 * eigenvectors(i, 0));
+		Z.setValue(i, 2, eigenvectors(i, 0) + eigenvectors(i, 1));
+	}
+	DenseMatrix Q = DenseMatrix::orthonormalizeColumns(Z);
+	ASSERT_EQ(2u, Q.numberOfColumns());
+	EXPECT_NEAR(1.0, Q.column(1).length(), 1e-10);
+	EXPECT_NEAR(0.0, Vector::innerProduct(Q.column(0), Q.column(1)), 1e-10);
+}
+
+TEST_F(MatricesGTest, testSellCSigmaMatrixVectorProduct) {
+	// rectangular matrix with strongly varying row lengths
+	count nRows = 500, nCols = 300;
+	std::vector<Triplet> triplets;
+	for (index i = 0; i < nRows; ++i) {
+		double p = (i % 7 == 0)? 0.3 : ((i % 3 == 0)? 0.0 : 0.02);
+		for (index j = 0; j < nCols; ++j) {
+			if (Aux::Random::probability() < p) {
+				triplets.push_back({i, j, Aux::Random::real(-1.0, 1.0)});
+			}
+		}
+	}
+
+	std::vector<CSRMatrix> matrices = {CSRMatrix::adjacencyMatrix(graph), CSRMatrix(nRows, nCols, triplets)};
+	for (const CSRMatrix &A : matrices) {
+		Vector x(A.numberOfColumns());
+		for (index i = 0; i < x.getDimension(); ++i) {
+			x[i] = Aux::Random::real(-1.0, 1.0);
+		}
+		Vector expected = A * x;
+
+		for (count chunkHeight : {1, 4, 8, 32}) {
+			for (count sigma : {1, 64, 1024}) {
+				SellCSigmaMatrix S(A, chunkHeight, sigma);
+				EXPECT_EQ(A.numberOfRows(), S.numberOfRows());
+				EXPECT_EQ(A.numberOfColumns(), S.numberOfColumns());
+				EXPECT_EQ(A.nnz(), S.nnz());
+				EXPECT_GE(S.storedEntries(), S.nnz());
+				if (chunkHeight == 1) {
+					EXPECT_EQ(S.nnz(), S.storedEntries());
+				}
+
+				Vector y = S * x;
+				ASSERT_EQ(expected.getDimension(), y.getDimension());
+				for (index i = 0; i < y.getDimension(); ++i) {
+					EXPECT_NEAR(expected[i], y[i], 1e-9);
+				}
+
+				for (index i = 0; i < A.numberOfRows(); ++i) {
+					count nnz = 0;
+					S.forNonZeroElementsInRow(i, [&](index j, double value) {
+						EXPECT_EQ(A(i, j), value);
+						++nnz;
+					});
+					EXPECT_EQ(A.nnzInRow(i), nnz);
+				}
+			}
+		}
+
+		// sorting the rows by length reduces the padding
+		EXPECT_LE(SellCSigmaMatrix(A, 8, 1024).storedEntries(), SellCSigmaMatrix(A, 8, 1).storedEntries());
+
+		// the padding refers to column 0, an infinite entry there must only affect the rows with a non-zero in it
+		x[0] = std::numeric_limits<double>::infinity();
+		expected = A * x;
+		Vector y = SellCSigmaMatrix(A, 8, 1) * x;
+		for (index i = 0; i < y.getDimension(); ++i) {
+			if (std::isfinite(expected[i])) {
+				EXPECT_NEAR(expected[i], y[i], 1e-9);
+			} else {
+				EXPECT_TRUE(std::isnan(expected[i])? std::isnan(y[i]) : expected[i] == y[i]);
+			}
+		}
+	}
+
+	EXPECT_THROW(SellCSigmaMatrix(matrices[1], 0), std::runtime_error);
+	EXPECT_THROW(SellCSigmaMatrix(matrices[1], SellCSigmaMatrix::MAX_CHUNK_HEIGHT + 1), std::runtime_error);
+}
+
 } /* namespace NetworKit */
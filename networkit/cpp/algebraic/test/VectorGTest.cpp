@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "../Vector.h"
+#include "../SparseVector.h"
 #include "../DynamicMatrix.h"
 #include "../AlgebraicGlobals.h"
 #include "../../auxiliary/Log.h"
@@ -250,4 +251,57 @@ TEST(VectorGTest, testMean) {
 }
 
 
+TEST(VectorGTest, testFusedKernels) {
+	Vector x = {1.0, -2.0, 3.0, 0.5};
+	Vector y = {2.0, 1.0, -1.0, 4.0};
+
+	Vector z = y;
+	z.axpy(2.0, x);
+	EXPECT_EQ(y + 2.0 * x, z);
+
+	z = y;
+	z.axpby(3.0, x, -0.5);
+	EXPECT_EQ(3.0 * x - 0.5 * y, z);
+
+	z = y;
+	double squaredLength = z.axpyAndSquaredLength(-1.0, x);
+	EXPECT_EQ(y - x, z);
+	EXPECT_DOUBLE_EQ(Vector::innerProduct(y - x, y - x), squaredLength);
+
+	std::pair<double, double> products = Vector::innerProducts(x, x, y);
+	EXPECT_DOUBLE_EQ(x.length() * x.length(), products.first);
+	EXPECT_DOUBLE_EQ(Vector::innerProduct(x, y), products.second);
+}
+
+TEST(VectorGTest, testSparseVector) {
+	SparseVector v(10);
+	EXPECT_EQ(10u, v.getDimension());
+	EXPECT_EQ(0u, v.nnz());
+
+	v.insert(7, 2.0);
+	v.insert(2, -1.0);
+	v.insert(5, 3.0);
+	EXPECT_EQ(3u, v.nnz());
+
+	v.sort();
+	std::vector<index> expectedIndices = {2, 5, 7};
+	std::vector<double> expectedValues = {-1.0, 3.0, 2.0};
+	EXPECT_EQ(expectedIndices, v.getIndices());
+	EXPECT_EQ(expectedValues, v.getValues());
+
+	Vector dense = v.toVector();
+	EXPECT_EQ(10u, dense.getDimension());
+	EXPECT_EQ(-1.0, dense[2]);
+	EXPECT_EQ(0.0, dense[3]);
+	EXPECT_EQ(2.0, dense[7]);
+
+	SparseVector w(dense);
+	EXPECT_EQ(expectedIndices, w.getIndices());
+	EXPECT_EQ(expectedValues, w.getValues());
+
+	w.clear();
+	EXPECT_EQ(0u, w.nnz());
+	EXPECT_EQ(10u, w.getDimension());
+}
+
 } /* namespace NetworKit */
@@ -70,6 +70,14 @@ std::mt19937_64& getURNG() {
 	return generator;
 }
 
+uint64_t streamSeed(uint64_t seed, uint64_t stream) {
+	// splitmix64 finalizer; decorrelates the seeds of neighbouring streams
+	uint64_t z = seed + (stream + 1) * 0x9E3779B97F4A7C15ULL;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
 uint64_t integer() {
 	thread_local static std::uniform_int_distribution<uint64_t> dist{};
 	return dist(getURNG());
@@ -46,6 +46,14 @@ bool getUseThreadId();
  */
 std::mt19937_64& getURNG();
 
+/**
+ * @returns the seed of the @a stream-th random stream derived from @a seed.
+ * Parallel algorithms that assign one stream to each fixed work package
+ * (rather than to each thread) produce results that do not depend on the
+ * number of threads.
+ */
+uint64_t streamSeed(uint64_t seed, uint64_t stream);
+
 
 /**
  * @returns an integer distributed uniformly in an inclusive range;
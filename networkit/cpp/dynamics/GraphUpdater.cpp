@@ -14,7 +14,24 @@ GraphUpdater::GraphUpdater(Graph& G) : G(G) {
 }
 
 void GraphUpdater::update(const std::vector<GraphEvent>& stream) {
-	for (GraphEvent ev : stream) {
+	// Consecutive edge events of the same type are applied as one parallel batch, which gives the same graph as
+	// applying them one by one.
+	index first = 0;
+	while (first < stream.size()) {
+		const GraphEvent::Type type = stream[first].type;
+		index last = first + 1;
+		if (type == GraphEvent::EDGE_ADDITION || type == GraphEvent::EDGE_REMOVAL || type == GraphEvent::EDGE_WEIGHT_UPDATE || type == GraphEvent::EDGE_WEIGHT_INCREMENT) {
+			while (last < stream.size() && stream[last].type == type) {
+				++last;
+			}
+		}
+		if (last - first > 1) {
+			updateBatch(stream, first, last);
+			first = last;
+			continue;
+		}
+
+		const GraphEvent& ev = stream[first++];
 		TRACE("event: " , ev.toString());
 		switch (ev.type) {
 			case GraphEvent::NODE_ADDITION : {
@@ -58,6 +75,43 @@ void GraphUpdater::update(const std::vector<GraphEvent>& stream) {
 	size.push_back(std::make_pair(G.numberOfNodes(), G.numberOfEdges()));
 }
 
+void GraphUpdater::updateBatch(const std::vector<GraphEvent>& stream, index first, index last) {
+	TRACE("batch of ", last - first, " events: ", stream[first].toString(), ", ...");
+	if (stream[first].type == GraphEvent::EDGE_REMOVAL) {
+		std::vector<std::pair<node, node>> edges(last - first);
+#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(last - first); ++i) {
+			edges[i] = std::make_pair(stream[first + i].u, stream[first + i].v);
+		}
+		G.removeEdges(edges);
+		return;
+	}
+
+	std::vector<WeightedEdge> edges;
+	edges.reserve(last - first);
+	for (index i = first; i < last; ++i) {
+		edges.emplace_back(stream[i].u, stream[i].v, stream[i].w);
+	}
+
+	switch (stream[first].type) {
+		case GraphEvent::EDGE_ADDITION : {
+			G.addEdges(edges);
+			break;
+		}
+		case GraphEvent::EDGE_WEIGHT_UPDATE : {
+			G.setWeights(edges);
+			break;
+		}
+		case GraphEvent::EDGE_WEIGHT_INCREMENT : {
+			G.increaseWeights(edges);
+			break;
+		}
+		default: {
+			throw std::runtime_error("event type cannot be applied as batch");
+		}
+	}
+}
+
 std::vector<std::pair<count, count> > GraphUpdater::getSizeTimeline() {
 	return size;
 }
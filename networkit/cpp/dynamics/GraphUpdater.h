@@ -31,6 +31,11 @@ public:
 
 private:
 
+	/**
+	 * Applies the edge events stream[first, last) of the same type with the batch methods of Graph.
+	 */
+	void updateBatch(const std::vector<GraphEvent>& stream, index first, index last);
+
 	Graph& G;
 	std::vector<std::pair<count, count> > size;
 };
@@ -0,0 +1,116 @@
+/*
+ * SlidingWindowGraph.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "SlidingWindowGraph.h"
+
+#include <limits>
+
+namespace NetworKit {
+
+SlidingWindowGraph::SlidingWindowGraph(Graph& G, double windowLength) : G(G), windowLength(windowLength), currentTime(-std::numeric_limits<double>::infinity()) {
+	if (!(windowLength > 0.0)) {
+		throw std::runtime_error("The window length has to be positive");
+	}
+}
+
+void SlidingWindowGraph::attach(DynAlgorithm& algorithm) {
+	attach([&algorithm](const std::vector<GraphEvent>& batch) { algorithm.updateBatch(batch); });
+}
+
+void SlidingWindowGraph::attach(std::function<void(const std::vector<GraphEvent>&)> callback) {
+	onInsertion.push_back(callback);
+	onExpiry.push_back(callback);
+}
+
+void SlidingWindowGraph::addEdge(node u, node v, double time, edgeweight weight) {
+	addEdges(std::vector<TimedEdge>(1, TimedEdge(u, v, time, weight)));
+}
+
+void SlidingWindowGraph::addEdges(const std::vector<TimedEdge>& batch) {
+	if (batch.empty()) return;
+	for (index i = 0; i < batch.size(); ++i) {
+		if (batch[i].time < (i > 0 ? batch[i - 1].time : currentTime)) {
+			throw std::runtime_error("The timestamps of the interactions have to be non-decreasing");
+		}
+		assert(G.hasNode(batch[i].u) && G.hasNode(batch[i].v));
+	}
+
+	// expire first, so that the new edges cannot collide with expired ones
+	advanceTo(batch.back().time);
+
+	const double cutoff = currentTime - windowLength;
+	std::vector<WeightedEdge> insertions;
+	for (const TimedEdge& e : batch) {
+		if (e.time <= cutoff) continue;
+
+		auto it = latest.find(key(e.u, e.v));
+		if (it == latest.end()) {
+			if (G.hasEdge(e.u, e.v)) continue; // static edge
+			latest.emplace(key(e.u, e.v), e.time);
+			insertions.emplace_back(e.u, e.v, e.weight);
+		} else if (it->second != e.time) {
+			it->second = e.time;
+		} else {
+			continue; // repetition of the latest interaction
+		}
+		interactions.push_back(e);
+	}
+	if (insertions.empty()) return;
+
+	G.addEdges(insertions);
+	std::vector<GraphEvent> events;
+	events.reserve(insertions.size());
+	for (const WeightedEdge& e : insertions) {
+		events.emplace_back(GraphEvent::EDGE_ADDITION, e.u, e.v, e.weight);
+	}
+	for (auto& callback : onInsertion) {
+		callback(events);
+	}
+}
+
+void SlidingWindowGraph::advanceTo(double time) {
+	if (time < currentTime) {
+		throw std::runtime_error("The time of a sliding window cannot go back");
+	}
+	currentTime = time;
+
+	const double cutoff = currentTime - windowLength;
+	std::vector<std::pair<node, node>> expired;
+	while (!interactions.empty() && interactions.front().time <= cutoff) {
+		const TimedEdge& e = interactions.front();
+		if (isLatest(e)) {
+			expired.emplace_back(e.u, e.v);
+			latest.erase(key(e.u, e.v));
+		}
+		interactions.pop_front();
+	}
+	if (expired.empty()) return;
+
+	G.removeEdges(expired);
+	std::vector<GraphEvent> events;
+	events.reserve(expired.size());
+	for (const std::pair<node, node>& e : expired) {
+		events.emplace_back(GraphEvent::EDGE_REMOVAL, e.first, e.second);
+	}
+	for (auto& callback : onExpiry) {
+		callback(events);
+	}
+}
+
+double SlidingWindowGraph::timestamp(node u, node v) const {
+	auto it = latest.find(key(u, v));
+	return it == latest.end() ? -std::numeric_limits<double>::infinity() : it->second;
+}
+
+std::vector<std::pair<node, node>> SlidingWindowGraph::edgesInWindow(double begin, double end) const {
+	std::vector<std::pair<node, node>> edges;
+	forEdgesInWindow(begin, end, [&](node u, node v, double) {
+		edges.emplace_back(u, v);
+	});
+	return edges;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,169 @@
+/*
+ * SlidingWindowGraph.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef SLIDINGWINDOWGRAPH_H_
+#define SLIDINGWINDOWGRAPH_H_
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "../graph/Graph.h"
+#include "../base/DynAlgorithm.h"
+#include "GraphEvent.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup dynamics
+ * Maintains the edges of the interactions within a sliding time window in a Graph. Each interaction (u, v) carries
+ * a timestamp; the edge (u, v) is in the graph as long as its latest interaction is in the window (now - length, now].
+ * Repeated interactions refresh the timestamp of the edge, its weight stays the weight of the first interaction.
+ *
+ * The timestamps of the interactions have to be non-decreasing. A new timestamp advances the current time, and all
+ * edges that fall out of the window are removed as one batch with Graph::removeEdges. New edges are inserted as one
+ * batch with Graph::addEdges. Dynamic algorithms on the graph are notified of both batches with updateBatch(); the
+ * algorithms have to be run before they are attached.
+ *
+ * The interactions are kept in a queue in timestamp order, so that expiry takes time proportional to the number of
+ * expired interactions and window queries are answered by binary search.
+ */
+class SlidingWindowGraph {
+public:
+	/** Interaction between two nodes at a point in time. */
+	struct TimedEdge {
+		node u;
+		node v;
+		double time;
+		edgeweight weight;
+
+		TimedEdge(node u, node v, double time, edgeweight weight = defaultEdgeWeight) : u(u), v(v), time(time), weight(weight) {}
+	};
+
+	/**
+	 * Maintains the edges within a window of @a windowLength in @a G. The edges that @a G already contains are static,
+	 * they never expire and interactions on them are ignored.
+	 * @param G
+	 * @param windowLength
+	 */
+	SlidingWindowGraph(Graph& G, double windowLength);
+
+	/**
+	 * Notifies @a algorithm of all edge insertions and expiries with updateBatch().
+	 */
+	void attach(DynAlgorithm& algorithm);
+
+	/**
+	 * Notifies @a algorithm of edge insertions with updateBatch() and runs it again after expiries. This is meant for
+	 * dynamic algorithms that support only edge insertions, like DynBFS or DynBetweenness.
+	 */
+	template<class DynAlgo> void attachRecomputing(DynAlgo& algorithm);
+
+	/**
+	 * Calls @a callback with the batches of edge insertions and expiries after the graph has been updated.
+	 */
+	void attach(std::function<void(const std::vector<GraphEvent>&)> callback);
+
+	/**
+	 * Records the interaction (@a u, @a v) at @a time.
+	 */
+	void addEdge(node u, node v, double time, edgeweight weight = defaultEdgeWeight);
+
+	/**
+	 * Records the @a interactions, which have to be sorted by time. Edges that would expire within the batch are not
+	 * inserted at all.
+	 */
+	void addEdges(const std::vector<TimedEdge>& interactions);
+
+	/**
+	 * Advances the current time to @a time and removes the expired edges.
+	 */
+	void advanceTo(double time);
+
+	/**
+	 * @return The current time, i.e. the latest timestamp.
+	 */
+	double now() const {
+		return currentTime;
+	}
+
+	double getWindowLength() const {
+		return windowLength;
+	}
+
+	/**
+	 * @return Number of edges in the window.
+	 */
+	count numberOfEdges() const {
+		return latest.size();
+	}
+
+	/**
+	 * @return Timestamp of the latest interaction (@a u, @a v) in the window or -infinity if there is none.
+	 */
+	double timestamp(node u, node v) const;
+
+	/**
+	 * Iterate over the edges whose latest interaction is in [@a begin, @a end] in timestamp order and call
+	 * @a handle(node u, node v, double time).
+	 */
+	template<typename L> void forEdgesInWindow(double begin, double end, L handle) const;
+
+	/**
+	 * @return The edges whose latest interaction is in [@a begin, @a end] in timestamp order.
+	 */
+	std::vector<std::pair<node, node>> edgesInWindow(double begin, double end) const;
+
+private:
+	struct EdgeHash {
+		size_t operator()(const std::pair<node, node>& e) const {
+			return std::hash<node>()(e.first) ^ (std::hash<node>()(e.second) * 0x9E3779B97F4A7C15ull);
+		}
+	};
+
+	Graph& G;
+	double windowLength;
+	double currentTime;
+	std::deque<TimedEdge> interactions; //!< in timestamp order, including refreshed ones but no repetitions
+	std::unordered_map<std::pair<node, node>, double, EdgeHash> latest; //!< latest timestamp of the edges
+	std::vector<std::function<void(const std::vector<GraphEvent>&)>> onInsertion;
+	std::vector<std::function<void(const std::vector<GraphEvent>&)>> onExpiry;
+
+	std::pair<node, node> key(node u, node v) const {
+		return G.isDirected() || u >= v ? std::make_pair(u, v) : std::make_pair(v, u);
+	}
+
+	/** Returns true if @a e is the latest interaction of its edge. */
+	bool isLatest(const TimedEdge& e) const {
+		auto it = latest.find(key(e.u, e.v));
+		return it != latest.end() && it->second == e.time;
+	}
+};
+
+template<class DynAlgo>
+void SlidingWindowGraph::attachRecomputing(DynAlgo& algorithm) {
+	onInsertion.push_back([&algorithm](const std::vector<GraphEvent>& batch) { algorithm.updateBatch(batch); });
+	onExpiry.push_back([&algorithm](const std::vector<GraphEvent>&) { algorithm.run(); });
+}
+
+template<typename L>
+void SlidingWindowGraph::forEdgesInWindow(double begin, double end, L handle) const {
+	auto it = std::lower_bound(interactions.begin(), interactions.end(), begin, [](const TimedEdge& e, double time) {
+		return e.time < time;
+	});
+	for (; it != interactions.end() && it->time <= end; ++it) {
+		// interactions that have been refreshed by a later one are skipped
+		if (isLatest(*it)) {
+			handle(it->u, it->v, it->time);
+		}
+	}
+}
+
+} /* namespace NetworKit */
+
+#endif /* SLIDINGWINDOWGRAPH_H_ */
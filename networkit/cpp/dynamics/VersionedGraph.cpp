@@ -0,0 +1,291 @@
+/*
+ * VersionedGraph.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "VersionedGraph.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace NetworKit {
+
+const count VersionedGraph::CHUNK_SIZE;
+
+VersionedGraph::VersionedGraph(count n, bool weighted, bool directed) : currentVersion(0) {
+	current.n = n;
+	current.m = 0;
+	current.z = n;
+	current.weighted = weighted;
+	current.directed = directed;
+	current.chunks.resize((n + CHUNK_SIZE - 1) / CHUNK_SIZE);
+	for (index c = 0; c < current.chunks.size(); ++c) {
+		current.chunks[c] = std::make_shared<Chunk>();
+		for (node u = c * CHUNK_SIZE; u < std::min((c + 1) * CHUNK_SIZE, n); ++u) {
+			current.chunks[c]->exists[u % CHUNK_SIZE] = true;
+		}
+	}
+}
+
+VersionedGraph::VersionedGraph(const Graph& G) : VersionedGraph(G.upperNodeIdBound(), G.isWeighted(), G.isDirected()) {
+	for (node u = 0; u < G.upperNodeIdBound(); ++u) {
+		if (!G.hasNode(u)) {
+			current.chunks[u / CHUNK_SIZE]->exists[u % CHUNK_SIZE] = false;
+			--current.n;
+		}
+	}
+
+	// the adjacencies are filled per node, which preserves the neighbor order of G; the chunks are not shared yet
+	G.parallelForNodes([&](node u) {
+		if (G.degree(u) == 0 && (!G.isDirected() || G.degreeIn(u) == 0)) return;
+		std::shared_ptr<Adjacency> a = std::make_shared<Adjacency>();
+		G.forNeighborsOf(u, [&](node, node v, edgeweight w) {
+			a->outEdges.push_back(v);
+			if (G.isWeighted()) a->outEdgeWeights.push_back(w);
+		});
+		if (G.isDirected()) {
+			G.forInNeighborsOf(u, [&](node, node v, edgeweight w) {
+				a->inEdges.push_back(v);
+				if (G.isWeighted()) a->inEdgeWeights.push_back(w);
+			});
+		}
+		current.chunks[u / CHUNK_SIZE]->adjacency[u % CHUNK_SIZE] = std::move(a);
+	});
+	current.m = G.numberOfEdges();
+}
+
+node VersionedGraph::addNode() {
+	const node u = current.z;
+	if (u % CHUNK_SIZE == 0) {
+		current.chunks.push_back(std::make_shared<Chunk>());
+	}
+	mutableChunk(u).exists[u % CHUNK_SIZE] = true;
+	++current.z;
+	++current.n;
+	return u;
+}
+
+void VersionedGraph::removeNode(node u) {
+	assert(u < current.z && current.exists(u));
+	if (current.adjacency(u)) {
+		// remove all incident edges, i.e. their entries in the adjacencies of the neighbors
+		const Adjacency& a = *current.adjacency(u);
+		std::vector<node> outNeighbors = a.outEdges;
+		std::vector<node> inNeighbors = a.inEdges;
+		for (node v : outNeighbors) {
+			if (current.adjacency(u) && find(current.adjacency(u)->outEdges, v) != none) {
+				removeEdge(u, v);
+			}
+		}
+		for (node v : inNeighbors) {
+			if (current.adjacency(v) && find(current.adjacency(v)->outEdges, u) != none) {
+				removeEdge(v, u);
+			}
+		}
+	}
+
+	mutableChunk(u).exists[u % CHUNK_SIZE] = false;
+	--current.n;
+}
+
+void VersionedGraph::restoreNode(node u) {
+	assert(u < current.z && !current.exists(u));
+	mutableChunk(u).exists[u % CHUNK_SIZE] = true;
+	++current.n;
+}
+
+void VersionedGraph::addEdge(node u, node v, edgeweight w) {
+	assert(u < current.z && current.exists(u));
+	assert(v < current.z && current.exists(v));
+
+	Adjacency& au = mutableAdjacency(u);
+	au.outEdges.push_back(v);
+	if (current.weighted) au.outEdgeWeights.push_back(w);
+	if (current.directed) {
+		Adjacency& av = mutableAdjacency(v);
+		av.inEdges.push_back(u);
+		if (current.weighted) av.inEdgeWeights.push_back(w);
+	} else if (u != v) {
+		Adjacency& av = mutableAdjacency(v);
+		av.outEdges.push_back(u);
+		if (current.weighted) av.outEdgeWeights.push_back(w);
+	}
+	++current.m;
+}
+
+void VersionedGraph::removeEdge(node u, node v) {
+	const Adjacency* a = current.adjacency(u).get();
+	if (!a || find(a->outEdges, v) == none) {
+		std::stringstream strm;
+		strm << "edge (" << u << "," << v << ") does not exist";
+		throw std::runtime_error(strm.str());
+	}
+
+	Adjacency& au = mutableAdjacency(u);
+	erase(au.outEdges, au.outEdgeWeights, find(au.outEdges, v));
+	if (current.directed) {
+		Adjacency& av = mutableAdjacency(v);
+		erase(av.inEdges, av.inEdgeWeights, find(av.inEdges, u));
+	} else if (u != v) {
+		Adjacency& av = mutableAdjacency(v);
+		erase(av.outEdges, av.outEdgeWeights, find(av.outEdges, u));
+	}
+	--current.m;
+}
+
+template<typename F>
+void VersionedGraph::updateWeight(node u, node v, edgeweight w, F change) {
+	if (!current.weighted) {
+		throw std::runtime_error("Cannot set edge weight in unweighted graph.");
+	}
+
+	const Adjacency* a = current.adjacency(u).get();
+	if (!a || find(a->outEdges, v) == none) {
+		addEdge(u, v, w);
+		return;
+	}
+
+	Adjacency& au = mutableAdjacency(u);
+	change(au.outEdgeWeights[find(au.outEdges, v)]);
+	if (current.directed) {
+		Adjacency& av = mutableAdjacency(v);
+		change(av.inEdgeWeights[find(av.inEdges, u)]);
+	} else if (u != v) {
+		Adjacency& av = mutableAdjacency(v);
+		change(av.outEdgeWeights[find(av.outEdges, u)]);
+	}
+}
+
+void VersionedGraph::setWeight(node u, node v, edgeweight w) {
+	updateWeight(u, v, w, [&](edgeweight& x) { x = w; });
+}
+
+void VersionedGraph::increaseWeight(node u, node v, edgeweight w) {
+	updateWeight(u, v, w, [&](edgeweight& x) { x += w; });
+}
+
+void VersionedGraph::timeStep() {
+	history.push_back(snapshot());
+	++currentVersion;
+}
+
+void VersionedGraph::update(const std::vector<GraphEvent>& stream) {
+	for (const GraphEvent& ev : stream) {
+		switch (ev.type) {
+			case GraphEvent::NODE_ADDITION : {
+				addNode();
+				break;
+			}
+			case GraphEvent::NODE_REMOVAL : {
+				removeNode(ev.u);
+				break;
+			}
+			case GraphEvent::NODE_RESTORATION : {
+				restoreNode(ev.u);
+				break;
+			}
+			case GraphEvent::EDGE_ADDITION : {
+				addEdge(ev.u, ev.v, ev.w);
+				break;
+			}
+			case GraphEvent::EDGE_REMOVAL : {
+				removeEdge(ev.u, ev.v);
+				break;
+			}
+			case GraphEvent::EDGE_WEIGHT_UPDATE : {
+				setWeight(ev.u, ev.v, ev.w);
+				break;
+			}
+			case GraphEvent::EDGE_WEIGHT_INCREMENT : {
+				increaseWeight(ev.u, ev.v, ev.w);
+				break;
+			}
+			case GraphEvent::TIME_STEP : {
+				timeStep();
+				break;
+			}
+			default: {
+				throw std::runtime_error("unknown event type");
+			}
+		}
+	}
+}
+
+VersionedGraph::Snapshot VersionedGraph::snapshot() {
+	if (!frozen) {
+		// copies only the pointers to the chunks, which are shared from now on
+		frozen = std::make_shared<const State>(current);
+	}
+	return Snapshot(frozen, currentVersion);
+}
+
+VersionedGraph::Snapshot VersionedGraph::snapshot(index version) const {
+	if (!hasVersion(version)) {
+		throw std::runtime_error("version is not retained");
+	}
+	return history[version - history.front().version()];
+}
+
+bool VersionedGraph::hasVersion(index version) const {
+	return !history.empty() && version >= history.front().version() && version <= history.back().version();
+}
+
+void VersionedGraph::discardVersionsBefore(index version) {
+	while (!history.empty() && history.front().version() < version) {
+		history.pop_front();
+	}
+}
+
+VersionedGraph::Chunk& VersionedGraph::mutableChunk(node u) {
+	frozen.reset();
+	std::shared_ptr<Chunk>& c = current.chunks[u / CHUNK_SIZE];
+	if (c.use_count() > 1) {
+		// shared with a snapshot, the copy shares the adjacencies in turn
+		c = std::make_shared<Chunk>(*c);
+	}
+	return *c;
+}
+
+VersionedGraph::Adjacency& VersionedGraph::mutableAdjacency(node u) {
+	std::shared_ptr<Adjacency>& a = mutableChunk(u).adjacency[u % CHUNK_SIZE];
+	if (!a) {
+		a = std::make_shared<Adjacency>();
+	} else if (a.use_count() > 1) {
+		// shared with a snapshot
+		a = std::make_shared<Adjacency>(*a);
+	}
+	return *a;
+}
+
+index VersionedGraph::find(const std::vector<node>& edges, node v) {
+	auto it = std::find(edges.begin(), edges.end(), v);
+	return it == edges.end() ? none : static_cast<index>(it - edges.begin());
+}
+
+void VersionedGraph::erase(std::vector<node>& edges, std::vector<edgeweight>& weights, index i) {
+	// the order is kept, so that multi-edges are removed and updated in the same order as in Graph
+	edges.erase(edges.begin() + i);
+	if (!weights.empty()) {
+		weights.erase(weights.begin() + i);
+	}
+}
+
+Graph VersionedGraph::Snapshot::toGraph() const {
+	Graph G(upperNodeIdBound(), isWeighted(), isDirected());
+	std::vector<WeightedEdge> edges;
+	edges.reserve(numberOfEdges());
+	forEdges([&](node u, node v, edgeweight w) {
+		edges.emplace_back(u, v, w);
+	});
+	G.addEdges(edges);
+	for (node u = 0; u < upperNodeIdBound(); ++u) {
+		if (!hasNode(u)) {
+			G.removeNode(u);
+		}
+	}
+
+	return G;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,332 @@
+/*
+ * VersionedGraph.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef VERSIONEDGRAPH_H_
+#define VERSIONEDGRAPH_H_
+
+#include <array>
+#include <bitset>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "../graph/Graph.h"
+#include "GraphEvent.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup dynamics
+ * Graph that keeps read-only snapshots of its past versions. The adjacencies of the nodes are stored in separate
+ * blocks that are shared between the versions; a block is only copied when a node changes after a snapshot has
+ * been taken (copy-on-write). The pointers to the blocks and the node flags are grouped into chunks of CHUNK_SIZE
+ * consecutive nodes, which are shared the same way. Thus, a version costs a pointer per chunk plus a copy of each
+ * chunk and adjacency that changed in it, instead of a full copy of the graph.
+ *
+ * The graph is fed with GraphEvents like a Graph by the GraphUpdater. Each time step ends the current version and
+ * retains its snapshot until it is removed with discardVersionsBefore(). The blocks of discarded versions are freed
+ * as soon as no Snapshot refers to them anymore.
+ */
+class VersionedGraph {
+private:
+	struct Adjacency {
+		std::vector<node> outEdges;
+		std::vector<edgeweight> outEdgeWeights;
+		std::vector<node> inEdges; //!< only used for directed graphs
+		std::vector<edgeweight> inEdgeWeights;
+	};
+
+	static const count CHUNK_SIZE = 64;
+
+	struct Chunk {
+		std::bitset<CHUNK_SIZE> exists;
+		std::array<std::shared_ptr<Adjacency>, CHUNK_SIZE> adjacency; //!< nullptr for nodes without edges
+	};
+
+	struct State {
+		count n;
+		count m;
+		count z; //!< upper node id bound
+		bool weighted;
+		bool directed;
+		std::vector<std::shared_ptr<Chunk>> chunks;
+
+		bool exists(node u) const {
+			return chunks[u / CHUNK_SIZE]->exists[u % CHUNK_SIZE];
+		}
+
+		const std::shared_ptr<Adjacency>& adjacency(node u) const {
+			return chunks[u / CHUNK_SIZE]->adjacency[u % CHUNK_SIZE];
+		}
+	};
+
+public:
+	/**
+	 * Read-only handle of a version of a VersionedGraph. Copying a snapshot is cheap and it stays valid when the
+	 * VersionedGraph changes or is destroyed.
+	 */
+	class Snapshot {
+	public:
+		Snapshot() = default;
+
+		/** @return The version of the snapshot, i.e. the number of time steps before it. */
+		index version() const {
+			return ver;
+		}
+
+		count numberOfNodes() const {
+			return state->n;
+		}
+
+		count numberOfEdges() const {
+			return state->m;
+		}
+
+		count upperNodeIdBound() const {
+			return state->z;
+		}
+
+		bool isWeighted() const {
+			return state->weighted;
+		}
+
+		bool isDirected() const {
+			return state->directed;
+		}
+
+		bool hasNode(node u) const {
+			return u < state->z && state->exists(u);
+		}
+
+		/** @return Number of outgoing neighbors of @a u. */
+		count degree(node u) const {
+			const Adjacency* a = state->adjacency(u).get();
+			return a ? a->outEdges.size() : 0;
+		}
+
+		/** @return Number of incoming neighbors of @a u. */
+		count degreeIn(node u) const {
+			const Adjacency* a = state->adjacency(u).get();
+			return a ? (state->directed ? a->inEdges.size() : a->outEdges.size()) : 0;
+		}
+
+		bool hasEdge(node u, node v) const;
+
+		/** @return Weight of edge (@a u, @a v), 0 if the edge does not exist. */
+		edgeweight weight(node u, node v) const;
+
+		/**
+		 * Iterate over all nodes of the snapshot and call @a handle (lambda closure).
+		 */
+		template<typename L> void forNodes(L handle) const;
+
+		/**
+		 * Iterate in parallel over all nodes of the snapshot and call @a handle (lambda closure).
+		 */
+		template<typename L> void parallelForNodes(L handle) const;
+
+		/**
+		 * Iterate over all outgoing neighbors of @a u and call @a handle(node v, edgeweight w).
+		 */
+		template<typename L> void forNeighborsOf(node u, L handle) const;
+
+		/**
+		 * Iterate over all incoming neighbors of @a u and call @a handle(node v, edgeweight w).
+		 */
+		template<typename L> void forInNeighborsOf(node u, L handle) const;
+
+		/**
+		 * Iterate over all edges of the snapshot and call @a handle(node u, node v, edgeweight w).
+		 */
+		template<typename L> void forEdges(L handle) const;
+
+		/**
+		 * Materializes the snapshot as Graph for algorithms that require one. The node ids are kept.
+		 */
+		Graph toGraph() const;
+
+		/**
+		 * @return True if the adjacency of @a u is shared with @a other, i.e. it has not changed in between.
+		 */
+		bool sharesAdjacency(const Snapshot& other, node u) const {
+			return u < state->z && u < other.state->z && state->adjacency(u) == other.state->adjacency(u);
+		}
+
+	private:
+		friend class VersionedGraph;
+
+		Snapshot(std::shared_ptr<const State> state, index ver) : state(std::move(state)), ver(ver) {}
+
+		std::shared_ptr<const State> state;
+		index ver = 0;
+	};
+
+	/**
+	 * Creates a versioned graph with @a n nodes and without edges.
+	 */
+	VersionedGraph(count n = 0, bool weighted = false, bool directed = false);
+
+	/**
+	 * Creates a versioned graph whose version 0 is a copy of @a G. The node ids are kept.
+	 */
+	explicit VersionedGraph(const Graph& G);
+
+	node addNode();
+	void removeNode(node u);
+	void restoreNode(node u);
+
+	void addEdge(node u, node v, edgeweight w = defaultEdgeWeight);
+
+	/**
+	 * Removes the edge (@a u, @a v), throws a std::runtime_error if it does not exist.
+	 */
+	void removeEdge(node u, node v);
+
+	/**
+	 * Sets the weight of (@a u, @a v) to @a w, a missing edge is created.
+	 */
+	void setWeight(node u, node v, edgeweight w);
+
+	/**
+	 * Increases the weight of (@a u, @a v) by @a w, a missing edge is created.
+	 */
+	void increaseWeight(node u, node v, edgeweight w);
+
+	/**
+	 * Ends the current version. Its snapshot is retained until it is discarded.
+	 */
+	void timeStep();
+
+	/**
+	 * Applies the events of @a stream in order, a TIME_STEP event ends the current version.
+	 */
+	void update(const std::vector<GraphEvent>& stream);
+
+	/**
+	 * @return The current version, i.e. the number of time steps so far.
+	 */
+	index version() const {
+		return currentVersion;
+	}
+
+	/**
+	 * @return Snapshot of the current state.
+	 */
+	Snapshot snapshot();
+
+	/**
+	 * @return Snapshot of the final state of @a version, which has to be retained.
+	 */
+	Snapshot snapshot(index version) const;
+
+	/**
+	 * @return True if the snapshot of @a version is retained.
+	 */
+	bool hasVersion(index version) const;
+
+	/**
+	 * Discards the retained snapshots of all versions before @a version.
+	 */
+	void discardVersionsBefore(index version);
+
+	/**
+	 * @return Number of retained versions.
+	 */
+	count numberOfRetainedVersions() const {
+		return history.size();
+	}
+
+private:
+	State current;
+	index currentVersion;
+	std::shared_ptr<const State> frozen; //!< snapshot of the current state if it has not changed since
+	std::deque<Snapshot> history; //!< retained versions in ascending order
+
+	/** Returns the chunk of @a u for writing, copies it if it is shared with a snapshot. */
+	Chunk& mutableChunk(node u);
+
+	/** Returns the adjacency of @a u for writing, copies it if it is shared with a snapshot. */
+	Adjacency& mutableAdjacency(node u);
+
+	/** Returns the position of @a v in @a edges or none. */
+	static index find(const std::vector<node>& edges, node v);
+
+	/** Removes position @a i from @a edges and @a weights. */
+	static void erase(std::vector<node>& edges, std::vector<edgeweight>& weights, index i);
+
+	/** Applies @a change to the weight of (@a u, @a v) in all adjacencies or adds the edge with weight @a w. */
+	template<typename F> void updateWeight(node u, node v, edgeweight w, F change);
+};
+
+inline bool VersionedGraph::Snapshot::hasEdge(node u, node v) const {
+	if (!hasNode(u) || !hasNode(v)) return false;
+	const Adjacency* a = state->adjacency(u).get();
+	return a && VersionedGraph::find(a->outEdges, v) != none;
+}
+
+inline edgeweight VersionedGraph::Snapshot::weight(node u, node v) const {
+	if (!hasNode(u) || !hasNode(v)) return nullWeight;
+	const Adjacency* a = state->adjacency(u).get();
+	index i = a ? VersionedGraph::find(a->outEdges, v) : none;
+	if (i == none) return nullWeight;
+	return state->weighted ? a->outEdgeWeights[i] : defaultEdgeWeight;
+}
+
+template<typename L>
+void VersionedGraph::Snapshot::forNodes(L handle) const {
+	for (node u = 0; u < state->z; ++u) {
+		if (state->exists(u)) {
+			handle(u);
+		}
+	}
+}
+
+template<typename L>
+void VersionedGraph::Snapshot::parallelForNodes(L handle) const {
+#pragma omp parallel for
+	for (omp_index u = 0; u < static_cast<omp_index>(state->z); ++u) {
+		if (state->exists(u)) {
+			handle(u);
+		}
+	}
+}
+
+template<typename L>
+void VersionedGraph::Snapshot::forNeighborsOf(node u, L handle) const {
+	const Adjacency* a = state->adjacency(u).get();
+	if (!a) return;
+	for (index i = 0; i < a->outEdges.size(); ++i) {
+		handle(a->outEdges[i], state->weighted ? a->outEdgeWeights[i] : defaultEdgeWeight);
+	}
+}
+
+template<typename L>
+void VersionedGraph::Snapshot::forInNeighborsOf(node u, L handle) const {
+	if (!state->directed) {
+		forNeighborsOf(u, handle);
+		return;
+	}
+	const Adjacency* a = state->adjacency(u).get();
+	if (!a) return;
+	for (index i = 0; i < a->inEdges.size(); ++i) {
+		handle(a->inEdges[i], state->weighted ? a->inEdgeWeights[i] : defaultEdgeWeight);
+	}
+}
+
+template<typename L>
+void VersionedGraph::Snapshot::forEdges(L handle) const {
+	forNodes([&](node u) {
+		forNeighborsOf(u, [&](node v, edgeweight w) {
+			if (state->directed || u >= v) {
+				handle(u, v, w);
+			}
+		});
+	});
+}
+
+} /* namespace NetworKit */
+
+#endif /* VERSIONEDGRAPH_H_ */
@@ -9,9 +9,16 @@
 
 #include "../DGSStreamParser.h"
 #include "../../auxiliary/Log.h"
+#include "../../auxiliary/Random.h"
 #include "../GraphEvent.h"
 #include "../GraphUpdater.h"
 #include "../GraphDifference.h"
+#include "../VersionedGraph.h"
+#include "../SlidingWindowGraph.h"
+#include "../../components/ConnectedComponents.h"
+#include "../../components/DynConnectedComponents.h"
+#include "../../distance/BFS.h"
+#include "../../distance/DynBFS.h"
 
 namespace NetworKit {
 
@@ -105,6 +112,233 @@ namespace {
 	};
 };
 
+TEST_F(DynamicsGTest, testGraphUpdaterBatches) {
+	Aux::Random::setSeed(42, false);
+	for (bool directed : {false, true}) {
+		const count n = 50;
+		Graph G(n, true, directed);
+		Graph H(n, true, directed);
+
+		// runs of edge events of the same type interleaved with node events and time steps
+		std::vector<GraphEvent> stream;
+		for (count run = 0; run < 20; ++run) {
+			GraphEvent::Type type = static_cast<GraphEvent::Type>(GraphEvent::EDGE_ADDITION + run % 4);
+			for (count k = 0; k < (type == GraphEvent::EDGE_REMOVAL ? 40 : 100); ++k) {
+				node u = Aux::Random::integer(n - 1);
+				node v = Aux::Random::integer(n - 1);
+				if (type == GraphEvent::EDGE_REMOVAL) {
+					std::pair<node, node> e = H.randomEdge();
+					u = e.first;
+					v = e.second;
+				} else if (type == GraphEvent::EDGE_ADDITION && H.hasEdge(u, v)) {
+					continue; // no multi-edges, they are not distinguished by the comparison
+				}
+				GraphEvent event(type, u, v, Aux::Random::real());
+				stream.push_back(event);
+				if (type == GraphEvent::EDGE_ADDITION) {
+					H.addEdge(u, v, event.w);
+				} else if (type == GraphEvent::EDGE_REMOVAL) {
+					H.removeEdge(u, v);
+				} else if (type == GraphEvent::EDGE_WEIGHT_UPDATE) {
+					H.setWeight(u, v, event.w);
+				} else {
+					H.setWeight(u, v, H.weight(u, v) + event.w);
+				}
+			}
+			stream.emplace_back(GraphEvent::TIME_STEP);
+			H.timeStep();
+		}
+
+		GraphUpdater updater(G);
+		updater.update(stream);
+		expect_graph_equals(G, H);
+		H.forNodes([&](node u) {
+			H.forEdgesOf(u, [&](node, node v, edgeweight w) {
+				EXPECT_EQ(w, G.weight(u, v));
+			});
+		});
+	}
+}
+
+TEST_F(DynamicsGTest, testVersionedGraph) {
+	Aux::Random::setSeed(42, false);
+	for (bool directed : {false, true}) {
+		const count n = 200;
+		const count steps = 10;
+		Graph H(n, true, directed);
+		std::vector<Graph> versions;
+		std::vector<std::vector<bool>> touched(steps, std::vector<bool>(n, false));
+
+		std::vector<GraphEvent> stream;
+		for (count step = 0; step < steps; ++step) {
+			auto touch = [&](node u, node v) {
+				touched[step][u] = touched[step][v] = true;
+			};
+			for (count k = 0; k < 50; ++k) {
+				node u = H.randomNode();
+				node v = H.randomNode();
+				stream.emplace_back(GraphEvent::EDGE_ADDITION, u, v, Aux::Random::real());
+				H.addEdge(u, v, stream.back().w);
+				touch(u, v);
+			}
+			for (count k = 0; k < 10; ++k) {
+				std::pair<node, node> e = H.randomEdge();
+				stream.emplace_back(GraphEvent::EDGE_REMOVAL, e.first, e.second);
+				H.removeEdge(e.first, e.second);
+				touch(e.first, e.second);
+
+				e = H.randomEdge();
+				stream.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, e.first, e.second, 1.0);
+				H.increaseWeight(e.first, e.second, 1.0);
+				touch(e.first, e.second);
+			}
+			if (step % 3 == 2) {
+				node u = H.randomNode();
+				stream.emplace_back(GraphEvent::NODE_REMOVAL, u);
+				H.forNodes([&](node v) {
+					if (H.hasEdge(u, v) || H.hasEdge(v, u)) touch(u, v);
+				});
+				H.removeNode(u);
+			}
+			stream.emplace_back(GraphEvent::TIME_STEP);
+			versions.push_back(H);
+		}
+
+		VersionedGraph VG(n, true, directed);
+		VG.update(stream);
+		EXPECT_EQ(steps, VG.version());
+		EXPECT_EQ(steps, VG.numberOfRetainedVersions());
+
+		auto sortedEdges = [&](const Graph& G) {
+			std::vector<std::tuple<node, node, edgeweight>> edges;
+			G.forEdges([&](node u, node v, edgeweight w) {
+				edges.emplace_back(u, v, w);
+			});
+			std::sort(edges.begin(), edges.end());
+			return edges;
+		};
+
+		for (index version = 0; version < steps; ++version) {
+			VersionedGraph::Snapshot S = VG.snapshot(version);
+			EXPECT_EQ(version, S.version());
+			EXPECT_EQ(versions[version].numberOfNodes(), S.numberOfNodes());
+			EXPECT_EQ(versions[version].numberOfEdges(), S.numberOfEdges());
+			versions[version].forNodes([&](node u) {
+				EXPECT_TRUE(S.hasNode(u));
+				EXPECT_EQ(versions[version].degree(u), S.degree(u));
+				EXPECT_EQ(versions[version].degreeIn(u), S.degreeIn(u));
+			});
+
+			Graph G = S.toGraph();
+			EXPECT_EQ(versions[version].numberOfNodes(), G.numberOfNodes());
+			EXPECT_EQ(sortedEdges(versions[version]), sortedEdges(G));
+
+			// adjacencies of nodes without changes are shared with the previous version
+			if (version > 0) {
+				VersionedGraph::Snapshot previous = VG.snapshot(version - 1);
+				for (node u = 0; u < n; ++u) {
+					EXPECT_EQ(!touched[version][u], S.sharesAdjacency(previous, u));
+				}
+			}
+		}
+
+		// a snapshot stays valid after its version is discarded and the graph changes
+		VersionedGraph::Snapshot first = VG.snapshot(0);
+		VG.discardVersionsBefore(steps - 2);
+		EXPECT_EQ(2u, VG.numberOfRetainedVersions());
+		EXPECT_FALSE(VG.hasVersion(0));
+		EXPECT_THROW(VG.snapshot(0), std::runtime_error);
+		VG.addEdge(VG.addNode(), H.randomNode());
+		EXPECT_EQ(sortedEdges(versions[0]), sortedEdges(first.toGraph()));
+		EXPECT_EQ(versions[steps - 1].numberOfEdges() + 1, VG.snapshot().numberOfEdges());
+		EXPECT_EQ(versions[steps - 1].numberOfEdges(), VG.snapshot(steps - 1).numberOfEdges());
+
+		// version 0 of a graph created from a Graph
+		VersionedGraph copy(H);
+		EXPECT_EQ(H.numberOfNodes(), copy.snapshot().numberOfNodes());
+		EXPECT_EQ(sortedEdges(H), sortedEdges(copy.snapshot().toGraph()));
+	}
+}
+
+TEST_F(DynamicsGTest, testSlidingWindowGraph) {
+	Aux::Random::setSeed(42, false);
+	const count n = 100;
+	const double windowLength = 7.0;
+	Graph G(n);
+	for (node u = 1; u < n; ++u) {
+		G.addEdge(u - 1, u); // static edges keep the graph connected
+	}
+	SlidingWindowGraph window(G, windowLength);
+
+	DynConnectedComponents cc(G);
+	cc.run();
+	window.attach(cc);
+	DynBFS bfs(G, 0);
+	bfs.run();
+	window.attachRecomputing(bfs);
+	count insertions = 0, expiries = 0;
+	window.attach([&](const std::vector<GraphEvent>& batch) {
+		for (const GraphEvent& e : batch) {
+			if (e.type == GraphEvent::EDGE_ADDITION) ++insertions;
+			else if (e.type == GraphEvent::EDGE_REMOVAL) ++expiries;
+		}
+	});
+
+	std::vector<SlidingWindowGraph::TimedEdge> all;
+	for (count day = 0; day < 30; ++day) {
+		// a batch of interactions per day, with repetitions of the same edges
+		std::vector<double> times;
+		for (count k = 0; k < 20; ++k) {
+			times.push_back(day + Aux::Random::real());
+		}
+		std::sort(times.begin(), times.end());
+		std::vector<SlidingWindowGraph::TimedEdge> batch;
+		for (double time : times) {
+			batch.emplace_back(Aux::Random::integer(n / 4 - 1), Aux::Random::integer(n / 4 - 1), time);
+		}
+		window.addEdges(batch);
+		all.insert(all.end(), batch.begin(), batch.end());
+		window.advanceTo(day + 1.0);
+
+		// reference: latest interaction of each edge within the window, except the static ones
+		std::map<std::pair<node, node>, double> expected;
+		for (const SlidingWindowGraph::TimedEdge& e : all) {
+			if (e.time > window.now() - windowLength) {
+				expected[std::make_pair(std::max(e.u, e.v), std::min(e.u, e.v))] = e.time;
+			}
+		}
+		for (auto it = expected.begin(); it != expected.end();) {
+			it = it->first.first == it->first.second + 1 ? expected.erase(it) : std::next(it);
+		}
+		ASSERT_EQ(expected.size() + n - 1, G.numberOfEdges());
+		EXPECT_EQ(expected.size(), window.numberOfEdges());
+		for (const auto& e : expected) {
+			EXPECT_TRUE(G.hasEdge(e.first.first, e.first.second));
+			EXPECT_EQ(e.second, window.timestamp(e.first.second, e.first.first));
+		}
+
+		// window query of the last day
+		count lastDay = 0;
+		for (const auto& e : expected) {
+			if (e.second >= day) ++lastDay;
+		}
+		EXPECT_EQ(lastDay, window.edgesInWindow(day, day + 1.0).size());
+
+		// the attached algorithms are up to date
+		ConnectedComponents reference(G);
+		reference.run();
+		EXPECT_EQ(reference.numberOfComponents(), cc.numberOfComponents());
+		BFS referenceBFS(G, 0);
+		referenceBFS.run();
+		EXPECT_EQ(referenceBFS.getDistances(), bfs.getDistances(false));
+	}
+	EXPECT_EQ(insertions - expiries + n - 1, G.numberOfEdges());
+	EXPECT_GT(expiries, 0u);
+
+	EXPECT_THROW(window.addEdge(0, 1, 0.0), std::runtime_error);
+	EXPECT_THROW(window.advanceTo(0.0), std::runtime_error);
+}
+
 TEST_F(DynamicsGTest, testGraphDifference) {
 	Graph G1(11, false, false);
 	Graph G2(8, false, false);
@@ -5,10 +5,16 @@
  *      Author: forigem
  */
 
+#include <omp.h>
+
 #include "../auxiliary/Random.h"
+#include "../auxiliary/Parallel.h"
+#include "../auxiliary/SignalHandling.h"
+#include "../graph/GraphBuilder.h"
 
 #include "BarabasiAlbertGenerator.h"
 
+#include <algorithm>
 #include <set>
 
 
@@ -110,49 +116,186 @@ Graph BarabasiAlbertGenerator::generateOriginal() {
 	return G;
 }
 
-Graph BarabasiAlbertGenerator::generateBatagelj() {
-	count n = nMax;
-	Graph G(nMax);
-	std::vector<node> M(2 * k * n);
-	std::set<std::pair<node, node>> uniqueEdges;
-
-	if (initGraph.numberOfNodes() == 0) {
+std::vector<node> BarabasiAlbertGenerator::initialEdges(node& firstNewNode) const {
+	std::vector<node> initialM;
+	if (initGraph.numberOfNodes() > 0) {
+		initGraph.forEdges([&](node u, node v) {
+			initialM.push_back(u);
+			initialM.push_back(v);
+		});
+		firstNewNode = initGraph.numberOfNodes();
+	} else {
 		// initialize n0 connected nodes
-		for (index v = 0; v < n0; ++v) {
-			M[2 * v ] = v;
-			M[2 * v + 1] = v + 1;
+		for (node v = 1; v < n0; ++v) {
+			initialM.push_back(v - 1);
+			initialM.push_back(v);
 		}
-	} else {
-		index i = 0;
-		initGraph.forEdges( [&M,&i] (node u, node v) {
-			M[2 * i] = u;
-			M[2 * i +1] = v;
-			++i;
-		});
-		n0 = i;
+		firstNewNode = n0;
 	}
+	return initialM;
+}
+
+namespace {
+
+/**
+ * M[2j] is the source of the j-th edge; M[2j+1] = M[r] for r uniform in [0, 2j).
+ * Instead of materialising M, we follow r until it hits an entry that is known
+ * without randomness (Sanders, Uhl: Communication-free massively distributed
+ * graph generation, 2018). The random choice of the j-th edge only depends on
+ * (seed, j), so all edges can be computed independently. The expected number of
+ * lookups per edge is constant.
+ */
+class BatageljTargets {
+public:
+	BatageljTargets(const std::vector<node>& initialM, node firstNewNode, count k, uint64_t seed) :
+		initialM(initialM), firstNewNode(firstNewNode), k(k), m0(initialM.size() / 2), seed(seed)
+	{}
+
+	node source(index j) const {
+		return firstNewNode + (j - m0) / k;
+	}
+
+	node resolve(index pos) const {
+		while (true) {
+			if (pos < 2 * m0)
+				return initialM[pos];
+			if (pos % 2 == 0)
+				return source(pos / 2);
+			const index j = pos / 2;
+			if (j == 0) // no earlier entry; results in a self loop
+				return source(j);
+			// modulo bias is negligible for less than 2^40 edges
+			pos = Aux::Random::streamSeed(seed, j) % (2 * j);
+		}
+	}
+
+private:
+	const std::vector<node>& initialM;
+	const node firstNewNode;
+	const count k;
+	const count m0;
+	const uint64_t seed;
+};
+
+} // namespace
+
+Graph BarabasiAlbertGenerator::generateBatagelj() {
+	// Edges of the initial graph occupy the first entries of M
+	node firstNewNode;
+	const std::vector<node> initialM = initialEdges(firstNewNode);
+
+	const count m0 = initialM.size() / 2;
+	const count numNewEdges = (nMax - firstNewNode) * k;
+	const BatageljTargets targets(initialM, firstNewNode, k, Aux::Random::integer());
+
+	using NodePair = std::pair<node, node>;
+	std::vector<NodePair> edges(m0 + numNewEdges);
 
-	// "draw" the edges
-	for (index v = n0; v < n; ++v) {
-		for (index i = 0; i < k; ++i) {
-			M[2 * (v * k + i)] = v;
-			index r = Aux::Random::integer(2 * (v * k + i));
-			M[2 * (v * k + i) + 1] = M[r];
+	#pragma omp parallel for
+	for (omp_index j = 0; j < static_cast<omp_index>(m0 + numNewEdges); ++j) {
+		node u, v;
+		if (static_cast<index>(j) < m0) {
+			u = initialM[2 * j];
+			v = initialM[2 * j + 1];
+		} else {
+			u = targets.source(j);
+			v = targets.resolve(2 * j + 1);
 		}
+		// self loops are sorted to the end and removed below
+		edges[j] = (u == v) ? NodePair{none, none} : NodePair{std::minmax(u, v)};
 	}
 
 	// remove duplicates and avoid selfloops
-	// for some reason, it seems to be faster with a separate loop when compared to integrating it in the loop above
-	for (index i = 0; i < (k*n); ++i) {
-		if (M[2 * i] != M[2 * i + 1])
-			uniqueEdges.insert( std::minmax({M[2 * i], M[2 * i + 1]}) );
+	Aux::Parallel::sort(edges.begin(), edges.end());
+	edges.erase(std::lower_bound(edges.begin(), edges.end(), NodePair{none, none}), edges.end());
+	edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+	// add the edges to the graph; each row is added by a single thread
+	GraphBuilder builder(nMax);
+	const count numChunks = 4 * omp_get_max_threads();
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index chunk = 0; chunk < static_cast<omp_index>(numChunks); ++chunk) {
+		auto rowStart = [&](index i) {
+			while (i > 0 && i < edges.size() && edges[i].first == edges[i - 1].first) ++i;
+			return i;
+		};
+		const index end = rowStart(edges.size() * (chunk + 1) / numChunks);
+		for (index i = rowStart(edges.size() * chunk / numChunks); i < end; ++i)
+			builder.addHalfOutEdge(edges[i].first, edges[i].second);
 	}
-	// add the edges to the graph
-	for (const auto& edge : uniqueEdges) {
-		G.addEdge(edge.first, edge.second);
+
+	return builder.toGraph(true, true);
+}
+
+void BarabasiAlbertGenerator::forEdgeBatches(const EdgeBatchHandle& handle) {
+	EdgeBatch batch;
+
+	if (!batagelj) {
+		const Graph G = generateOriginal();
+		G.forEdges([&](node u, node v) {
+			batch.emplace_back(std::min(u, v), std::max(u, v), defaultEdgeWeight);
+		});
+		handle(batch);
+		return;
+	}
+
+	node firstNewNode;
+	const std::vector<node> initialM = initialEdges(firstNewNode);
+	const count m0 = initialM.size() / 2;
+	const BatageljTargets targets(initialM, firstNewNode, k, Aux::Random::integer());
+
+	// the initial edges; duplicates and self loops are removed as in generateBatagelj()
+	{
+		using NodePair = std::pair<node, node>;
+		std::vector<NodePair> edges;
+		for (index j = 0; j < m0; ++j) {
+			if (initialM[2 * j] != initialM[2 * j + 1])
+				edges.emplace_back(std::minmax(initialM[2 * j], initialM[2 * j + 1]));
+		}
+		std::sort(edges.begin(), edges.end());
+		edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+		for (const NodePair& e : edges)
+			batch.emplace_back(e.first, e.second, defaultEdgeWeight);
+		if (!batch.empty())
+			handle(batch);
+	}
+
+	if (k == 0)
+		return;
+
+	// all targets of a new node u are smaller than or equal to u; slot i * k + l of
+	// a window holds the l-th target of its i-th node, or none if it was dropped
+	const count windowNodes = std::max<count>(1, (count{1} << 20) / k);
+	std::vector<node> window;
+
+	Aux::SignalHandler handler;
+
+	for (node windowBegin = firstNewNode; windowBegin < nMax; windowBegin += windowNodes) {
+		handler.assureRunning();
+		const node windowEnd = std::min<node>(nMax, windowBegin + windowNodes);
+		window.resize((windowEnd - windowBegin) * k);
+
+		#pragma omp parallel for
+		for (omp_index u = windowBegin; u < static_cast<omp_index>(windowEnd); ++u) {
+			auto first = window.begin() + (u - windowBegin) * k;
+			auto last = first + k;
+			const index firstEdge = m0 + (u - firstNewNode) * k;
+			for (index l = 0; l < k; ++l) {
+				const node v = targets.resolve(2 * (firstEdge + l) + 1);
+				*(first + l) = (v == static_cast<node>(u)) ? none : v;
+			}
+			std::sort(first, last);
+			std::fill(std::unique(first, last), last, none);
+		}
+
+		batch.clear();
+		for (index i = 0; i < window.size(); ++i) {
+			if (window[i] != none)
+				batch.emplace_back(window[i], windowBegin + i / k, defaultEdgeWeight);
+		}
+		if (!batch.empty())
+			handle(batch);
 	}
-	G.shrinkToFit();
-	return G;
 }
 
 } /* namespace NetworKit */
@@ -8,15 +8,21 @@
 #ifndef BarabasiAlbertGenerator_H_
 #define BarabasiAlbertGenerator_H_
 
+#include <vector>
+
 #include "StaticGraphGenerator.h"
+#include "EdgeStreamGenerator.h"
 
 namespace NetworKit {
 
 /**
  * @ingroup generators
  * Generates a scale-free graph using the Barabasi-Albert preferential attachment model.
+ *
+ * With the method of Batagelj and Brandes, the edges can also be streamed
+ * without building a Graph (see @ref EdgeStreamGenerator).
  */
-class BarabasiAlbertGenerator: public StaticGraphGenerator {
+class BarabasiAlbertGenerator: public StaticGraphGenerator, public EdgeStreamGenerator {
 private:
 	Graph initGraph;
 	count k; //!< Attachments made per node
@@ -28,12 +34,23 @@ private:
 	 * Implementation of ALG 5 of Batagelj, Brandes: Efficient Generation of Large Random Networks
 	 * https://kops.uni-konstanz.de/bitstream/handle/123456789/5799/random.pdf?sequence=1
 	 * Running time is O(n+m)
+	 *
+	 * Edges are computed independently and in parallel by resolving the
+	 * targets recursively as proposed by Sanders, Uhl: Communication-free
+	 * massively distributed graph generation (IPDPS 2018). For a fixed seed
+	 * the result does not depend on the number of threads.
 	 * @return The generated graph
 	 */
 	Graph generateBatagelj();
 
 	Graph generateOriginal();
 
+	/**
+	 * Returns the endpoints of the initial edges as consecutive entries
+	 * and sets @a firstNewNode to the first node attached by the model.
+	 */
+	std::vector<node> initialEdges(node& firstNewNode) const;
+
 public:
 	BarabasiAlbertGenerator();
 
@@ -42,6 +59,8 @@ public:
 	 * The original algorithm is very slow and thus, the much faster method from Batagelj and Brandes[2] is
 	 * implemented and the current default.
 	 * The original method can be chosen by setting \p batagelj to false.
+	 * The method of Batagelj and Brandes is parallelised; if no initial graph is
+	 * given, it starts with a path on the first n0 nodes.
 	 * [1] Barabasi, Albert: Emergence of Scaling in Random Networks http://arxiv.org/pdf/cond-mat/9910332.pdf
 	 * [2] ALG 5 of Batagelj, Brandes: Efficient Generation of Large Random Networks https://kops.uni-konstanz.de/bitstream/handle/123456789/5799/random.pdf?sequence=1
 	 *
@@ -55,6 +74,17 @@ public:
 	BarabasiAlbertGenerator(count k, count nMax, const Graph& initGraph, bool batagelj=true);
 
 	Graph generate() override;
+
+	count numberOfNodes() const override { return nMax; }
+
+	/**
+	 * Streams the edges; for the same seed the stream contains the edges of
+	 * @ref generate. The edges of a new node can only collide with each
+	 * other, so duplicates are removed per node and only the edges of a
+	 * window of nodes are kept in memory. The original method builds the
+	 * graph and streams its edges afterwards.
+	 */
+	void forEdgeBatches(const EdgeBatchHandle& handle) override;
 };
 
 } /* namespace NetworKit */
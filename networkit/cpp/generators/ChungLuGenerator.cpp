@@ -6,54 +6,196 @@
  *      Contributors: Hoske/Weisbarth
  */
 
+#include <algorithm>
+#include <cmath>
 #include <numeric>
+#include <random>
+#include <utility>
+
+#include <omp.h>
 
 #include "ChungLuGenerator.h"
 #include "../graph/GraphBuilder.h"
 #include "../auxiliary/Parallel.h"
+#include "../auxiliary/SignalHandling.h"
 
 namespace NetworKit {
 
 ChungLuGenerator::ChungLuGenerator(const std::vector<count> &degreeSequence) :
 		StaticDegreeSequenceGenerator(degreeSequence) {
-	sum_deg = std::accumulate(seq.begin(), seq.end(), 0);
+	sum_deg = std::accumulate(seq.begin(), seq.end(), count{0});
 	n = (count) seq.size();
 }
 
-	Graph ChungLuGenerator::generate() {
-		GraphBuilder gB(n);
-
-		/* We need a sorted list in descending order for this algorithm */
-		Aux::Parallel::sort(seq.begin(), seq.end(), [](count a, count b){ return a > b;});
-
-		for (node u = 0; u <= n - 2; u++) {
-			node v = u + 1;
-			/* Apparently it is necessary to include all these casts for
-             * the probability to be properly calculated */
-			double p = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
-
-			while (v < n && p > 0) {
-				if (p != 1.0) {
-					double randVal = Aux::Random::probability();
-					/* Calculate the distance to the next potential neighbour*/
-					v = v + (node) std::floor(log(randVal)/log(1 - p));
-				}
-				if ((count) v < n) {
-					double q = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
-					double randVal2 = Aux::Random::probability();
-					/* The potential neighbour was selected with the probability p.
-                     * In order to see if this neighbour should be rejected or accepted
-                     * we correct the probability using q */
-					if (randVal2 < q / p) {
-						gB.addHalfOutEdge(u, v);
-					}
-					p = q;
-					v++;
-				}
+std::vector<ChungLuGenerator::WorkUnit> ChungLuGenerator::computeWorkUnits() const {
+	std::vector<WorkUnit> units;
+	if (n < 2 || sum_deg == 0)
+		return units;
+
+	// prefix[v] is the volume of nodes 0, ..., v-1; as seq is sorted
+	// the expected number of candidates of (u, [a, b)) is roughly
+	// seq[u] * (prefix[b] - prefix[a]) / sum_deg
+	std::vector<count> prefix(n + 1);
+	prefix[0] = 0;
+	for (node v = 0; v < n; ++v)
+		prefix[v + 1] = prefix[v] + seq[v];
+
+	auto expectedWork = [&](node u, node begin, node end) {
+		const double expEdges = static_cast<double>(seq[u]) * (prefix[end] - prefix[begin]) / sum_deg;
+		return std::min<double>(expEdges, end - begin);
+	};
+
+	node rangeBegin = 0;
+	double rangeWork = 0.0;
+
+	for (node u = 0; u + 1 < n; ++u) {
+		const double work = 1.0 + expectedWork(u, u + 1, n);
+
+		if (work <= unitGrain) {
+			rangeWork += work;
+			if (rangeWork >= unitGrain) {
+				units.push_back({rangeBegin, u + 1, none, none});
+				rangeBegin = u + 1;
+				rangeWork = 0.0;
+			}
+			continue;
+		}
+
+		// close the pending range of light rows and split the heavy row into
+		// column segments of roughly the same expected number of candidates
+		if (rangeBegin < u)
+			units.push_back({rangeBegin, u, none, none});
+		rangeBegin = u + 1;
+		rangeWork = 0.0;
+
+		const count segments = static_cast<count>(std::ceil(work / unitGrain));
+		const count mass = prefix[n] - prefix[u + 1];
+		node segBegin = u + 1;
+		for (count i = 1; i <= segments && segBegin < n; ++i) {
+			node segEnd = n;
+			if (i < segments) {
+				const count target = prefix[u + 1] + static_cast<count>(static_cast<double>(mass) * i / segments);
+				segEnd = std::lower_bound(prefix.begin() + segBegin + 1, prefix.begin() + n, target) - prefix.begin();
+			}
+			if (segEnd > segBegin) {
+				units.push_back({u, u + 1, segBegin, segEnd});
+				segBegin = segEnd;
+			}
+		}
+	}
+
+	if (rangeBegin + 1 < n)
+		units.push_back({rangeBegin, n - 1, none, none});
+
+	return units;
+}
+
+Graph ChungLuGenerator::generate() {
+	GraphBuilder gB(n);
+
+	/* We need a sorted list in descending order for this algorithm */
+	Aux::Parallel::sort(seq.begin(), seq.end(), [](count a, count b){ return a > b;});
+
+	const std::vector<WorkUnit> units = computeWorkUnits();
+
+	// Each unit draws from its own generator seeded by the unit's index, which
+	// depends only on the degree sequence. Hence the edge set produced is a
+	// function of the seed and does not depend on the number of threads.
+	const uint64_t baseSeed = Aux::Random::integer();
+
+	// Segments of split rows cannot be added to the builder concurrently,
+	// as they share their source node. They are buffered and appended in
+	// unit order afterwards.
+	std::vector<std::vector<node>> segmentBuffers(units.size());
+
+	Aux::SignalHandler handler;
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index i = 0; i < static_cast<omp_index>(units.size()); ++i) {
+		if (!handler.isRunning()) continue;
+
+		const WorkUnit &unit = units[i];
+		std::mt19937_64 urng(Aux::Random::streamSeed(baseSeed, i));
+
+		if (unit.vBegin == none) {
+			for (node u = unit.uBegin; u < unit.uEnd; ++u) {
+				generateRow(urng, u, u + 1, n, [&](node u, node v) {
+					gB.addHalfOutEdge(u, v);
+				});
+			}
+		} else {
+			auto &buffer = segmentBuffers[i];
+			generateRow(urng, unit.uBegin, unit.vBegin, unit.vEnd, [&](node, node v) {
+				buffer.push_back(v);
+			});
+		}
+	}
+
+	handler.assureRunning();
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index i = 0; i < static_cast<omp_index>(units.size()); ++i) {
+		// only the first segment of each split row gathers the row's buffers
+		if (units[i].vBegin == none || (i > 0 && units[i - 1].uBegin == units[i].uBegin))
+			continue;
+
+		const node u = units[i].uBegin;
+		for (index j = i; j < units.size() && units[j].uBegin == u && units[j].vBegin != none; ++j) {
+			for (node v : segmentBuffers[j])
+				gB.addHalfOutEdge(u, v);
+			std::vector<node>().swap(segmentBuffers[j]);
+		}
+	}
+
+	return gB.toGraph(true,true);
+}
+
+void ChungLuGenerator::forEdgeBatches(const EdgeBatchHandle& handle) {
+	// same preparation and seed as generate(), so the stream contains the same edges
+	Aux::Parallel::sort(seq.begin(), seq.end(), [](count a, count b){ return a > b;});
+
+	const std::vector<WorkUnit> units = computeWorkUnits();
+	const uint64_t baseSeed = Aux::Random::integer();
+
+	const count windowSize = 16 * omp_get_max_threads();
+	std::vector<std::vector<std::pair<node, node>>> unitEdges(windowSize);
+	EdgeBatch batch;
+
+	Aux::SignalHandler handler;
+
+	for (index windowBegin = 0; windowBegin < units.size(); windowBegin += windowSize) {
+		handler.assureRunning();
+		const index windowEnd = std::min<index>(units.size(), windowBegin + windowSize);
+
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (omp_index i = windowBegin; i < static_cast<omp_index>(windowEnd); ++i) {
+			const WorkUnit &unit = units[i];
+			std::mt19937_64 urng(Aux::Random::streamSeed(baseSeed, i));
+			auto &edges = unitEdges[i - windowBegin];
+			edges.clear();
+
+			auto addEdge = [&](node u, node v) {
+				edges.emplace_back(u, v);
+			};
+
+			if (unit.vBegin == none) {
+				for (node u = unit.uBegin; u < unit.uEnd; ++u)
+					generateRow(urng, u, u + 1, n, addEdge);
+			} else {
+				generateRow(urng, unit.uBegin, unit.vBegin, unit.vEnd, addEdge);
 			}
 		}
 
-		return gB.toGraph(true,true);
+		// units cover consecutive rows (or consecutive segments of a row),
+		// hence emitting them in order yields a sorted stream
+		batch.clear();
+		for (index i = windowBegin; i < windowEnd; ++i) {
+			for (const auto &e : unitEdges[i - windowBegin])
+				batch.emplace_back(e.first, e.second, defaultEdgeWeight);
+		}
+		if (!batch.empty())
+			handle(batch);
 	}
+}
 
 } /* namespace NetworKit */
@@ -8,7 +8,12 @@
 #ifndef CHUNGLU_H_
 #define CHUNGLU_H_
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 #include "StaticDegreeSequenceGenerator.h"
+#include "EdgeStreamGenerator.h"
 #include "../auxiliary/Random.h"
 
 namespace NetworKit {
@@ -28,9 +33,19 @@ namespace NetworKit {
  * http://aric.hagberg.org/papers/miller-2011-efficient.pdf .
  * It gives a complexity of O(n+m) as opposed to quadratic.
  *
+ * The rows of the (sorted) adjacency matrix are grouped into work units
+ * of roughly the same expected number of candidates; rows of heavy nodes
+ * are split into several column segments. Units are processed in parallel
+ * and each unit draws from its own random stream, derived from a single
+ * seed taken from @ref Aux::Random. Hence, for a fixed seed the generated
+ * graph does not depend on the number of threads.
+ *
+ * The generator can also stream its edges without building a Graph (see
+ * @ref EdgeStreamGenerator); for the same seed the stream contains the
+ * edges of @ref generate.
  */
 
-class ChungLuGenerator: public StaticDegreeSequenceGenerator {
+class ChungLuGenerator: public StaticDegreeSequenceGenerator, public EdgeStreamGenerator {
 protected:
 	count sum_deg;
 	count n;
@@ -42,6 +57,71 @@ public:
 	 * Generates graph with expected degree sequence seq.
 	 */
 	virtual Graph generate();
+
+	count numberOfNodes() const override { return n; }
+
+	bool emitsSortedEdges() const override { return true; }
+
+	/**
+	 * Streams the edges sorted by (u, v) with u < v. Work units are processed
+	 * in parallel in windows of a few units per thread, so only the edges of
+	 * the current window are kept in memory.
+	 */
+	void forEdgeBatches(const EdgeBatchHandle& handle) override;
+
+private:
+	//! Expected number of candidate edges a work unit is aiming for
+	static constexpr count unitGrain = 4096;
+
+	/**
+	 * Rows [uBegin, uEnd) of the upper triangle; if vBegin != none the unit
+	 * covers only the columns [vBegin, vEnd) of the single row uBegin.
+	 */
+	struct WorkUnit {
+		node uBegin;
+		node uEnd;
+		node vBegin;
+		node vEnd;
+	};
+
+	std::vector<WorkUnit> computeWorkUnits() const;
+
+	/**
+	 * Runs the skipping loop of Miller and Hagberg for row @a u over the
+	 * columns [vBegin, vEnd) and calls @a handle(u, v) for every edge.
+	 * As seq is sorted, the acceptance probability is non-increasing along
+	 * the row and the loop may start at any column.
+	 */
+	template <typename Handle>
+	void generateRow(std::mt19937_64 &urng, node u, node vBegin, node vEnd, Handle handle) const {
+		std::uniform_real_distribution<double> skipDistr{std::nextafter(0.0, 1.0), std::nextafter(1.0, 2.0)};
+		std::uniform_real_distribution<double> acceptDistr{};
+
+		node v = vBegin;
+		/* Apparently it is necessary to include all these casts for
+		 * the probability to be properly calculated */
+		double p = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
+
+		while (v < vEnd && p > 0) {
+			if (p != 1.0) {
+				/* Calculate the distance to the next potential neighbour*/
+				const double skip = std::floor(std::log(skipDistr(urng)) / std::log1p(-p));
+				if (skip >= static_cast<double>(vEnd - v))
+					break;
+				v += static_cast<node>(skip);
+			}
+
+			double q = std::min(((double) seq[u]) * ((double) seq[v]) / sum_deg, 1.0);
+			/* The potential neighbour was selected with the probability p.
+			 * In order to see if this neighbour should be rejected or accepted
+			 * we correct the probability using q */
+			if (acceptDistr(urng) < q / p) {
+				handle(u, v);
+			}
+			p = q;
+			v++;
+		}
+	}
 };
 
 } /* namespace NetworKit */
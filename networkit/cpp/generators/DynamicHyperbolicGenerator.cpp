@@ -5,7 +5,9 @@
  *      Author: moritzl
  */
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 
 #include "DynamicHyperbolicGenerator.h"
 #include "HyperbolicGenerator.h"
@@ -67,16 +69,19 @@ void DynamicHyperbolicGenerator::initializePoints() {
 }
 
 void DynamicHyperbolicGenerator::initializeMovement() {
+	// nodes that already have movement vectors keep them
+	const index firstNode = angularMovement.size();
 	angularMovement.resize(nodeCount);
 	radialMovement.resize(nodeCount);
 	int scale = 10;
-	for (index i = 0; i < nodeCount; i++) {
+	for (index i = firstNode; i < nodeCount; i++) {
 		angularMovement[i] = Aux::Random::real(-moveDistance, moveDistance);
 		radialMovement[i] = Aux::Random::real(-scale*moveDistance, scale*moveDistance);
 	}
 }
 
 void DynamicHyperbolicGenerator::initializeQuadTree() {
+	quad = Quadtree<index, false>(R, false, alpha);
 	for (index i = 0; i < nodeCount; i++) {
 		assert(radii[i] < R);
 		quad.addContent(i, angles[i], radii[i]);
@@ -120,6 +125,41 @@ void DynamicHyperbolicGenerator::recomputeBands() {
 	INFO("Filled Bands");
 }
 
+void DynamicHyperbolicGenerator::insertIntoBands(index firstNewNode) {
+	auto byAngle = [](const Point2D<double> &a, const Point2D<double> &b) {
+		return a.getX() < b.getX() || (a.getX() == b.getX() && a.getY() < b.getY());
+	};
+
+	vector<Point2D<double>> newPoints;
+	newPoints.reserve(nodeCount - firstNewNode);
+	for (index i = firstNewNode; i < nodeCount; i++) {
+		newPoints.emplace_back(angles[i], radii[i], i);
+	}
+	Aux::Parallel::sort(newPoints.begin(), newPoints.end(), byAngle);
+
+	// same assignment as in recomputeBands(); each band is merged independently
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index j = 0; j < static_cast<omp_index>(bands.size()); j++) {
+		vector<Point2D<double>> added;
+		for (const Point2D<double> &point : newPoints) {
+			if (point.getY() >= bandRadii[j] && point.getY() <= bandRadii[j+1]) {
+				added.push_back(point);
+			}
+		}
+		if (added.empty()) continue;
+
+		vector<Point2D<double>> merged;
+		merged.reserve(bands[j].size() + added.size());
+		std::merge(bands[j].begin(), bands[j].end(), added.begin(), added.end(), std::back_inserter(merged), byAngle);
+		bands[j].swap(merged);
+
+		bandAngles[j].resize(bands[j].size());
+		for (index i = 0; i < bands[j].size(); i++) {
+			bandAngles[j][i] = bands[j][i].getX();
+		}
+	}
+}
+
 Graph DynamicHyperbolicGenerator::getGraph() const {
 	/**
 	 * The next call is unnecessarily expensive, since it constructs a new QuadTree / bands.
@@ -164,6 +204,77 @@ std::vector<GraphEvent> DynamicHyperbolicGenerator::generate(count nSteps) {
 	return result;
 }
 
+std::vector<GraphEvent> DynamicHyperbolicGenerator::addNodes(count numNewNodes) {
+	vector<double> newAngles(numNewNodes);
+	vector<double> newRadii(numNewNodes);
+	HyperbolicSpace::fillPoints(newAngles, newRadii, R, alpha);
+	return addNodes(newAngles, newRadii);
+}
+
+std::vector<GraphEvent> DynamicHyperbolicGenerator::addNodes(const std::vector<double> &newAngles, const std::vector<double> &newRadii) {
+	if (!initialized) {
+		throw std::runtime_error("Nodes can only be added to an initialized generator");
+	}
+	if (newAngles.size() != newRadii.size()) {
+		throw std::runtime_error("Number of angles and radii must match");
+	}
+	for (index i = 0; i < newAngles.size(); i++) {
+		if (newRadii[i] < 0 || newRadii[i] >= R || newAngles[i] < 0 || newAngles[i] >= 2*PI) {
+			throw std::runtime_error("New points must lie within the hyperbolic disk");
+		}
+	}
+
+	const index firstNewNode = nodeCount;
+	nodeCount += newAngles.size();
+	angles.insert(angles.end(), newAngles.begin(), newAngles.end());
+	radii.insert(radii.end(), newRadii.begin(), newRadii.end());
+	initializeMovement();
+
+	std::function<double(double)> edgeProb;
+	if (T == 0) {
+		insertIntoBands(firstNewNode);
+	} else {
+		edgeProb = getEdgeProbability();
+		for (index i = firstNewNode; i < nodeCount; i++) {
+			quad.addContent(i, angles[i], radii[i]);
+		}
+	}
+
+	// each pair of new nodes is decided by the query of the larger one
+	vector<vector<index> > newNeighbours(nodeCount - firstNewNode);
+	#pragma omp parallel for schedule(guided)
+	for (omp_index i = firstNewNode; i < static_cast<omp_index>(nodeCount); i++) {
+		vector<index> near;
+		if (T == 0) {
+			near = getNeighborsInBands(i, true);
+		} else {
+			Point2D<double> q = HyperbolicSpace::polarToCartesian(angles[i], radii[i]);
+			quad.getElementsProbabilistically(q, edgeProb, false, near);
+		}
+
+		auto &neighbours = newNeighbours[i - firstNewNode];
+		for (index j : near) {
+			if (j < static_cast<index>(i)) {
+				neighbours.push_back(j);
+			}
+		}
+		std::sort(neighbours.begin(), neighbours.end());
+		neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+	}
+
+	vector<GraphEvent> result;
+	for (index i = firstNewNode; i < nodeCount; i++) {
+		result.emplace_back(GraphEvent::NODE_ADDITION, i);
+	}
+	for (index i = firstNewNode; i < nodeCount; i++) {
+		for (index j : newNeighbours[i - firstNewNode]) {
+			result.emplace_back(GraphEvent::EDGE_ADDITION, j, i);
+		}
+	}
+	result.push_back(GraphEvent(GraphEvent::TIME_STEP));
+	return result;
+}
+
 void DynamicHyperbolicGenerator::moveNode(index toMove) {
 	double hyperbolicRadius = radii[toMove];
 
@@ -242,9 +353,7 @@ vector<index> DynamicHyperbolicGenerator::getNeighborsInBands(index i, bool both
 	return near;
 }
 
-void DynamicHyperbolicGenerator::getEventsFromNodeMovement(vector<GraphEvent> &result) {
-	bool suppressLeft = false;
-
+std::function<double(double)> DynamicHyperbolicGenerator::getEdgeProbability() const {
 	//now define lambda
 	double tresholdDistance = R;
 	double beta = 1/T;
@@ -259,6 +368,13 @@ void DynamicHyperbolicGenerator::getEventsFromNodeMovement(vector<GraphEvent> &r
 
 		edgeProb = [beta, tresholdDistance](double distance) -> double {return 1 / (exp(beta*(distance-tresholdDistance)/2)+1);};
 	}
+	return edgeProb;
+}
+
+void DynamicHyperbolicGenerator::getEventsFromNodeMovement(vector<GraphEvent> &result) {
+	bool suppressLeft = false;
+
+	std::function<double(double)> edgeProb = getEdgeProbability();
 
 	count oldStreamMarker = result.size();
 	vector<index> toWiggle;
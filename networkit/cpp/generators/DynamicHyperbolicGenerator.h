@@ -8,6 +8,7 @@
 #ifndef DYNAMICHYPERBOLICGENERATOR_H_
 #define DYNAMICHYPERBOLICGENERATOR_H_
 
+#include <functional>
 #include <map>
 
 #include "DynamicGraphGenerator.h"
@@ -60,6 +61,29 @@ public:
 	 */
 	std::vector<GraphEvent> generate(count nSteps) override;
 
+	/**
+	 * Grows the graph by @a numNewNodes nodes, whose positions are drawn from
+	 * the same distribution as the initial ones. The radius R of the disk is
+	 * not changed, hence the average degree grows with the number of nodes.
+	 *
+	 * The new points are merged into the existing bands (or quadtree for T > 0)
+	 * and only the new points are queried, in parallel. Edges between existing
+	 * nodes are not affected.
+	 *
+	 * @param numNewNodes number of nodes to add
+	 * @return NODE_ADDITION events for the new nodes, followed by EDGE_ADDITION events
+	 * for all edges incident to them and a TIME_STEP event
+	 */
+	std::vector<GraphEvent> addNodes(count numNewNodes);
+
+	/**
+	 * Same as @ref addNodes(count), but with given positions of the new nodes.
+	 *
+	 * @param newAngles angular coordinates of the new nodes
+	 * @param newRadii radial coordinates of the new nodes, smaller than R
+	 */
+	std::vector<GraphEvent> addNodes(const std::vector<double> &newAngles, const std::vector<double> &newRadii);
+
 	/**
 	 * Get the graph corresponding to the current state of the generator. Does not change the generator
 	 *
@@ -90,6 +114,16 @@ private:
 	 */
 	void recomputeBands();
 
+	/**
+	 * Merges the points firstNewNode, ..., nodeCount-1 into the existing bands
+	 */
+	void insertIntoBands(index firstNewNode);
+
+	/**
+	 * Returns the connection probability as a function of the distance
+	 */
+	std::function<double(double)> getEdgeProbability() const;
+
 	vector<index> getNeighborsInBands(index i, bool bothDirections=true);
 
 	/**
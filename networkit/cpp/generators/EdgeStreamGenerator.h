@@ -0,0 +1,59 @@
+/*
+ * EdgeStreamGenerator.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef EDGESTREAMGENERATOR_H_
+#define EDGESTREAMGENERATOR_H_
+
+#include <functional>
+#include <vector>
+
+#include "../graph/Graph.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup generators
+ * Abstract base class for generators that can emit their edges in batches
+ * without building a Graph. Combined with the streaming overloads of the
+ * edge list and binary writers, this allows to write huge synthetic graphs
+ * to disk with bounded memory.
+ */
+class EdgeStreamGenerator {
+public:
+	using EdgeBatch = std::vector<WeightedEdge>;
+	using EdgeBatchHandle = std::function<void(const EdgeBatch&)>;
+
+	virtual ~EdgeStreamGenerator() = default;
+
+	/**
+	 * Returns the number of nodes of the generated graph; all emitted
+	 * node ids are smaller than this value.
+	 */
+	virtual count numberOfNodes() const = 0;
+
+	/**
+	 * Returns true if the emitted weights carry information; otherwise all
+	 * edges are emitted with weight @ref defaultEdgeWeight.
+	 */
+	virtual bool isWeighted() const { return false; }
+
+	/**
+	 * Returns true if the concatenation of all batches is sorted
+	 * lexicographically by (u, v). Adjacency based formats (e.g. the Thrill
+	 * binary format) can only be written from sorted streams.
+	 */
+	virtual bool emitsSortedEdges() const { return false; }
+
+	/**
+	 * Generates the graph and calls @a handle for consecutive batches of
+	 * edges. Each undirected edge {u, v} is emitted exactly once as (u, v)
+	 * with u <= v. The batch passed to @a handle is only valid during the call.
+	 */
+	virtual void forEdgeBatches(const EdgeBatchHandle& handle) = 0;
+};
+
+} /* namespace NetworKit */
+#endif /* EDGESTREAMGENERATOR_H_ */
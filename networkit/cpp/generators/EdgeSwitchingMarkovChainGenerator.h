@@ -18,8 +18,8 @@ namespace NetworKit {
  * graph that is drawn uniformly at random from all graphs with the given degree sequence.
  *
  * Note that at most 10 times the number of edges edge swaps are performed (same number as in the abovementioned implementation) and
- * in order to limit the running time, at most 200 times as many attempts to perform an edge swap are made (as certain degree distributions
- * do not allow edge swaps at all).
+ * in order to limit the running time, at most twice as many attempts to perform an edge swap are made (as certain degree distributions
+ * do not allow edge swaps at all). The swaps are executed in parallel batches by EdgeSwitching.
  */
 class EdgeSwitchingMarkovChainGenerator : public StaticDegreeSequenceGenerator {
 public:
@@ -5,6 +5,8 @@
  *      Author: Henning, Manuel Penschuck <networkit@manuel.jetzt>
  */
 
+#include <omp.h>
+
 #include "ErdosRenyiGenerator.h"
 #include "ErdosRenyiEnumerator.h"
 #include "../graph/GraphBuilder.h"
@@ -29,4 +31,29 @@ Graph ErdosRenyiGenerator::generate() {
 	return builder.toGraph(true, false);
 }
 
+void ErdosRenyiGenerator::forEdgeBatches(const EdgeBatchHandle& handle) {
+	if (directed)
+		throw std::runtime_error("Only undirected Erdos-Renyi graphs can be streamed");
+
+	const count batchSize = count{1} << 16;
+	std::vector<EdgeBatch> batches(omp_get_max_threads());
+
+	ErdosRenyiEnumeratorDefault impl(nNodes, prob, directed);
+	impl.forEdgesParallel([&](int tid, node u, node v) {
+		EdgeBatch& batch = batches[tid];
+		// the enumerator emits u > v
+		batch.emplace_back(v, u, defaultEdgeWeight);
+		if (batch.size() == batchSize) {
+			#pragma omp critical (generators_erdos_renyi_stream_batch)
+			handle(batch);
+			batch.clear();
+		}
+	});
+
+	for (const EdgeBatch& batch : batches) {
+		if (!batch.empty())
+			handle(batch);
+	}
+}
+
 } /* namespace NetworKit */
@@ -9,15 +9,17 @@
 #define ERDOSRENYIGENERATOR_H_
 
 #include "StaticGraphGenerator.h"
+#include "EdgeStreamGenerator.h"
 
 namespace NetworKit {
 /**
  * @ingroup generators
  * Creates G(n, p) graphs.
  *
- * This class is a wrapper to @ref ErdosRenyiEnumerator.
+ * This class is a wrapper to @ref ErdosRenyiEnumerator. Undirected graphs
+ * can also be streamed without building a Graph (see @ref EdgeStreamGenerator).
  */
-class ErdosRenyiGenerator: public StaticGraphGenerator {
+class ErdosRenyiGenerator: public StaticGraphGenerator, public EdgeStreamGenerator {
 public:
 	/**
 	 * Creates random graphs in the G(n,p) model.
@@ -45,6 +47,15 @@ public:
 
 	virtual Graph generate();
 
+	count numberOfNodes() const override { return nNodes; }
+
+	/**
+	 * Streams the edges of an undirected graph; each thread collects its
+	 * edges in a batch of its own. The order of the edges depends on the
+	 * number of threads.
+	 */
+	void forEdgeBatches(const EdgeBatchHandle& handle) override;
+
 private:
 	node nNodes;
 	double prob;
@@ -71,6 +71,12 @@ Graph HyperbolicGenerator::generate() {
 
 Graph HyperbolicGenerator::generate(count n, double R, double alpha, double T) {
 	assert(R > 0);
+	vector<double> angles, radii;
+	samplePoints(n, R, alpha, angles, radii);
+	return generate(angles, radii, R, T);
+}
+
+void HyperbolicGenerator::samplePoints(count n, double R, double alpha, vector<double> &anglecopy, vector<double> &radiicopy) const {
 	vector<double> angles(n);
 	vector<double> radii(n);
 
@@ -84,8 +90,8 @@ Graph HyperbolicGenerator::generate(count n, double R, double alpha, double T) {
 	//can probably be parallelized easily, but doesn't bring much benefit
 	Aux::Parallel::sort(permutation.begin(), permutation.end(), [&angles,&radii](index i, index j){return angles[i] < angles[j] || (angles[i] == angles[j] && radii[i] < radii[j]);});
 
-	vector<double> anglecopy(n);
-	vector<double> radiicopy(n);
+	anglecopy.resize(n);
+	radiicopy.resize(n);
 
 	#pragma omp parallel for
 	for (omp_index j = 0; j < static_cast<omp_index>(n); j++) {
@@ -94,10 +100,10 @@ Graph HyperbolicGenerator::generate(count n, double R, double alpha, double T) {
 	}
 
 	INFO("Generated Points");
-	return generate(anglecopy, radiicopy, R, T);
 }
 
-Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vector<double> &radii, double R) {
+template <typename Handle, typename WindowDone>
+void HyperbolicGenerator::forEdgesCold(const vector<double> &angles, const vector<double> &radii, double R, count windowSize, Handle handle, WindowDone windowDone) {
 	const count n = angles.size();
 	assert(radii.size() == n);
 
@@ -154,60 +160,68 @@ Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vect
 	//2.Insert edges
 	Aux::Timer timer;
 	timer.start();
-	vector<double> empty;
-	GraphBuilder result(n, false, false);
 
-	#pragma omp parallel
-	{
-		index id = omp_get_thread_num();
-		threadtimers[id].start();
-		#pragma omp for schedule(guided) nowait
-		for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
-			const double coshr = cosh(radii[i]);
-			const double sinhr = sinh(radii[i]);
-			count expectedDegree = (4/PI)*n*exp(-(radii[i])/2);
-			vector<index> near;
-			near.reserve(expectedDegree*1.1);
-			Point2D<double> pointV(angles[i], radii[i], i);
-			for(index j = 0; j < bandCount; j++){
-				if(directSwap || bandRadii[j+1] > radii[i]){
-					double minTheta, maxTheta;
-					std::tie (minTheta, maxTheta) = getMinMaxTheta(angles[i], radii[i], bandRadii[j], R);
-					//minTheta = 0;
-					//maxTheta = 2*PI;
-					vector<Point2D<double>> neighborCandidates = getPointsWithinAngles(minTheta, maxTheta, bands[j], bandAngles[j]);
-
-					const count sSize = neighborCandidates.size();
-					for(index w = 0; w < sSize; w++){
-						double deltaPhi = PI - abs(PI-abs(angles[i] - neighborCandidates[w].getX()));
-						if (coshr*cosh(neighborCandidates[w].getY())-sinhr*sinh(neighborCandidates[w].getY())*cos(deltaPhi) <= coshR) {
-							if (neighborCandidates[w].getIndex() != i){
-								near.push_back(neighborCandidates[w].getIndex());
+	for (index windowBegin = 0; windowBegin < n; windowBegin += windowSize) {
+		const index windowEnd = std::min<index>(n, windowBegin + windowSize);
+
+		#pragma omp parallel
+		{
+			index id = omp_get_thread_num();
+			threadtimers[id].start();
+			#pragma omp for schedule(guided) nowait
+			for (omp_index i = windowBegin; i < static_cast<omp_index>(windowEnd); i++) {
+				const double coshr = cosh(radii[i]);
+				const double sinhr = sinh(radii[i]);
+				count expectedDegree = (4/PI)*n*exp(-(radii[i])/2);
+				vector<index> near;
+				near.reserve(expectedDegree*1.1);
+				Point2D<double> pointV(angles[i], radii[i], i);
+				for(index j = 0; j < bandCount; j++){
+					if(directSwap || bandRadii[j+1] > radii[i]){
+						double minTheta, maxTheta;
+						std::tie (minTheta, maxTheta) = getMinMaxTheta(angles[i], radii[i], bandRadii[j], R);
+						//minTheta = 0;
+						//maxTheta = 2*PI;
+						vector<Point2D<double>> neighborCandidates = getPointsWithinAngles(minTheta, maxTheta, bands[j], bandAngles[j]);
+
+						const count sSize = neighborCandidates.size();
+						for(index w = 0; w < sSize; w++){
+							double deltaPhi = PI - abs(PI-abs(angles[i] - neighborCandidates[w].getX()));
+							if (coshr*cosh(neighborCandidates[w].getY())-sinhr*sinh(neighborCandidates[w].getY())*cos(deltaPhi) <= coshR) {
+								if (neighborCandidates[w].getIndex() != static_cast<index>(i)){
+									near.push_back(neighborCandidates[w].getIndex());
+								}
 							}
 						}
 					}
 				}
-			}
-			if (directSwap) {
-				auto newend = std::remove(near.begin(), near.end(), i); //no self loops!
-				if (newend != near.end()) {
-					assert(newend+1 == near.end());
-					assert(*(newend)==i);
-					near.pop_back();//std::remove doesn't remove element but swaps it to the end
-				}
-				result.swapNeighborhood(i, near, empty, false);
-			} else {
-				for (index j : near) {
-					if (j >= n) ERROR("Node ", j, " prospective neighbour of ", i, " does not actually exist. Oops.");
-					if(radii[j] > radii[i] || (radii[j] == radii[i] && angles[j] < angles[i]))
-						result.addHalfEdge(i,j);
+				if (directSwap) {
+					// both directions of each edge are reported
+					for (index j : near)
+						handle(i, j);
+				} else {
+					for (index j : near) {
+						if (j >= n) ERROR("Node ", j, " prospective neighbour of ", i, " does not actually exist. Oops.");
+						if(radii[j] > radii[i] || (radii[j] == radii[i] && angles[j] < angles[i]))
+							handle(i, j);
+					}
 				}
 			}
+			threadtimers[id].stop();
 		}
-		threadtimers[id].stop();
+
+		windowDone(windowBegin, windowEnd);
 	}
 	timer.stop();
 	INFO("Generating Edges took ", timer.elapsedMilliseconds(), " milliseconds.");
+}
+
+Graph HyperbolicGenerator::generateCold(const vector<double> &angles, const vector<double> &radii, double R) {
+	const count n = angles.size();
+	GraphBuilder result(n, false, false);
+	forEdgesCold(angles, radii, R, std::max<count>(n, 1),
+		[&](index i, index j) { result.addHalfEdge(i, j); },
+		[](index, index) {});
 	return result.toGraph(!directSwap, true);
 }
 
@@ -216,6 +230,16 @@ Graph HyperbolicGenerator::generate(const vector<double> &angles, const vector<d
 	if (T == 0) return generateCold(angles, radii, R);
 	assert(T > 0);
 
+	const count n = angles.size();
+	GraphBuilder result(n, false, false);//no direct swap with probabilistic graphs
+	forEdgesProbabilistic(angles, radii, R, T, std::max<count>(n, 1),
+		[&](index i, index j) { result.addHalfEdge(i, j); },
+		[](index, index) {});
+	return result.toGraph(true, true);
+}
+
+template <typename Handle, typename WindowDone>
+void HyperbolicGenerator::forEdgesProbabilistic(const vector<double> &angles, const vector<double> &radii, double R, double T, count windowSize, Handle handle, WindowDone windowDone) {
 	/**
 	 * fill Quadtree
 	 */
@@ -245,23 +269,59 @@ Graph HyperbolicGenerator::generate(const vector<double> &angles, const vector<d
 	assert(beta == beta);
 	auto edgeProb = [beta, R](double distance) -> double {return 1 / (exp(beta*(distance-R)/2)+1);};
 
-	//get Graph
-	GraphBuilder result(n, false, false);//no direct swap with probabilistic graphs
+	//get edges
 	count totalCandidates = 0;
-	#pragma omp parallel for
-	for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
-		vector<index> near;
-		totalCandidates += quad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[i], radii[i]), edgeProb, anglesSorted, near);
-		for (index j : near) {
-			if (j >= n) ERROR("Node ", j, " prospective neighbour of ", i, " does not actually exist. Oops.");
-			if (j > i) {
-				result.addHalfEdge(i, j);
+	for (index windowBegin = 0; windowBegin < n; windowBegin += windowSize) {
+		const index windowEnd = std::min<index>(n, windowBegin + windowSize);
+
+		#pragma omp parallel for
+		for (omp_index i = windowBegin; i < static_cast<omp_index>(windowEnd); i++) {
+			vector<index> near;
+			totalCandidates += quad.getElementsProbabilistically(HyperbolicSpace::polarToCartesian(angles[i], radii[i]), edgeProb, anglesSorted, near);
+			for (index j : near) {
+				if (j >= n) ERROR("Node ", j, " prospective neighbour of ", i, " does not actually exist. Oops.");
+				if (j > static_cast<index>(i)) {
+					handle(i, j);
+				}
 			}
+
 		}
 
+		windowDone(windowBegin, windowEnd);
 	}
 	DEBUG("Candidates tested: ", totalCandidates);
-	return result.toGraph(true, true);
+}
 
+void HyperbolicGenerator::forEdgeBatches(const EdgeBatchHandle& handle) {
+	vector<double> angles, radii;
+	samplePoints(nodeCount, R, alpha, angles, radii);
+
+	// the edges of a window of nodes are collected per node, so the order
+	// of the stream does not depend on the number of threads
+	const count windowSize = 1 << 16;
+	vector<vector<index>> near(std::min<count>(windowSize, nodeCount));
+	index offset = 0;
+	EdgeBatch batch;
+
+	auto collect = [&](index i, index j) {
+		if (!directSwap || i < j)
+			near[i - offset].push_back(j);
+	};
+	auto emit = [&](index windowBegin, index windowEnd) {
+		batch.clear();
+		for (index i = windowBegin; i < windowEnd; ++i) {
+			for (index j : near[i - windowBegin])
+				batch.emplace_back(std::min(i, j), std::max(i, j), defaultEdgeWeight);
+			near[i - windowBegin].clear();
+		}
+		offset = windowEnd;
+		if (!batch.empty())
+			handle(batch);
+	};
+
+	if (temperature == 0)
+		forEdgesCold(angles, radii, R, windowSize, collect, emit);
+	else
+		forEdgesProbabilistic(angles, radii, R, temperature, windowSize, collect, emit);
 }
 }
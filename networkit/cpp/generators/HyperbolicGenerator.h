@@ -13,12 +13,19 @@
 #include <vector>
 #include "../geometric/HyperbolicSpace.h"
 #include "StaticGraphGenerator.h"
+#include "EdgeStreamGenerator.h"
 #include "../auxiliary/Timer.h"
 #include "quadtree/Quadtree.h"
 
 namespace NetworKit {
 
-class HyperbolicGenerator: public StaticGraphGenerator {
+/**
+ * @ingroup generators
+ * Generates random hyperbolic graphs. The edges can also be streamed without
+ * building a Graph (see @ref EdgeStreamGenerator); then only the node
+ * positions and the edges of a window of nodes are kept in memory.
+ */
+class HyperbolicGenerator: public StaticGraphGenerator, public EdgeStreamGenerator {
 	friend class DynamicHyperbolicGenerator;
 public:
 
@@ -45,6 +52,17 @@ public:
 	 */
 	Graph generate();
 
+	count numberOfNodes() const override {
+		return nodeCount;
+	}
+
+	/**
+	 * Streams the edges of a graph with the parameters specified in the
+	 * constructor. For T = 0 and the same seed, the stream contains the
+	 * edges of @ref generate.
+	 */
+	void forEdgeBatches(const EdgeBatchHandle& handle) override;
+
 	/**
 	 * Set the capacity of a quadtree leaf.
 	 *
@@ -83,6 +101,26 @@ private:
 
 	Graph generate(count n, double R, double alpha, double T = 0);
 
+	/**
+	 * Samples n points and sorts them by angle.
+	 */
+	void samplePoints(count n, double R, double alpha, vector<double> &angles, vector<double> &radii) const;
+
+	/**
+	 * Calls handle(i, j) for each edge {i, j} of the threshold model. The
+	 * nodes are processed in parallel in windows of windowSize consecutive
+	 * nodes; all calls for node i are made by the same thread. After each
+	 * window, windowDone(begin, end) is called by the calling thread.
+	 */
+	template <typename Handle, typename WindowDone>
+	void forEdgesCold(const vector<double> &angles, const vector<double> &radii, double R, count windowSize, Handle handle, WindowDone windowDone);
+
+	/**
+	 * Same as @ref forEdgesCold for temperature T > 0.
+	 */
+	template <typename Handle, typename WindowDone>
+	void forEdgesProbabilistic(const vector<double> &angles, const vector<double> &radii, double R, double T, count windowSize, Handle handle, WindowDone windowDone);
+
 	static vector<vector<double> > getBandAngles(const vector<vector<Point2D<double>>> &bands) {
 		vector<vector<double>> bandAngles(bands.size());
 		#pragma omp parallel for
@@ -5,17 +5,208 @@
 #include <algorithm>
 #include <random>
 #include <numeric>
+#include <omp.h>
 
 #include "LFRGenerator.h"
 #include "PowerlawDegreeSequence.h"
 #include "EdgeSwitchingMarkovChainGenerator.h"
 #include "PubWebGenerator.h"
+#include "HavelHakimiGenerator.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/SignalHandling.h"
 #include "../auxiliary/Parallel.h"
+#include "../graph/GraphBuilder.h"
+#include "../randomization/EdgeSwitching.h"
+
+namespace {
+
+using NetworKit::count;
+using NetworKit::index;
+using NetworKit::node;
+using NetworKit::omp_index;
+using NetworKit::none;
+using NodePair = std::pair<node, node>;
+
+//! Number of draws per random stream when sampling sequences in parallel
+constexpr count drawChunkSize = 4096;
+
+//! Communities with more stubs are generated by the configuration model, one after another and each using all threads
+constexpr count largeCommunityStubs = 1 << 20;
+
+//! Number of parallel rewiring rounds after which remaining invalid edges are dropped
+constexpr count maxRewiringRounds = 100;
+
+// Shuffles @a values in parallel by sorting them by random keys.
+void parallelShuffle(std::vector<index> &values, uint64_t seed) {
+	std::vector<std::pair<uint64_t, index>> keyed(values.size());
+
+	#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(values.size()); ++i) {
+		keyed[i] = {Aux::Random::streamSeed(seed, i), values[i]};
+	}
+
+	Aux::Parallel::sort(keyed.begin(), keyed.end());
+
+	#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(values.size()); ++i) {
+		values[i] = keyed[i].second;
+	}
+}
+
+/*
+ * Generates a simple graph with (approximately) the given degree sequence using the configuration model: the stubs are matched
+ * by a parallel random permutation. Then loops, multi-edges and edges for which isForbidden returns true are rewired in parallel
+ * rounds: each invalid edge chooses a random partner edge and both swap their endpoints. Conflicts are resolved deterministically
+ * (a partner is granted to the invalid edge with the smallest index and invalid edges are never partners), so the result only
+ * depends on the seed. Edges that are still invalid after maxRewiringRounds are dropped, their number is returned in @a dropped.
+ *
+ * Returns the edges as (u, v) with u < v.
+ */
+template <typename Forbidden>
+std::vector<NodePair> randomSimpleGraph(const std::vector<count> &degrees, uint64_t seed, count &dropped, Forbidden isForbidden) {
+	std::vector<index> offset(degrees.size() + 1, 0);
+	for (index u = 0; u < degrees.size(); ++u) {
+		offset[u + 1] = offset[u] + degrees[u];
+	}
+
+	std::vector<NodePair> edges;
+	dropped = 0;
+
+	const uint64_t matchingSeed = Aux::Random::streamSeed(seed, 0);
+	const uint64_t rewiringSeed = Aux::Random::streamSeed(seed, 1);
+
+	{ // match the stubs
+		std::vector<std::pair<uint64_t, node>> stubs(offset.back());
+
+		#pragma omp parallel for schedule(guided)
+		for (omp_index u = 0; u < static_cast<omp_index>(degrees.size()); ++u) {
+			for (index i = offset[u]; i < offset[u + 1]; ++i) {
+				stubs[i] = {Aux::Random::streamSeed(matchingSeed, i), u};
+			}
+		}
+
+		Aux::Parallel::sort(stubs.begin(), stubs.end());
+
+		// if the sum of the degrees is odd, the last stub stays unmatched
+		edges.resize(stubs.size() / 2);
+
+		#pragma omp parallel for
+		for (omp_index e = 0; e < static_cast<omp_index>(edges.size()); ++e) {
+			edges[e] = std::minmax(stubs[2 * e].second, stubs[2 * e + 1].second);
+		}
+	}
+
+	const count m = edges.size();
+	std::vector<bool> isInvalid;
+	std::vector<uint8_t> isRewired;
+	std::vector<index> invalid;
+	std::vector<std::pair<index, index>> requests;
+	std::vector<NodePair> rewired;
+
+	Aux::Parallel::sort(edges.begin(), edges.end());
+
+	for (count round = 0; ; ++round) {
+		invalid.clear();
+		for (index e = 0; e < m; ++e) {
+			const node u = edges[e].first, v = edges[e].second;
+			if (u == v || (e > 0 && edges[e - 1] == edges[e]) || isForbidden(u, v)) {
+				invalid.push_back(e);
+			}
+		}
+
+		if (invalid.empty()) break;
+
+		if (round == maxRewiringRounds || invalid.size() == m) {
+			dropped = invalid.size();
+			for (index e : invalid) {
+				edges[e].first = none;
+			}
+			edges.erase(std::remove_if(edges.begin(), edges.end(), [](const NodePair &e) { return e.first == none; }), edges.end());
+			break;
+		}
+
+		isInvalid.assign(m, false);
+		for (index e : invalid) {
+			isInvalid[e] = true;
+		}
+
+		// each invalid edge requests a random partner edge
+		const uint64_t roundSeed = Aux::Random::streamSeed(rewiringSeed, round);
+		requests.resize(invalid.size());
+
+		#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(invalid.size()); ++i) {
+			requests[i] = {Aux::Random::streamSeed(roundSeed, invalid[i]) % m, invalid[i]};
+		}
+
+		Aux::Parallel::sort(requests.begin(), requests.end());
+
+		// bytes instead of bools, as the flags are written in parallel
+		isRewired.assign(m, 0);
+
+		#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(requests.size()); ++i) {
+			const index partner = requests[i].first, e = requests[i].second;
+			if (isInvalid[partner] || (i > 0 && requests[i - 1].first == partner)) continue;
+
+			const node u = edges[e].first, v = edges[e].second;
+			const node x = edges[partner].first, y = edges[partner].second;
+
+			if (Aux::Random::streamSeed(roundSeed, m + e) & 1) {
+				edges[e] = std::minmax(u, x);
+				edges[partner] = std::minmax(v, y);
+			} else {
+				edges[e] = std::minmax(u, y);
+				edges[partner] = std::minmax(v, x);
+			}
+			isRewired[e] = 1;
+			isRewired[partner] = 1;
+		}
+
+		// the other edges are still sorted, so only the rewired edges are sorted and merged into them
+		rewired.clear();
+		index kept = 0;
+		for (index e = 0; e < m; ++e) {
+			if (isRewired[e]) {
+				rewired.push_back(edges[e]);
+			} else {
+				edges[kept++] = edges[e];
+			}
+		}
+		Aux::Parallel::sort(rewired.begin(), rewired.end());
+		std::copy(rewired.begin(), rewired.end(), edges.begin() + kept);
+		std::inplace_merge(edges.begin(), edges.begin() + kept, edges.end());
+	}
+
+	return edges;
+}
+
+/*
+ * Generates a simple graph with the given degree sequence with the Havel-Hakimi generator and randomizes it with EdgeSwitching
+ * and the same number of switches as the EdgeSwitchingMarkovChainGenerator. The switches use the random streams of @a seed, as this
+ * is called in parallel for the communities.
+ *
+ * Returns the edges as (u, v) with u < v.
+ */
+std::vector<NodePair> switchedHavelHakimiGraph(const std::vector<count> &degrees, uint64_t seed) {
+	NetworKit::EdgeSwitching switching(NetworKit::HavelHakimiGenerator(degrees, true).generate(), 10.0);
+	switching.setSeed(seed);
+	switching.run();
+
+	const NetworKit::Graph randomized = switching.getGraph();
+	std::vector<NodePair> edges;
+	edges.reserve(randomized.numberOfEdges());
+	randomized.forEdges([&](node u, node v) {
+		edges.push_back(std::minmax(u, v));
+	});
+
+	return edges;
+}
+
+} // namespace
 
 NetworKit::LFRGenerator::LFRGenerator(NetworKit::count n) :
-n(n), hasDegreeSequence(false), hasCommunitySizeSequence(false), hasInternalDegreeSequence(false), hasGraph(false), hasPartition(false) { }
+n(n), scalableMode(false), hasDegreeSequence(false), hasCommunitySizeSequence(false), hasInternalDegreeSequence(false), hasGraph(false), hasPartition(false) { }
 
 void NetworKit::LFRGenerator::setDegreeSequence(std::vector< NetworKit::count > degreeSequence) {
 	if (degreeSequence.size() != n) throw std::runtime_error("The degree sequence must have as many entries as there are nodes");
@@ -47,23 +238,39 @@ void NetworKit::LFRGenerator::generatePowerlawCommunitySizeSequence(NetworKit::c
 	PowerlawDegreeSequence communityDegreeSequenceGen(minCommunitySize, maxCommunitySize, communitySizeExp);
 	communityDegreeSequenceGen.run();
 
+	const double expectedCommunitySize = communityDegreeSequenceGen.getExpectedAverageDegree();
+
 	count sumCommunitySizes = 0;
 	communitySizeSequence.clear();
 
+	std::vector<count> newSizes;
 	while (true) {
-		count newSize = communityDegreeSequenceGen.getDegree();
-		if (sumCommunitySizes + newSize <= n) {
-			communitySizeSequence.push_back(newSize);
-			sumCommunitySizes += newSize;
-		} else { // if the new community doesn't fit anymore, increase the smallest community to fill the gap and exit the loop
-			*std::min_element(communitySizeSequence.begin(), communitySizeSequence.end()) += n - sumCommunitySizes;
+		// draw a batch of sizes in parallel that most likely covers the remaining nodes
+		newSizes.resize(1.1 * (n - sumCommunitySizes) / expectedCommunitySize + 16);
+		const uint64_t baseSeed = Aux::Random::integer();
 
-			break;
+		#pragma omp parallel for
+		for (omp_index chunk = 0; chunk < static_cast<omp_index>((newSizes.size() + drawChunkSize - 1) / drawChunkSize); ++chunk) {
+			std::mt19937_64 urng(Aux::Random::streamSeed(baseSeed, chunk));
+			const index end = std::min<index>(newSizes.size(), (chunk + 1) * drawChunkSize);
+			for (index i = chunk * drawChunkSize; i < end; ++i) {
+				newSizes[i] = communityDegreeSequenceGen.getDegree(urng);
+			}
 		}
-	}
 
-	hasCommunitySizeSequence = true;
-	this->hasPartition = false;
+		for (count newSize : newSizes) {
+			if (sumCommunitySizes + newSize <= n) {
+				communitySizeSequence.push_back(newSize);
+				sumCommunitySizes += newSize;
+			} else { // if the new community doesn't fit anymore, increase the smallest community to fill the gap and exit the loop
+				*std::min_element(communitySizeSequence.begin(), communitySizeSequence.end()) += n - sumCommunitySizes;
+
+				hasCommunitySizeSequence = true;
+				this->hasPartition = false;
+				return;
+			}
+		}
+	}
 }
 
 void NetworKit::LFRGenerator::setMu(double mu) {
@@ -110,13 +317,22 @@ void NetworKit::LFRGenerator::setMuWithBinomialDistribution(double mu) {
 
 	internalDegreeSequence.resize(n);
 
-	auto &gen = Aux::Random::getURNG();
-	std::binomial_distribution<count> binDist;
+	const uint64_t baseSeed = Aux::Random::integer();
 
-	for (node u = 0; u < n; ++u) {
-		if (degreeSequence[u] == 0) continue;
+	#pragma omp parallel for
+	for (omp_index chunk = 0; chunk < static_cast<omp_index>((n + drawChunkSize - 1) / drawChunkSize); ++chunk) {
+		std::mt19937_64 urng(Aux::Random::streamSeed(baseSeed, chunk));
+		std::binomial_distribution<count> binDist;
+		const node end = std::min<node>(n, (chunk + 1) * drawChunkSize);
+
+		for (node u = chunk * drawChunkSize; u < end; ++u) {
+			if (degreeSequence[u] == 0) {
+				internalDegreeSequence[u] = 0;
+				continue;
+			}
 
-		internalDegreeSequence[u] = binDist(gen, std::binomial_distribution<count>::param_type(degreeSequence[u], 1.0 - mu));
+			internalDegreeSequence[u] = binDist(urng, std::binomial_distribution<count>::param_type(degreeSequence[u], 1.0 - mu));
+		}
 	}
 
 	hasInternalDegreeSequence = true;
@@ -129,16 +345,20 @@ void NetworKit::LFRGenerator::setPartition(NetworKit::Partition zeta) {
 	this->hasCommunitySizeSequence = false;
 }
 
-NetworKit::Graph NetworKit::LFRGenerator::generateIntraClusterGraph(std::vector< NetworKit::count > intraDegreeSequence, const std::vector<NetworKit::node> &localToGlobalNode) {
-	// check if sum of degrees is even and fix if necessary
-	count intraDegSum = std::accumulate(intraDegreeSequence.begin(), intraDegreeSequence.end(), 0);
+void NetworKit::LFRGenerator::setScalableMode(bool scalable) {
+	this->scalableMode = scalable;
+}
 
-	DEBUG("Possibly correcting the degree sequence");
+void NetworKit::LFRGenerator::makeIntraDegreeSumEven(std::vector< NetworKit::count > &intraDegreeSequence, const std::vector<NetworKit::node> &localToGlobalNode, std::mt19937_64 &urng) {
+	count intraDegSum = std::accumulate(intraDegreeSequence.begin(), intraDegreeSequence.end(), count{0});
+
+	std::uniform_int_distribution<index> indexDist(0, intraDegreeSequence.size() - 1);
+	std::bernoulli_distribution coin;
 
 	for (index j = 0; intraDegSum % 2 != 0 && j < intraDegreeSequence.size(); ++j) {
-		index i = Aux::Random::index(intraDegreeSequence.size());
+		index i = indexDist(urng);
 		node u = localToGlobalNode[i];
-		if (Aux::Random::real() >= 0.5) {
+		if (coin(urng)) {
 			if (intraDegreeSequence[i] < intraDegreeSequence.size() - 1 && intraDegreeSequence[i] < degreeSequence[u]) {
 				TRACE("Making degree distribution even by increasing intra-degree of node ", u);
 				++intraDegreeSequence[i];
@@ -154,9 +374,15 @@ NetworKit::Graph NetworKit::LFRGenerator::generateIntraClusterGraph(std::vector<
 			}
 		}
 	}
+}
+
+NetworKit::Graph NetworKit::LFRGenerator::generateIntraClusterGraph(std::vector< NetworKit::count > intraDegreeSequence, const std::vector<NetworKit::node> &localToGlobalNode) {
+	// check if sum of degrees is even and fix if necessary
+	DEBUG("Possibly correcting the degree sequence");
+	makeIntraDegreeSumEven(intraDegreeSequence, localToGlobalNode, Aux::Random::getURNG());
 
 	DEBUG("Generating intra-cluster graph");
-		EdgeSwitchingMarkovChainGenerator intraGen(intraDegreeSequence, true);
+	EdgeSwitchingMarkovChainGenerator intraGen(intraDegreeSequence, true);
 	/* even though the sum is even the degree distribution isn't necessarily realizable.
 	Disabling the check means that some edges might not be created because of this but at least we will get a graph. */
 	return  intraGen.generate();
@@ -267,17 +493,17 @@ std::vector<std::vector<NetworKit::node>> NetworKit::LFRGenerator::assignNodesTo
 		communityNodeList.clear();
 		communityNodeList.resize(communitySizeSequence.size());
 
-		std::vector<count> communitySelection;
+		std::vector<index> communitySelection(n);
 		{ // generate a random permutation of size(c) copies of each community id c
-			communitySelection.reserve(n);
+			std::vector<index> offset(communitySizeSequence.size() + 1, 0);
+			std::partial_sum(communitySizeSequence.begin(), communitySizeSequence.end(), offset.begin() + 1);
 
-			for (index i = 0; i < communitySizeSequence.size(); ++i) {
-				for (node u = 0; u < communitySizeSequence[i]; ++u) {
-					communitySelection.push_back(i);
-				}
+			#pragma omp parallel for schedule(guided)
+			for (omp_index i = 0; i < static_cast<omp_index>(communitySizeSequence.size()); ++i) {
+				std::fill(communitySelection.begin() + offset[i], communitySelection.begin() + offset[i + 1], i);
 			}
 
-			std::shuffle(communitySelection.begin(), communitySelection.end(), Aux::Random::getURNG());
+			parallelShuffle(communitySelection, Aux::Random::integer());
 		}
 
 		// how many nodes are still missing in the community
@@ -359,13 +585,11 @@ std::vector<std::vector<NetworKit::node>> NetworKit::LFRGenerator::assignNodesTo
 
 
 
-void NetworKit::LFRGenerator::run() {
+void NetworKit::LFRGenerator::generateEdges(const std::function<void(const std::vector<NodePair>&)> &intraHandle, std::vector<NodePair> &interEdges) {
 	if (!hasDegreeSequence) throw std::runtime_error("Error, the degree sequence needs to be set first");
 	if (!(hasCommunitySizeSequence || hasPartition)) throw std::runtime_error("Error, either the community size sequence or the partition needs to be set first");
 	if (!hasInternalDegreeSequence) throw std::runtime_error("Error, mu needs to be set first");
 
-	hasRun = false;
-
 	Aux::SignalHandler handler;
 
 	auto minMaxInternalDegreeIt = std::minmax_element(internalDegreeSequence.begin(), internalDegreeSequence.end());
@@ -416,10 +640,6 @@ void NetworKit::LFRGenerator::run() {
 	}
 
 	hasGraph = false;
-	// initialize the result graph
-	G = Graph(n);
-
-	handler.assureRunning();
 
 	// a list of nodes for each community
 	std::vector<std::vector<node> > communityNodeList;
@@ -442,35 +662,100 @@ void NetworKit::LFRGenerator::run() {
 		}
 	} else {
 		communityNodeList.resize(zeta.upperBound());
-		G.forNodes([&](node u) {
+		for (node u = 0; u < n; ++u) {
 			communityNodeList[zeta[u]].push_back(u);
-		});
+		}
 	}
 
+	handler.assureRunning();
+
 	// generate intra-cluster edges
-	#pragma omp parallel for // note: parallelization only works because the communities are non-overlapping
-	for (omp_index i = 0; i < static_cast<omp_index>(communityNodeList.size()); ++i) {
-		const auto &communityNodes = communityNodeList[i];
-		if (communityNodes.empty()) continue;
+	if (scalableMode) {
+		const uint64_t intraSeed = Aux::Random::integer();
+		std::vector<count> droppedEdges(communityNodeList.size(), 0);
+
+		// small communities are generated by the Havel-Hakimi generator and edge switching, in parallel,
+		// large communities by the configuration model, one after another and each using all threads
+		auto generateCommunity = [&](index i, bool large) {
+			const auto &communityNodes = communityNodeList[i];
+
+			std::vector<count> intraDeg;
+			intraDeg.reserve(communityNodes.size());
+
+			for (node u : communityNodes) {
+				intraDeg.push_back(internalDegreeSequence[u]);
+			}
+
+			std::mt19937_64 urng(Aux::Random::streamSeed(intraSeed, 2 * i));
+			makeIntraDegreeSumEven(intraDeg, communityNodes, urng);
+
+			std::vector<NodePair> edges;
+			if (large) {
+				edges = randomSimpleGraph(intraDeg, Aux::Random::streamSeed(intraSeed, 2 * i + 1), droppedEdges[i],
+					[](node, node) { return false; });
+			} else {
+				edges = switchedHavelHakimiGraph(intraDeg, Aux::Random::streamSeed(intraSeed, 2 * i + 1));
+			}
+
+			for (auto &e : edges) {
+				e = std::minmax(communityNodes[e.first], communityNodes[e.second]);
+			}
+
+			intraHandle(edges);
+		};
+
+		auto stubs = [&](index i) {
+			count sum = 0;
+			for (node u : communityNodeList[i]) sum += internalDegreeSequence[u];
+			return sum;
+		};
 
-		std::vector<count> intraDeg;
-		intraDeg.reserve(communityNodes.size());
+		std::vector<index> smallCommunities;
+		for (index i = 0; i < communityNodeList.size(); ++i) {
+			if (communityNodeList[i].empty()) continue;
+
+			if (stubs(i) > largeCommunityStubs) {
+				generateCommunity(i, true);
+				handler.assureRunning();
+			} else {
+				smallCommunities.push_back(i);
+			}
+		}
 
-		for (node u : communityNodes) {
-			intraDeg.push_back(internalDegreeSequence[u]);
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (omp_index j = 0; j < static_cast<omp_index>(smallCommunities.size()); ++j) {
+			if (!handler.isRunning()) continue;
+			generateCommunity(smallCommunities[j], false);
 		}
 
 		handler.assureRunning();
 
-		Graph intraG = generateIntraClusterGraph(std::move(intraDeg), communityNodes);
+		const count dropped = std::accumulate(droppedEdges.begin(), droppedEdges.end(), count{0});
+		if (dropped > 0) {
+			WARN("Dropped ", dropped, " intra-cluster edges that could not be rewired to form a simple graph");
+		}
+	} else {
+		#pragma omp parallel for schedule(dynamic, 1) // note: parallelization only works because the communities are non-overlapping
+		for (omp_index i = 0; i < static_cast<omp_index>(communityNodeList.size()); ++i) {
+			const auto &communityNodes = communityNodeList[i];
+			if (communityNodes.empty() || !handler.isRunning()) continue;
+
+			std::vector<count> intraDeg;
+			intraDeg.reserve(communityNodes.size());
 
-		handler.assureRunning();
+			for (node u : communityNodes) {
+				intraDeg.push_back(internalDegreeSequence[u]);
+			}
 
-		#pragma omp critical (generators_lfr_intra_to_global)
-		{ // FIXME: if we used a graph builder here, we would not need any critical section (only needed for global edge counter)
+			Graph intraG = generateIntraClusterGraph(std::move(intraDeg), communityNodes);
+
+			std::vector<NodePair> edges;
+			edges.reserve(intraG.numberOfEdges());
 			intraG.forEdges([&](node i, node j) {
-				G.addEdge(communityNodes[i], communityNodes[j]);
+				edges.push_back(std::minmax(communityNodes[i], communityNodes[j]));
 			});
+
+			intraHandle(edges);
 		}
 
 		handler.assureRunning();
@@ -479,37 +764,104 @@ void NetworKit::LFRGenerator::run() {
 	// generate inter-cluster edges
 	std::vector<count> externalDegree(n);
 
-	G.parallelForNodes([&](node u) {
+	#pragma omp parallel for
+	for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
 		externalDegree[u] = degreeSequence[u] - internalDegreeSequence[u];
-	});
+	}
 
 	handler.assureRunning();
 
-	Graph interG = generateInterClusterGraph(externalDegree);
+	interEdges.clear();
 
-	handler.assureRunning();
+	if (scalableMode) {
+		count dropped = 0;
+		interEdges = randomSimpleGraph(externalDegree, Aux::Random::integer(), dropped, [&](node u, node v) {
+			return zeta[u] == zeta[v];
+		});
 
-	count edgesRemoved = 0;
-	interG.forEdges([&](node u, node v) {
-#ifndef NDEBUG // check if edge rewiring actually worked.
-		if (!G.hasEdge(u, v)) {
-#endif
-			G.addEdge(u, v);
-#ifndef NDEBUG
-		} else {
-			++edgesRemoved;
+		if (dropped > 0) {
+			WARN("Dropped ", dropped, " inter-cluster edges that could not be rewired to connect different communities");
 		}
-#endif
-	});
+	} else {
+		Graph interG = generateInterClusterGraph(externalDegree);
+
+		interEdges.reserve(interG.numberOfEdges());
+		interG.forEdges([&](node u, node v) {
+			interEdges.push_back(std::minmax(u, v));
+		});
+
+		Aux::Parallel::sort(interEdges.begin(), interEdges.end());
+	}
 
 	handler.assureRunning();
 
-	if (edgesRemoved > 0) {
-		ERROR("Removed ", edgesRemoved, " intra-community edges that already existed but should have been rewired actually!");
+	hasPartition = true;
+}
+
+void NetworKit::LFRGenerator::run() {
+	hasRun = false;
+
+	GraphBuilder builder(n);
+	std::vector<NodePair> interEdges;
+
+	// both endpoints of an intra-cluster edge belong to the same community, so
+	// each row of the builder is only written by the thread of its community
+	generateEdges([&](const std::vector<NodePair> &edges) {
+		for (const auto &e : edges) {
+			builder.addHalfOutEdge(e.first, e.second);
+		}
+	}, interEdges);
+
+	// the inter-cluster edges are sorted by their first node, hence chunks
+	// that start at row boundaries can be inserted in parallel
+	const count numChunks = 4 * omp_get_max_threads();
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index chunk = 0; chunk < static_cast<omp_index>(numChunks); ++chunk) {
+		auto rowStart = [&](index i) {
+			while (i > 0 && i < interEdges.size() && interEdges[i].first == interEdges[i - 1].first) ++i;
+			return i;
+		};
+		const index end = rowStart(interEdges.size() * (chunk + 1) / numChunks);
+		for (index i = rowStart(interEdges.size() * chunk / numChunks); i < end; ++i)
+			builder.addHalfOutEdge(interEdges[i].first, interEdges[i].second);
 	}
 
+	interEdges.clear();
+	interEdges.shrink_to_fit();
+
+	G = builder.toGraph(true, true);
+
 	hasGraph = true;
-	hasPartition = true;
+	hasRun = true;
+}
+
+void NetworKit::LFRGenerator::forEdgeBatches(const EdgeBatchHandle &handle) {
+	hasRun = false;
+
+	std::vector<NodePair> interEdges;
+	EdgeBatch batch;
+
+	generateEdges([&](const std::vector<NodePair> &edges) {
+		#pragma omp critical (generators_lfr_stream_batch)
+		{
+			batch.clear();
+			for (const auto &e : edges) {
+				batch.emplace_back(e.first, e.second, defaultEdgeWeight);
+			}
+			handle(batch);
+		}
+	}, interEdges);
+
+	const count batchSize = 1 << 20;
+	for (index begin = 0; begin < interEdges.size(); begin += batchSize) {
+		const index end = std::min<index>(interEdges.size(), begin + batchSize);
+		batch.clear();
+		for (index i = begin; i < end; ++i) {
+			batch.emplace_back(interEdges[i].first, interEdges[i].second, defaultEdgeWeight);
+		}
+		handle(batch);
+	}
+
 	hasRun = true;
 }
 
@@ -551,7 +903,7 @@ std::string NetworKit::LFRGenerator::toString() const {
 }
 
 bool NetworKit::LFRGenerator::isParallel() const {
-	return false;
+	return scalableMode;
 }
 
 
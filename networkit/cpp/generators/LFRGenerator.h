@@ -1,10 +1,15 @@
 #ifndef LFRGENERATOR_H
 #define LFRGENERATOR_H
 
+#include <functional>
+#include <random>
+#include <utility>
+
 #include "../graph/Graph.h"
 #include "../structures/Partition.h"
 #include "../base/Algorithm.h"
 #include "StaticGraphGenerator.h"
+#include "EdgeStreamGenerator.h"
 
 namespace NetworKit {
 
@@ -19,8 +24,17 @@ namespace NetworKit {
  * instead of heavily modifying the distributions.
  *
  * The edge-switching markov-chain algorithm implementation in NetworKit is used which is different from the implementation in the original LFR benchmark.
+ *
+ * For large graphs, a scalable mode can be enabled (see setScalableMode()) in which all steps are parallel. The intra-cluster graphs of
+ * small communities are then generated in parallel by the Havel-Hakimi generator followed by edge switching. The inter-cluster graph
+ * and the intra-cluster graphs of large communities are generated with the configuration model; loops, multi-edges and inter-cluster
+ * edges inside a community are rewired with random partner edges in parallel rounds. This follows the approach of
+ * "I/O-efficient Generation of Massive Graphs Following the LFR Benchmark" by Hamann, Meyer, Penschuck, Tran and Wagner.
+ * Given the seed of Aux::Random, the result of the scalable mode does not depend on the number of threads.
+ *
+ * The generator can also stream the edges without building a Graph, see forEdgeBatches().
  */
-class LFRGenerator : public Algorithm, public StaticGraphGenerator {
+class LFRGenerator : public Algorithm, public StaticGraphGenerator, public EdgeStreamGenerator {
 public:
 	/**
 	 * Initialize the LFR generator for @a n nodes.
@@ -93,6 +107,15 @@ public:
 	 */
 	void setMuWithBinomialDistribution(double mu);
 
+	/**
+	 * Enables or disables the scalable mode, in which the inter-cluster graph and large communities are generated in parallel with
+	 * the configuration model and parallel rewiring instead of the sequential edge-switching markov-chain. The scalable mode is
+	 * disabled by default.
+	 *
+	 * @param scalable If the scalable mode shall be used.
+	 */
+	void setScalableMode(bool scalable);
+
 	/**
 	 * Generates the graph and the community structure.
 	 */
@@ -133,15 +156,25 @@ public:
 	 */
 	Partition&& getMovePartition();
 
+	count numberOfNodes() const override { return n; }
+
+	/**
+	 * Generates the community structure and streams the edges of the graph instead of building it. Each call of @a handle receives the
+	 * edges of one community or a part of the inter-cluster edges. Afterwards, the partition is available as after run().
+	 *
+	 * @param handle The callback that receives the edge batches.
+	 */
+	void forEdgeBatches(const EdgeBatchHandle& handle) override;
+
 	/**
 	 * The name and parameters of the generator
 	 */
 	virtual std::string toString() const override;
 
 	/**
-	 * If the algorithm uses parallelism (no)
+	 * If the algorithm uses parallelism (only in the scalable mode)
 	 *
-	 * @return false, only minor parts are parallelized
+	 * @return true if the scalable mode is enabled, otherwise only minor parts are parallelized
 	 */
 	virtual bool isParallel() const override;
 
@@ -153,8 +186,16 @@ protected:
 	virtual Graph generateIntraClusterGraph(std::vector<count> intraDegreeSequence, const std::vector<node> &localToGlobalNode);
 	virtual Graph generateInterClusterGraph(const std::vector<count> &externalDegreeSequence);
 
+	/**
+	 * Randomly increases or decreases the intra-cluster degree of single nodes until the sum of the intra-cluster degrees of the
+	 * community is even. The internal degree sequence is updated accordingly.
+	 */
+	void makeIntraDegreeSumEven(std::vector<count> &intraDegreeSequence, const std::vector<node> &localToGlobalNode, std::mt19937_64 &urng);
+
 	count n;
 
+	bool scalableMode;
+
 	bool hasDegreeSequence;
 	std::vector<count> degreeSequence;
 
@@ -169,6 +210,15 @@ protected:
 
 	bool hasPartition;
 	Partition zeta;
+
+private:
+	using NodePair = std::pair<node, node>;
+
+	/**
+	 * Generates the community structure and the edges. @a intraHandle is called (possibly in parallel) once for each community
+	 * with its edges, the inter-cluster edges are returned sorted in @a interEdges. All edges are given as (u, v) with u < v.
+	 */
+	void generateEdges(const std::function<void(const std::vector<NodePair>&)> &intraHandle, std::vector<NodePair> &interEdges);
 };
 
 } // namespace NetworKit
@@ -25,71 +25,6 @@ private:
 	 */
 	std::vector<std::vector<double>> nodePositions;
 
-	// DATA FOR EACH LAYER
-
-	/**
-	 * Collection of nodes.
-	 */
-	typedef std::vector<node> NodeCollection;
-
-	/**
-	 * The cell array reflects how nodes are assigned to a grid. Each element of
-	 * the vector corresponds to one grid cell.
-	 */
-	typedef std::vector<NodeCollection> CellArray;
-
-	/**
-	 * State of a layer
-	 */
-	struct LayerState {
-		CellArray a;
-		int aMax;
-	};
-
-	// FUNCTIONS RELATED TO THE LAYER STATE
-
-	/**
-	 * Initialize the cell array.  The second parameter determines how many grid
-	 * cells shall be contained in each dimension of the cell array.
-	 */
-	void initCellArray(LayerState &s, const count &numberOfCellsPerDimension);
-
-	/**
-	 * Get all nodes that are contained in the i-th grid cell
-	 */
-	NodeCollection getNodes(LayerState &s, const int &i);
-
-	/**
-	 * Add the node with number j to the corresponing grid cell
-	 */
-	const void addNode(LayerState &s, const int &j);
-
-	/**
-	 * Determine, for a given position, the index of the corresponding grid cell
-	 */
-	const int toIndex(LayerState &s, const std::vector<double> &v);
-
-	/**
-	 * Determine, for the given multi-dimensional index, the index of the
-	 * corresponding grid cell
-	 */
-	const int toIndex(LayerState &s, const std::vector<int> &v);
-
-	/**
-	 * Determine, for a given index, the multi-dimensional index of a grid cell
-	 */
-	const std::vector<int> fromIndex(LayerState &s, const int &i);
-
-	/**
-	 * Determine for a grid cell given by index i the grid cells of distance r
-	 */
-	const std::vector<int> boxSurface(LayerState &s, const int &i, const int &r);
-
-	/**
-	 * Determine for a grid cell given by index i the grid cells within distance r
-	 */
-	const std::vector<int> boxVolume(LayerState &s, const int &j, const double &r);
-
 	// EDGE GENERATION
 
 	/**
@@ -4,6 +4,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <random>
 
 #include "PowerlawDegreeSequence.h"
 #include "../auxiliary/Random.h"
@@ -169,15 +170,23 @@ double NetworKit::PowerlawDegreeSequence::getExpectedAverageDegree() const {
 }
 
 std::vector< NetworKit::count > NetworKit::PowerlawDegreeSequence::getDegreeSequence(NetworKit::count numNodes) const {
-	std::vector<count> degreeSequence;
-
 	assureFinished();
-	degreeSequence.reserve(numNodes);
+
+	// the degrees are drawn in fixed chunks with one random stream each,
+	// hence the result only depends on the seed and not on the number of threads
+	const count chunkSize = 4096;
+	const uint64_t baseSeed = Aux::Random::integer();
+	std::vector<count> degreeSequence(numNodes);
 	count degreeSum = 0;
 
-	for (count i = 0; i < numNodes; ++i) {
-		degreeSequence.push_back(getDegree());
-		degreeSum += degreeSequence.back();
+	#pragma omp parallel for reduction(+:degreeSum)
+	for (omp_index chunk = 0; chunk < static_cast<omp_index>((numNodes + chunkSize - 1) / chunkSize); ++chunk) {
+		std::mt19937_64 urng(Aux::Random::streamSeed(baseSeed, chunk));
+		const index end = std::min(numNodes, (chunk + 1) * chunkSize);
+		for (index i = chunk * chunkSize; i < end; ++i) {
+			degreeSequence[i] = getDegree(urng);
+			degreeSum += degreeSequence[i];
+		}
 	}
 
 	if (degreeSum % 2 != 0) {
@@ -188,6 +197,11 @@ std::vector< NetworKit::count > NetworKit::PowerlawDegreeSequence::getDegreeSequ
 }
 
 NetworKit::count NetworKit::PowerlawDegreeSequence::getDegree() const {
+	return getDegree(Aux::Random::getURNG());
+}
+
+NetworKit::count NetworKit::PowerlawDegreeSequence::getDegree(std::mt19937_64 &urng) const {
 	assureFinished();
-	return maxDeg - std::distance(cumulativeProbability.begin(), std::lower_bound(cumulativeProbability.begin(), cumulativeProbability.end(), Aux::Random::probability()));
+	std::uniform_real_distribution<double> distr;
+	return maxDeg - std::distance(cumulativeProbability.begin(), std::lower_bound(cumulativeProbability.begin(), cumulativeProbability.end(), distr(urng)));
 }
@@ -1,6 +1,7 @@
 #ifndef POWERLAWDEGREESEQUENCE_H
 #define POWERLAWDEGREESEQUENCE_H
 
+#include <random>
 #include <vector>
 
 #include "../base/Algorithm.h"
@@ -112,6 +113,16 @@ public:
 	 * @return A degree that follows the generated distribution.
 	 */
 	count getDegree() const;
+
+	/**
+	 * Returns a degree drawn at random with a power law distribution using
+	 * the given random number generator, which allows to draw degrees in
+	 * parallel and reproducibly.
+	 *
+	 * @param urng The random number generator to use.
+	 * @return A degree that follows the generated distribution.
+	 */
+	count getDegree(std::mt19937_64 &urng) const;
 private:
 	count minDeg, maxDeg;
 	double gamma;
@@ -5,14 +5,16 @@
 *      Author: Simon Bischof
 */
 
+#include <algorithm>
+
 #include "RegularRingLatticeGenerator.h"
 
 namespace NetworKit {
 
 RegularRingLatticeGenerator::RegularRingLatticeGenerator(count nNodes, count nNeighbors)
 	: nNodes(nNodes), nNeighbors(nNeighbors) {
-	if (nNeighbors >= nNodes / 2 - 1) {
-		nNeighbors = nNodes / 2 - 1;
+	if (nNodes >= 2 && nNeighbors >= nNodes / 2 - 1) {
+		this->nNeighbors = nNodes / 2 - 1;
 	}
 }
 
@@ -28,4 +30,34 @@ Graph RegularRingLatticeGenerator::generate() {
 	return G;
 }
 
+void RegularRingLatticeGenerator::forEdgeBatches(const EdgeBatchHandle& handle) {
+	const count batchSize = count{1} << 20;
+	EdgeBatch batch;
+	batch.reserve(std::min(batchSize, nNodes * nNeighbors));
+
+	auto emit = [&](node u, node v) {
+		batch.emplace_back(u, v, defaultEdgeWeight);
+		if (batch.size() == batchSize) {
+			handle(batch);
+			batch.clear();
+		}
+	};
+
+	// the larger neighbours of u are u + 1, ..., u + nNeighbors and, for
+	// u < nNeighbors, the nodes nNodes - nNeighbors + u, ..., nNodes - 1
+	// reached by wrapping around the ring
+	for (node u = 0; u < nNodes; ++u) {
+		const node last = std::min(u + nNeighbors, nNodes - 1);
+		for (node v = u + 1; v <= last; ++v)
+			emit(u, v);
+		if (u < nNeighbors) {
+			for (node v = std::max(last + 1, nNodes - nNeighbors + u); v < nNodes; ++v)
+				emit(u, v);
+		}
+	}
+
+	if (!batch.empty())
+		handle(batch);
+}
+
 } /* namespace NetworKit */
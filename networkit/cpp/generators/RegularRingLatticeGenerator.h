@@ -9,11 +9,12 @@
 #define REGULARRINGLATTICEGENERATOR_H_
 
 #include "StaticGraphGenerator.h"
+#include "EdgeStreamGenerator.h"
 
 namespace NetworKit {
 
 
-class RegularRingLatticeGenerator: public StaticGraphGenerator {
+class RegularRingLatticeGenerator: public StaticGraphGenerator, public EdgeStreamGenerator {
 
 public:
 	/**
@@ -26,6 +27,15 @@ public:
 
 	virtual Graph generate();
 
+	count numberOfNodes() const override { return nNodes; }
+
+	bool emitsSortedEdges() const override { return true; }
+
+	/**
+	 * Streams the edges sorted by (u, v) with u < v.
+	 */
+	void forEdgeBatches(const EdgeBatchHandle& handle) override;
+
 protected:
 		count nNodes;
 		count nNeighbors;
@@ -5,15 +5,131 @@
  *      Author: Henning, cls
  */
 
+#include <omp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <tuple>
+
 #include "RmatGenerator.h"
+#include "../graph/GraphBuilder.h"
 #include "../auxiliary/Random.h"
 #include "../auxiliary/NumericTools.h"
 #include "../auxiliary/Log.h"
+#include "../auxiliary/Parallel.h"
+#include "../auxiliary/Enforce.h"
+#include "../auxiliary/SignalHandling.h"
+
+#ifdef NETWORKIT_WINDOWS
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
 
 namespace NetworKit {
 
+namespace {
+
+// Removes the run files of an external memory run, also if the run is aborted by an exception.
+struct RunFiles {
+	std::vector<std::string> paths;
+
+	~RunFiles() {
+		for (const auto& path : paths)
+			std::remove(path.c_str());
+	}
+
+	// The names contain the process id and a per-process counter, so that concurrent runs with the same seed
+	// do not overwrite each other's files.
+	std::string next(const std::string& directory) {
+		static std::atomic<uint64_t> runCounter{0};
+		if (paths.empty()) id = runCounter++;
+#ifdef NETWORKIT_WINDOWS
+		const long pid = _getpid();
+#else
+		const long pid = getpid();
+#endif
+		std::stringstream path;
+		path << directory << "/rmat-" << pid << "-" << id << "-" << paths.size() << ".run";
+		paths.push_back(path.str());
+		return paths.back();
+	}
+
+private:
+	uint64_t id = 0;
+};
+
+// Counter based random bits; the i-th edge uses the stream (seed, i), so that
+// edges can be drawn in any order and on any thread.
+class EdgeRandomBits {
+public:
+	EdgeRandomBits(uint64_t seed, index edge) : state(Aux::Random::streamSeed(seed, edge)) {}
+
+	uint64_t operator()() {
+		// splitmix64
+		uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	}
+
+private:
+	uint64_t state;
+};
+
+uint64_t probabilityThreshold(double p) {
+	if (p >= 1.0) return std::numeric_limits<uint64_t>::max();
+	return static_cast<uint64_t>(std::ldexp(p, 64));
+}
+
+// Record of a sorted run; mult is the number of times the edge was drawn
+struct RunRecord {
+	uint64_t u;
+	uint64_t v;
+	uint64_t mult;
+};
+
+class RunReader {
+public:
+	RunReader(const std::string& path, count bufferSize) : in(path, std::ios::binary), buffer(bufferSize), pos(0), size(0) {
+		Aux::enforceOpened(in);
+		refill();
+	}
+
+	bool empty() const { return pos == size; }
+
+	const RunRecord& front() const { return buffer[pos]; }
+
+	void pop() {
+		if (++pos == size) refill();
+	}
+
+private:
+	std::ifstream in;
+	std::vector<RunRecord> buffer;
+	count pos;
+	count size;
+
+	void refill() {
+		in.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(RunRecord));
+		size = in.gcount() / sizeof(RunRecord);
+		pos = 0;
+	}
+};
+
+} // namespace
+
 RmatGenerator::RmatGenerator(count scale, count edgeFactor, double a, double b, double c, double d, bool weighted, count reduceNodes):
-	scale(scale), edgeFactor(edgeFactor), a(a), b(b), c(c), d(d), weighted(weighted), reduceNodes(reduceNodes)
+	scale(scale), edgeFactor(edgeFactor), a(a), b(b), c(c), d(d), weighted(weighted), reduceNodes(reduceNodes),
+	maxEdgesInMemory(count{1} << 26), tempDirectory(".")
 {
     if (scale > 63) throw std::runtime_error("Cannot generate more than 2^63 nodes");
 	double sum = a+b+c+d;
@@ -22,107 +138,250 @@ RmatGenerator::RmatGenerator(count scale, count edgeFactor, double a, double b,
 	defaultEdgeWeight = 1.0;
 }
 
-Graph RmatGenerator::generate() {
-	count n = (1 << scale);
+void RmatGenerator::setExternalMemoryParameters(count maxEdgesInMemory, const std::string& tempDirectory) {
+	if (!maxEdgesInMemory) throw std::runtime_error("maxEdgesInMemory has to be positive");
+	this->maxEdgesInMemory = maxEdgesInMemory;
+	this->tempDirectory = tempDirectory;
+}
+
+count RmatGenerator::numberOfNodes() const {
+	return (count{1} << scale) - reduceNodes;
+}
+
+count RmatGenerator::numberOfDraws() const {
+	const count n = count{1} << scale;
+	// when nodes are deleted, all nodes have less neighbors
+	return n * edgeFactor * 1.0 * n / (n - reduceNodes);
+}
+
+std::vector<node> RmatGenerator::computeNodeMap() const {
+	const count n = count{1} << scale;
 	if (n <= reduceNodes) {
 		throw std::runtime_error("Error, shall delete more nodes than the graph originally has");
 	}
-	// when nodes are deleted, all nodes have less neighbors
-	count numEdges = n * edgeFactor * n * 1.0 / (n - reduceNodes);
-	count wantedEdges = (n - reduceNodes) * edgeFactor;
-	Graph G(n - reduceNodes, weighted);
-	double ab = a+b;
-	double abc = ab+c;
-
-	auto quadrant([&]() {
-		double r = Aux::Random::probability();
-		TRACE("r: ", r);
-
-		if (r <= a) {
-			return 0;
-		}
-		else if (r <= ab) {
-			return 1;
+
+	std::vector<node> nodemap;
+	if (!reduceNodes) return nodemap;
+
+	nodemap.resize(n, 0);
+	for (count deletedNodes = 0; deletedNodes < reduceNodes;) {
+		node u = Aux::Random::index(n);
+		if (nodemap[u] == 0) {
+			nodemap[u] = none;
+			++deletedNodes;
 		}
-		else if (r <= abc) {
-			return 2;
+	}
+
+	for (node i = 0, u = 0; i < n; ++i) {
+		if (nodemap[i] == 0) {
+			nodemap[i] = u;
+			++u;
 		}
-		else return 3;
-	});
+	}
+
+	return nodemap;
+}
 
-	auto drawEdge([&]() {
+void RmatGenerator::drawEdges(uint64_t seed, index begin, index end, const std::vector<node>& nodemap, std::vector<NodePair>& edges) const {
+	const uint64_t thresholdA = probabilityThreshold(a);
+	const uint64_t thresholdAB = probabilityThreshold(a + b);
+	const uint64_t thresholdABC = probabilityThreshold(a + b + c);
+	// the sequential generator kept self loops only if no nodes were deleted
+	// or the graph is weighted; we stick to this behaviour
+	const bool skipSelfLoops = !nodemap.empty() && !weighted;
+
+	const index offset = edges.size();
+	edges.resize(offset + (end - begin));
+
+	#pragma omp parallel for schedule(static, 1024)
+	for (omp_index e = begin; e < static_cast<omp_index>(end); ++e) {
+		EdgeRandomBits bits(seed, e);
 		node u = 0;
 		node v = 0;
 		for (index i = 0; i < scale; ++i) {
-			count q = quadrant();
-//			TRACE("q: ", q);
-			u = u << 1;
-			v = v << 1;
-			u = u | (q >> 1);
-			v = v | (q & 1);
+			const uint64_t r = bits();
+			const unsigned q = (r < thresholdA) ? 0 : (r < thresholdAB) ? 1 : (r < thresholdABC) ? 2 : 3;
+			u = (u << 1) | (q >> 1);
+			v = (v << 1) | (q & 1);
 		}
 
-		return std::make_pair(u, v);
-	});
-
-	if (reduceNodes > 0) {
-		std::vector<node> nodemap(n, 0);
+		if (!nodemap.empty()) {
+			u = nodemap[u];
+			v = nodemap[v];
+		}
 
-		for (count deletedNodes = 0; deletedNodes < reduceNodes;) {
-			node u = Aux::Random::index(n);
-			if (nodemap[u] == 0) {
-				nodemap[u] = none;
-				++deletedNodes;
-			}
+		// invalid edges are sorted to the end and truncated by the caller
+		if (u == none || v == none || (skipSelfLoops && u == v)) {
+			edges[offset + e - begin] = {none, none};
+		} else {
+			edges[offset + e - begin] = std::minmax(u, v);
 		}
+	}
+}
 
-		for (node i = 0, u = 0; i < n; ++i) {
-			if (nodemap[i] == 0) {
-				nodemap[i] = u;
-				++u;
-			}
+namespace {
+
+// Sorts edges and removes invalid ones (which are marked as (none, none))
+void sortAndTruncate(std::vector<std::pair<node, node>>& edges, index begin) {
+	Aux::Parallel::sort(edges.begin() + begin, edges.end());
+	auto invalid = std::lower_bound(edges.begin() + begin, edges.end(), std::make_pair(none, none));
+	edges.erase(invalid, edges.end());
+}
+
+// Calls handle(u, v, multiplicity) for each distinct edge of the sorted range
+template <typename Iter, typename Handle>
+void forDistinctEdges(Iter begin, Iter end, Handle handle) {
+	while (begin != end) {
+		Iter next = begin + 1;
+		while (next != end && *next == *begin) ++next;
+		handle(begin->first, begin->second, static_cast<count>(next - begin));
+		begin = next;
+	}
+}
+
+} // namespace
+
+Graph RmatGenerator::generate() {
+	const std::vector<node> nodemap = computeNodeMap();
+	const count n = numberOfNodes();
+	const uint64_t seed = Aux::Random::integer();
+
+	std::vector<NodePair> edges;
+
+	if (weighted) {
+		drawEdges(seed, 0, numberOfDraws(), nodemap, edges);
+		sortAndTruncate(edges, 0);
+	} else {
+		// Draw until the graph has the wanted number of distinct edges. Each
+		// round draws only as many edges as are missing, so the result is
+		// distributed as if we drew and inserted edges one at a time.
+		const count wantedEdges = n * edgeFactor;
+		index drawn = 0;
+		Aux::SignalHandler handler;
+		while (edges.size() < wantedEdges) {
+			handler.assureRunning();
+			const index oldSize = edges.size();
+			const count missing = wantedEdges - oldSize;
+			drawEdges(seed, drawn, drawn + missing, nodemap, edges);
+			drawn += missing;
+
+			sortAndTruncate(edges, oldSize);
+			std::inplace_merge(edges.begin(), edges.begin() + oldSize, edges.end());
+			edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
 		}
+	}
 
-		node u, v;
-		if (weighted) {
-			for (index e = 0; e < numEdges; ++e) {
-				std::tie(u, v) = drawEdge();
-				u = nodemap[u];
-				v = nodemap[v];
-				if (u != none && v != none) {
-					G.increaseWeight(u, v, defaultEdgeWeight);
-				}
-			}
-		} else {
-			while (G.numberOfEdges() < wantedEdges) {
-				std::tie(u, v) = drawEdge();
-				u = nodemap[u];
-				v = nodemap[v];
-				if (u != none && v != none && u != v && !G.hasEdge(u, v)) {
-					G.addEdge(u, v);
-				}
-			}
+	// Add the edges in parallel; chunk boundaries are moved to the start of
+	// a row, so that each row is added by a single thread.
+	GraphBuilder builder(n, weighted);
+	const count numChunks = 4 * omp_get_max_threads();
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index chunk = 0; chunk < static_cast<omp_index>(numChunks); ++chunk) {
+		auto rowStart = [&](index i) {
+			while (i > 0 && i < edges.size() && edges[i].first == edges[i - 1].first) ++i;
+			return i;
+		};
+		const index begin = rowStart(edges.size() * chunk / numChunks);
+		const index end = rowStart(edges.size() * (chunk + 1) / numChunks);
+		if (begin >= end) continue;
+
+		forDistinctEdges(edges.begin() + begin, edges.begin() + end, [&](node u, node v, count mult) {
+			builder.addHalfOutEdge(u, v, mult * defaultEdgeWeight);
+		});
+	}
+
+	return builder.toGraph(true, true);
+}
+
+void RmatGenerator::forEdgeBatches(const EdgeBatchHandle& handle) {
+	const std::vector<node> nodemap = computeNodeMap();
+	const uint64_t seed = Aux::Random::integer();
+	const count numDraws = numberOfDraws();
+	const count batchSize = std::min<count>(maxEdgesInMemory, count{1} << 20);
+
+	EdgeBatch batch;
+	batch.reserve(batchSize);
+	auto emit = [&](node u, node v, count mult) {
+		batch.emplace_back(u, v, weighted ? mult * defaultEdgeWeight : defaultEdgeWeight);
+		if (batch.size() == batchSize) {
+			handle(batch);
+			batch.clear();
 		}
+	};
+
+	std::vector<NodePair> edges;
+
+	if (numDraws <= maxEdgesInMemory) {
+		drawEdges(seed, 0, numDraws, nodemap, edges);
+		sortAndTruncate(edges, 0);
+		forDistinctEdges(edges.begin(), edges.end(), emit);
+
 	} else {
-		if (weighted) {
-			for (index e = 0; e < numEdges; ++e) {
-				std::pair<node, node> drawnEdge = drawEdge();
-				//			TRACE("edge drawn: ", drawnEdge.first, " - ", drawnEdge.second);
-				G.increaseWeight(drawnEdge.first, drawnEdge.second, defaultEdgeWeight);
-			}
-		} else {
-			while (G.numberOfEdges() < wantedEdges) {
-				std::pair<node, node> drawnEdge = drawEdge();
-				//			TRACE("edge drawn: ", drawnEdge.first, " - ", drawnEdge.second);
-				if (!G.hasEdge(drawnEdge.first, drawnEdge.second)) {
-					G.addEdge(drawnEdge.first, drawnEdge.second);
-				}
+		// External memory: write sorted runs to disk and merge them
+		RunFiles runFiles;
+		Aux::SignalHandler handler;
+
+		for (index begin = 0; begin < numDraws; begin += maxEdgesInMemory) {
+			handler.assureRunning();
+			const index end = std::min(numDraws, begin + maxEdgesInMemory);
+			edges.clear();
+			drawEdges(seed, begin, end, nodemap, edges);
+			sortAndTruncate(edges, 0);
+
+			std::ofstream out(runFiles.next(tempDirectory), std::ios::binary | std::ios::trunc);
+			Aux::enforceOpened(out);
+			std::vector<RunRecord> records;
+			records.reserve(batchSize);
+			auto flush = [&]() {
+				out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(RunRecord));
+				records.clear();
+			};
+			forDistinctEdges(edges.begin(), edges.end(), [&](node u, node v, count mult) {
+				records.push_back({u, v, mult});
+				if (records.size() == batchSize) flush();
+			});
+			flush();
+		}
+		std::vector<NodePair>().swap(edges);
+
+		// k-way merge; the buffers of all readers together hold about batchSize records
+		const count bufferSize = std::max<count>(1024, batchSize / runFiles.paths.size());
+		std::vector<std::unique_ptr<RunReader>> readers;
+		for (const auto& path : runFiles.paths)
+			readers.emplace_back(new RunReader(path, bufferSize));
+
+		auto greater = [&](index x, index y) {
+			const RunRecord& rx = readers[x]->front();
+			const RunRecord& ry = readers[y]->front();
+			return std::tie(rx.u, rx.v) > std::tie(ry.u, ry.v);
+		};
+		std::priority_queue<index, std::vector<index>, decltype(greater)> heap(greater);
+		for (index i = 0; i < readers.size(); ++i)
+			if (!readers[i]->empty()) heap.push(i);
+
+		bool hasCurrent = false;
+		RunRecord current{0, 0, 0};
+		while (!heap.empty()) {
+			const index i = heap.top();
+			heap.pop();
+			const RunRecord rec = readers[i]->front();
+			readers[i]->pop();
+			if (!readers[i]->empty()) heap.push(i);
+
+			if (hasCurrent && rec.u == current.u && rec.v == current.v) {
+				current.mult += rec.mult;
+			} else {
+				if (hasCurrent) emit(current.u, current.v, current.mult);
+				current = rec;
+				hasCurrent = true;
 			}
 		}
+		if (hasCurrent) emit(current.u, current.v, current.mult);
+
 	}
 
-	G.shrinkToFit();
-	return G;
+	if (!batch.empty())
+		handle(batch);
 }
 
 } /* namespace NetworKit */
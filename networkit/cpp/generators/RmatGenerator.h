@@ -8,7 +8,12 @@
 #ifndef RMATGENERATOR_H_
 #define RMATGENERATOR_H_
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "StaticGraphGenerator.h"
+#include "EdgeStreamGenerator.h"
 #include "../graph/Graph.h"
 
 namespace NetworKit {
@@ -20,8 +25,19 @@ namespace NetworKit {
  * More details at http://www.graph500.org or in the original paper:
  * Deepayan Chakrabarti, Yiping Zhan, Christos Faloutsos:
  * R-MAT: A Recursive Model for Graph Mining. SDM 2004: 442-446.
+ *
+ * Edges are drawn in parallel. The random bits of the i-th edge are
+ * derived from a counter based generator seeded with (seed, i), hence for
+ * a fixed seed the result does not depend on the number of threads.
+ * Duplicates are removed (or, for weighted graphs, merged into weights)
+ * by a parallel sort.
+ *
+ * The generator can also stream its edges without building a Graph (see
+ * @ref EdgeStreamGenerator). In this case at most @a maxEdgesInMemory
+ * edges are kept in memory; larger graphs are generated in sorted runs
+ * that are written to temporary files and merged afterwards.
  */
-class RmatGenerator: public StaticGraphGenerator {
+class RmatGenerator: public StaticGraphGenerator, public EdgeStreamGenerator {
 protected:
 	count scale; ///< n = 2^scale
 	count edgeFactor;
@@ -30,6 +46,9 @@ protected:
 	bool weighted;
 	count reduceNodes;
 
+	count maxEdgesInMemory;
+	std::string tempDirectory;
+
 public:
 
 	/**
@@ -48,6 +67,48 @@ public:
 	 * @return Graph to be generated according to parameters specified in constructor.
 	 */
 	Graph generate() override;
+
+	/**
+	 * Sets the parameters used by @ref forEdgeBatches.
+	 *
+	 * @param[in] maxEdgesInMemory	number of edges drawn and sorted at once
+	 * @param[in] tempDirectory	directory for the sorted runs, if more than one run is needed
+	 */
+	void setExternalMemoryParameters(count maxEdgesInMemory, const std::string& tempDirectory);
+
+	count numberOfNodes() const override;
+
+	bool isWeighted() const override { return weighted; }
+
+	bool emitsSortedEdges() const override { return true; }
+
+	/**
+	 * Streams the edges sorted by (u, v) with u <= v. In contrast to
+	 * @ref generate, which draws edges until the unweighted graph contains
+	 * exactly n*edgeFactor edges, the stream draws a fixed number of edges
+	 * (as the Graph500 generator does) and removes duplicates; hence an
+	 * unweighted stream has slightly fewer edges. With N = 2^scale nodes
+	 * before the deletion, N*edgeFactor*N/(N - reduceNodes) edges are drawn,
+	 * i.e. the draws are scaled up to make up for the edges of the deleted
+	 * nodes, which are dropped.
+	 */
+	void forEdgeBatches(const EdgeBatchHandle& handle) override;
+
+private:
+	using NodePair = std::pair<node, node>;
+
+	/**
+	 * Draws the edges with the indices [begin, end) in parallel and appends them
+	 * to @a edges, normalised to u <= v. Edges with deleted nodes (and self
+	 * loops, if they are dropped) are kept in place as (none, none), so that
+	 * exactly end - begin edges are appended; the caller sorts them to the end
+	 * and truncates them.
+	 */
+	void drawEdges(uint64_t seed, index begin, index end, const std::vector<node>& nodemap, std::vector<NodePair>& edges) const;
+
+	std::vector<node> computeNodeMap() const;
+
+	count numberOfDraws() const;
 };
 
 } /* namespace NetworKit */
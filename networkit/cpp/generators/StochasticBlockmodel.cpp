@@ -5,8 +5,14 @@
 *      Author: Christian Staudt
 */
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 #include "StochasticBlockmodel.h"
 #include "../auxiliary/Random.h"
+#include "../auxiliary/SignalHandling.h"
+#include "../graph/GraphBuilder.h"
 
 namespace NetworKit {
 
@@ -15,27 +21,212 @@ StochasticBlockmodel::StochasticBlockmodel(count n, count nBlocks, const std::ve
 	if (affinity.size() != nBlocks) {
 		throw std::runtime_error("affinity matrix must be of size nBlocks x nBlocks");
 	}
+	for (const auto& row : affinity) {
+		if (row.size() != nBlocks) {
+			throw std::runtime_error("affinity matrix must be of size nBlocks x nBlocks");
+		}
+	}
+	// the graph is undirected and only one triangle of the matrix is used
+	for (index a = 0; a < nBlocks; ++a) {
+		for (index b = a + 1; b < nBlocks; ++b) {
+			if (affinity[a][b] != affinity[b][a]) {
+				throw std::runtime_error("affinity matrix must be symmetric");
+			}
+		}
+	}
 	if (membership.size() != n) {
 		throw std::runtime_error("membership list must be of size nNodes");
 	}
+	for (index b : membership) {
+		if (b >= nBlocks) {
+			throw std::runtime_error("block ids must be smaller than nBlocks");
+		}
+	}
+}
+
+StochasticBlockmodel::StochasticBlockmodel(count n, count nBlocks, const std::vector<index>& membership, const std::vector<std::vector<double> >& affinity, const std::vector<double>& degreeWeights)
+	: StochasticBlockmodel(n, nBlocks, membership, affinity) {
+	if (degreeWeights.size() != n) {
+		throw std::runtime_error("degree weights must be of size nNodes");
+	}
+	for (double w : degreeWeights) {
+		if (w < 0.0) {
+			throw std::runtime_error("degree weights must be non-negative");
+		}
+	}
+	this->degreeWeights = degreeWeights;
+}
+
+namespace {
+
+//! Expected number of candidate edges a work unit is aiming for
+constexpr double unitGrain = 4096.0;
+
+// Calls handle(pos) for each position in [0, length) that is selected independently with
+// probability p, by drawing geometric skips as in Batagelj and Brandes.
+template <typename Handle>
+void skipWalk(std::mt19937_64& urng, count length, double p, Handle handle) {
+	if (p >= 1.0) {
+		for (count pos = 0; pos < length; ++pos)
+			handle(pos);
+		return;
+	}
+
+	std::uniform_real_distribution<double> distr{std::nextafter(0.0, 1.0), std::nextafter(1.0, 2.0)};
+	const double invLogCp = 1.0 / std::log1p(-p);
+
+	count pos = 0;
+	while (true) {
+		const double skip = std::floor(std::log(distr(urng)) * invLogCp);
+		if (skip >= static_cast<double>(length - pos))
+			break;
+		pos += static_cast<count>(skip);
+		handle(pos);
+		++pos;
+	}
+}
+
+// Miller and Hagberg's skipping for a row whose candidates are selected with probability
+// min(1, scale * colWeights[c]) for c in [0, colCount); colWeights has to be non-increasing.
+template <typename Handle>
+void generateCorrectedRow(std::mt19937_64& urng, double scale, const double* colWeights, count colCount, Handle handle) {
+	std::uniform_real_distribution<double> skipDistr{std::nextafter(0.0, 1.0), std::nextafter(1.0, 2.0)};
+	std::uniform_real_distribution<double> acceptDistr{};
+
+	if (!colCount) return;
+
+	index c = 0;
+	double p = std::min(scale * colWeights[0], 1.0);
+	while (c < colCount && p > 0) {
+		if (p != 1.0) {
+			const double skip = std::floor(std::log(skipDistr(urng)) / std::log1p(-p));
+			if (skip >= static_cast<double>(colCount - c))
+				break;
+			c += static_cast<index>(skip);
+		}
+
+		const double q = std::min(scale * colWeights[c], 1.0);
+		if (acceptDistr(urng) < q / p)
+			handle(c);
+		p = q;
+		++c;
+	}
 }
 
+} // namespace
 
 Graph StochasticBlockmodel::generate() {
-	Graph G(n);
-
-	G.forNodePairs([&](node u, node v) {
-		index a = membership.at(u);
-		index b = membership.at(v);
-		assert (a < nBlocks);
-		assert (b < nBlocks);
-		double p = affinity.at(a).at(b);
-		double r = Aux::Random::real();
-		if (r <= p) {
-			G.addEdge(u, v);
+	const bool degreeCorrected = !degreeWeights.empty();
+
+	// bucket the nodes by block; for the degree corrected model, each bucket
+	// is sorted by descending weight to allow the skipping of Miller and Hagberg
+	std::vector<index> blockBegin(nBlocks + 1, 0);
+	for (index b : membership)
+		++blockBegin[b + 1];
+	for (index b = 0; b < nBlocks; ++b)
+		blockBegin[b + 1] += blockBegin[b];
+
+	std::vector<node> members(n);
+	{
+		std::vector<index> next(blockBegin.begin(), blockBegin.end() - 1);
+		for (node u = 0; u < n; ++u)
+			members[next[membership[u]]++] = u;
+	}
+
+	std::vector<double> memberWeights;
+	if (degreeCorrected) {
+		#pragma omp parallel for schedule(dynamic, 1)
+		for (omp_index b = 0; b < static_cast<omp_index>(nBlocks); ++b) {
+			std::sort(members.begin() + blockBegin[b], members.begin() + blockBegin[b + 1], [&](node u, node v) {
+				return degreeWeights[u] > degreeWeights[v] || (degreeWeights[u] == degreeWeights[v] && u < v);
+			});
 		}
-	});
-	return G;
+
+		memberWeights.resize(n);
+		#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); ++i)
+			memberWeights[i] = degreeWeights[members[i]];
+	}
+
+	// A unit owns the rows [rowBegin, rowEnd) of one block a and emits all their
+	// edges into the blocks b <= a. As no two units share a row, they may add
+	// their half edges to the builder concurrently.
+	struct WorkUnit {
+		index block;
+		index rowBegin;
+		index rowEnd;
+	};
+
+	std::vector<WorkUnit> units;
+	for (index a = 0; a < nBlocks; ++a) {
+		const count size = blockBegin[a + 1] - blockBegin[a];
+		double rowWork = 1.0 + std::min(affinity[a][a], 1.0) * size / 2;
+		for (index b = 0; b < a; ++b)
+			rowWork += std::min(affinity[a][b], 1.0) * (blockBegin[b + 1] - blockBegin[b]);
+
+		const count rowsPerUnit = std::max<count>(1, static_cast<count>(unitGrain / rowWork));
+		for (index r = 0; r < size; r += rowsPerUnit)
+			units.push_back({a, r, std::min(size, r + rowsPerUnit)});
+	}
+
+	GraphBuilder builder(n);
+	const uint64_t baseSeed = Aux::Random::integer();
+	Aux::SignalHandler handler;
+
+	#pragma omp parallel for schedule(dynamic, 1)
+	for (omp_index i = 0; i < static_cast<omp_index>(units.size()); ++i) {
+		if (!handler.isRunning()) continue;
+
+		const WorkUnit& unit = units[i];
+		const index a = unit.block;
+		const node* rowMembers = members.data() + blockBegin[a];
+		std::mt19937_64 urng(Aux::Random::streamSeed(baseSeed, i));
+
+		for (index b = 0; b <= a; ++b) {
+			const double p = affinity[a][b];
+			if (p <= 0.0) continue;
+
+			const node* colMembers = members.data() + blockBegin[b];
+			const count colSize = blockBegin[b + 1] - blockBegin[b];
+
+			if (degreeCorrected) {
+				const double* rowWeights = memberWeights.data() + blockBegin[a];
+				const double* colWeights = memberWeights.data() + blockBegin[b];
+				for (index r = unit.rowBegin; r < unit.rowEnd; ++r) {
+					generateCorrectedRow(urng, p * rowWeights[r], colWeights, (a == b) ? r : colSize,
+						[&](index c) {
+							builder.addHalfOutEdge(rowMembers[r], colMembers[c]);
+						});
+				}
+
+			} else if (a != b) {
+				// rectangle [rowBegin, rowEnd) x [0, colSize)
+				const count rows = unit.rowEnd - unit.rowBegin;
+				skipWalk(urng, rows * colSize, p, [&](count pos) {
+					builder.addHalfOutEdge(rowMembers[unit.rowBegin + pos / colSize], colMembers[pos % colSize]);
+				});
+
+			} else {
+				// lower triangle; row r has the columns [0, r)
+				const count offset = unit.rowBegin * (unit.rowBegin - 1) / 2;
+				const count length = unit.rowEnd * (unit.rowEnd - 1) / 2 - offset;
+
+				index r = unit.rowBegin;
+				count rowStart = 0;
+				skipWalk(urng, length, p, [&](count pos) {
+					while (pos >= rowStart + r) {
+						rowStart += r;
+						++r;
+					}
+					builder.addHalfOutEdge(rowMembers[r], colMembers[pos - rowStart]);
+				});
+			}
+		}
+	}
+
+	handler.assureRunning();
+
+	return builder.toGraph(true, true);
 }
 
 } /* namespace NetworKit */
@@ -13,19 +13,48 @@
 namespace NetworKit {
 
 
+/**
+ * @ingroup generators
+ * Generates undirected graphs from the stochastic block model. Two nodes u, v
+ * in the blocks a, b are connected with probability affinity[a][b]; in the
+ * degree corrected variant (Karrer, Newman: Stochastic blockmodels and
+ * community structure in networks, 2011) with probability
+ * min(1, theta[u] * theta[v] * affinity[a][b]).
+ *
+ * Instead of drawing a random number for each node pair, the generator
+ * skips over non-edges of each block pair with geometrically distributed
+ * steps (as @ref ErdosRenyiEnumerator does); in the degree corrected model
+ * it uses the skipping of Miller and Hagberg (see @ref ChungLuGenerator).
+ * The expected running time is O(n + m + k^2) and O(k n + m) respectively,
+ * parallelised over chunks of rows of each block.
+ */
 class StochasticBlockmodel: public StaticGraphGenerator {
 
 public:
 	/**
-	* Construct a undirected regular ring lattice.
+	* Construct a stochastic block model.
 	*
 	* @param nNodes 		number of nodes in target graph
 	* @param n		number of blocks (=k)
 	* @param membership		maps node ids to block ids (consecutive, 0 <= i < nBlocks)
-	* @param affinity		matrix of size k x k with edge probabilities betweeen the blocks
+	* @param affinity		symmetric matrix of size k x k with edge probabilities betweeen the blocks; a std::runtime_error is thrown if it is not symmetric
 	*/
 	StochasticBlockmodel(count n, count nBlocks, const std::vector<index>& membership, const std::vector<std::vector<double> >& affinity);
 
+	/**
+	* Construct a degree corrected stochastic block model. If the weights
+	* average to one within each block, the expected number of edges
+	* between two blocks is the same as in the uncorrected model (up to
+	* probabilities capped at one).
+	*
+	* @param nNodes 		number of nodes in target graph
+	* @param n		number of blocks (=k)
+	* @param membership		maps node ids to block ids (consecutive, 0 <= i < nBlocks)
+	* @param affinity		symmetric matrix of size k x k with edge affinities betweeen the blocks
+	* @param degreeWeights		non-negative weight theta of each node
+	*/
+	StochasticBlockmodel(count n, count nBlocks, const std::vector<index>& membership, const std::vector<std::vector<double> >& affinity, const std::vector<double>& degreeWeights);
+
 	virtual Graph generate();
 
 protected:
@@ -33,6 +62,7 @@ protected:
 		count nBlocks;
 		std::vector<index> membership;
 		std::vector<std::vector<double> > affinity;
+		std::vector<double> degreeWeights; //!< empty unless degree corrected
 
 };
 
@@ -105,6 +105,20 @@ public:
 		root.getElementsInEuclideanCircle(circleCenter, radius, circleDenizens);
 	}
 
+	/**
+	 * Answers a batch of queries in parallel; results[i] holds the elements
+	 * with a distance smaller than radii[i] to centers[i].
+	 */
+	void getElementsInEuclideanCircles(const vector<Point<double> > &centers, const vector<double> &radii, vector<vector<T> > &results) const {
+		assert(centers.size() == radii.size());
+		results.resize(centers.size());
+		#pragma omp parallel for schedule(dynamic, 16)
+		for (omp_index i = 0; i < static_cast<omp_index>(centers.size()); i++) {
+			results[i].clear();
+			root.getElementsInEuclideanCircle(centers[i], radii[i], results[i]);
+		}
+	}
+
 	template<typename L>
 	count getElementsProbabilistically(Point<double> euQuery, L prob, vector<T> &circleDenizens) {
 		return root.getElementsProbabilistically(euQuery, prob, circleDenizens);
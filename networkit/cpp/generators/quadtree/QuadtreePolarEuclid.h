@@ -86,7 +86,21 @@ public:
 	}
 
 	void getElementsInEuclideanCircle(const Point2D<double> circleCenter, const double radius, vector<T> &circleDenizens) const {
-		root.getElementsInEuclideanCircle(circleCenter, radius, false, circleDenizens);
+		root.getElementsInEuclideanCircle(circleCenter, radius, circleDenizens);
+	}
+
+	/**
+	 * Answers a batch of queries in parallel; results[i] holds the elements
+	 * with a distance smaller than radii[i] to centers[i].
+	 */
+	void getElementsInEuclideanCircles(const vector<Point2D<double> > &centers, const vector<double> &radii, vector<vector<T> > &results) const {
+		assert(centers.size() == radii.size());
+		results.resize(centers.size());
+		#pragma omp parallel for schedule(dynamic, 16)
+		for (omp_index i = 0; i < static_cast<omp_index>(centers.size()); i++) {
+			results[i].clear();
+			root.getElementsInEuclideanCircle(centers[i], radii[i], results[i]);
+		}
 	}
 
 	count getElementsProbabilistically(Point2D<double> euQuery, std::function<double(double)> prob, vector<T> &circleDenizens) {
@@ -0,0 +1,425 @@
+/*
+ * StaticQuadtreeCartesianEuclid.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef STATICQUADTREECARTESIANEUCLID_H_
+#define STATICQUADTREECARTESIANEUCLID_H_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <omp.h>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "../../Globals.h"
+#include "../../auxiliary/Parallel.h"
+#include "../../geometric/HyperbolicSpace.h"
+#include "../../viz/Point.h"
+
+namespace NetworKit {
+
+using std::vector;
+
+/**
+ * Read-only quadtree (a 2^d-ary tree in d dimensions) for Euclidean range
+ * queries, as an alternative to @ref QuadtreeCartesianEuclid when all points
+ * are known in advance.
+ *
+ * The tree is bulk loaded in parallel: the points are sorted along a Morton
+ * (Z-order) curve, so that every cell of the tree covers a contiguous range
+ * of the sorted points. The cells are then split level by level, all cells
+ * of a level in parallel, and the bounding boxes are computed bottom-up from
+ * the points. Nodes are stored in a single array; the children of a node are
+ * consecutive and empty children are omitted.
+ *
+ * Queries are safe to call in parallel. @ref getElementsInEuclideanCircles
+ * answers a batch of queries in parallel, processing them in Morton order of
+ * their centers to improve cache locality.
+ */
+template <class T>
+class StaticQuadtreeCartesianEuclid {
+	struct Node {
+		index begin;       //< first point of the cell
+		index end;         //< one past the last point of the cell
+		index firstChild;
+		count numChildren; //< 0 for leaves
+	};
+
+public:
+	/**
+	 * @param positions positions of the points, all of the same dimension
+	 * @param content content of the points
+	 * @param capacity maximal number of points in a leaf cell (unless all of them coincide)
+	 */
+	StaticQuadtreeCartesianEuclid(const vector<Point<double> > &positions, const vector<T> &content, count capacity = 64) :
+		dimension(positions.empty() ? 2 : positions[0].getDimensions()), capacity(std::max<count>(capacity, 1))
+	{
+		if (positions.size() != content.size()) {
+			throw std::runtime_error("Number of positions and content must match");
+		}
+		if (dimension == 0 || dimension > 32) {
+			throw std::runtime_error("Dimension must be between 1 and 32");
+		}
+
+		const count n = positions.size();
+		for (const Point<double> &pos : positions) {
+			if (pos.getDimensions() != dimension) {
+				throw std::runtime_error("All positions must have the same dimension");
+			}
+		}
+
+		vector<double> coordinates(n * dimension);
+		#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+			for (index d = 0; d < dimension; d++) {
+				coordinates[i * dimension + d] = positions[i][d];
+			}
+		}
+
+		build(coordinates, content);
+	}
+
+	/**
+	 * Builds a two-dimensional tree from polar coordinates. Queries are given
+	 * in Cartesian coordinates, see @ref HyperbolicSpace::polarToCartesian.
+	 *
+	 * @param angles angular coordinates of the points
+	 * @param radii radial coordinates of the points
+	 * @param content content of the points
+	 * @param capacity maximal number of points in a leaf cell
+	 */
+	StaticQuadtreeCartesianEuclid(const vector<double> &angles, const vector<double> &radii, const vector<T> &content, count capacity = 64) :
+		dimension(2), capacity(std::max<count>(capacity, 1))
+	{
+		if (angles.size() != radii.size() || angles.size() != content.size()) {
+			throw std::runtime_error("Number of angles, radii and content must match");
+		}
+
+		const count n = angles.size();
+		vector<double> coordinates(2 * n);
+		#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+			const Point2D<double> pos = HyperbolicSpace::polarToCartesian(angles[i], radii[i]);
+			coordinates[2 * i] = pos.getX();
+			coordinates[2 * i + 1] = pos.getY();
+		}
+
+		build(coordinates, content);
+	}
+
+	/**
+	 * Appends all elements with a Euclidean distance smaller than @a radius to
+	 * @a center to @a result.
+	 */
+	void getElementsInEuclideanCircle(const Point<double> &center, double radius, vector<T> &result) const {
+		assert(center.getDimensions() == dimension);
+		if (nodes.empty()) return;
+
+		const double rsq = radius * radius;
+		vector<index> stack(1, 0);
+
+		while (!stack.empty()) {
+			const index v = stack.back();
+			stack.pop_back();
+			const Node &node = nodes[v];
+
+			double minDistance, maxDistance;
+			std::tie(minDistance, maxDistance) = squaredDistancesToBox(center, v);
+			if (minDistance >= rsq) continue;
+
+			if (maxDistance < rsq) {
+				result.insert(result.end(), content.begin() + node.begin, content.begin() + node.end);
+			} else if (node.numChildren == 0) {
+				for (index i = node.begin; i < node.end; i++) {
+					if (squaredDistanceToPoint(center, i) < rsq) {
+						result.push_back(content[i]);
+					}
+				}
+			} else {
+				for (index c = 0; c < node.numChildren; c++) {
+					stack.push_back(node.firstChild + c);
+				}
+			}
+		}
+	}
+
+	/**
+	 * Answers a batch of queries in parallel; results[i] holds the elements
+	 * with a distance smaller than radii[i] to centers[i].
+	 */
+	void getElementsInEuclideanCircles(const vector<Point<double> > &centers, const vector<double> &radii, vector<vector<T> > &results) const {
+		if (centers.size() != radii.size()) {
+			throw std::runtime_error("Number of centers and radii must match");
+		}
+
+		const count numQueries = centers.size();
+		results.resize(numQueries);
+
+		vector<std::pair<uint64_t, index> > order(numQueries);
+		#pragma omp parallel for
+		for (omp_index q = 0; q < static_cast<omp_index>(numQueries); q++) {
+			order[q] = std::make_pair(mortonKey([&](index d) { return centers[q][d]; }), q);
+		}
+		Aux::Parallel::sort(order.begin(), order.end());
+
+		#pragma omp parallel for schedule(dynamic, 16)
+		for (omp_index i = 0; i < static_cast<omp_index>(numQueries); i++) {
+			const index q = order[i].second;
+			results[q].clear();
+			getElementsInEuclideanCircle(centers[q], radii[q], results[q]);
+		}
+	}
+
+	/**
+	 * Same as above with the same radius for all queries.
+	 */
+	void getElementsInEuclideanCircles(const vector<Point<double> > &centers, double radius, vector<vector<T> > &results) const {
+		getElementsInEuclideanCircles(centers, vector<double>(centers.size(), radius), results);
+	}
+
+	/**
+	 * Get all elements, in the order of the space-filling curve
+	 */
+	const vector<T> &getElements() const {
+		return content;
+	}
+
+	count size() const {
+		return content.size();
+	}
+
+	count height() const {
+		return levelBegin.size() - 1;
+	}
+
+	count countLeaves() const {
+		count result = 0;
+		for (const Node &node : nodes) {
+			if (node.numChildren == 0) result++;
+		}
+		return result;
+	}
+
+	count getDimension() const {
+		return dimension;
+	}
+
+private:
+	count dimension;
+	count capacity;
+	count bitsPerDimension;
+
+	vector<double> lowerCorner;  //< lower corner of the quantization grid
+	vector<double> cellWidth;    //< width of a grid cell in each dimension
+
+	vector<Node> nodes;
+	vector<index> levelBegin;    //< nodes of level l are [levelBegin[l], levelBegin[l+1])
+	vector<double> lowerBounds;  //< bounding box of node v is [lowerBounds[v*d+i], upperBounds[v*d+i]]
+	vector<double> upperBounds;
+
+	vector<double> coordinates;  //< coordinates of point i are at [i*d, (i+1)*d)
+	vector<T> content;
+
+	/**
+	 * Interleaves the quantized coordinates returned by @a coordinate(d),
+	 * most significant bits first. Coordinates outside the grid are clamped.
+	 */
+	template <typename Coordinate>
+	uint64_t mortonKey(Coordinate coordinate) const {
+		const uint64_t maxCell = (uint64_t{1} << bitsPerDimension) - 1;
+		uint64_t key = 0;
+		uint64_t cells[32]; // the dimension is at most 32
+		for (index d = 0; d < dimension; d++) {
+			const double relative = (coordinate(d) - lowerCorner[d]) / cellWidth[d];
+			cells[d] = relative <= 0 ? 0 : std::min<uint64_t>(maxCell, static_cast<uint64_t>(relative));
+		}
+		for (index bit = bitsPerDimension; bit-- > 0;) {
+			for (index d = 0; d < dimension; d++) {
+				key = (key << 1) | ((cells[d] >> bit) & 1);
+			}
+		}
+		return key;
+	}
+
+	/**
+	 * Child number of a key at the given level, i.e. the d bits below the prefix shared by the cell
+	 */
+	uint64_t digit(uint64_t key, count level) const {
+		const count shift = (bitsPerDimension - 1 - level) * dimension;
+		return (key >> shift) & ((uint64_t{1} << dimension) - 1);
+	}
+
+	void build(const vector<double> &unsortedCoordinates, const vector<T> &unsortedContent) {
+		const count n = unsortedContent.size();
+		bitsPerDimension = std::min<count>(64 / dimension, 31);
+
+		// bounding box of all points determines the grid
+		lowerCorner.assign(dimension, 0.0);
+		cellWidth.assign(dimension, 1.0);
+		for (index d = 0; d < dimension && n > 0; d++) {
+			double low = std::numeric_limits<double>::max();
+			double high = std::numeric_limits<double>::lowest();
+			#pragma omp parallel for reduction(min : low) reduction(max : high)
+			for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+				low = std::min(low, unsortedCoordinates[i * dimension + d]);
+				high = std::max(high, unsortedCoordinates[i * dimension + d]);
+			}
+			lowerCorner[d] = low;
+			const double extent = high - low;
+			cellWidth[d] = extent > 0 ? extent / std::ldexp(1.0, bitsPerDimension) : 1.0;
+		}
+
+		// sort the points along the space-filling curve
+		vector<std::pair<uint64_t, index> > order(n);
+		#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+			order[i] = std::make_pair(mortonKey([&](index d) { return unsortedCoordinates[i * dimension + d]; }), i);
+		}
+		Aux::Parallel::sort(order.begin(), order.end());
+
+		coordinates.resize(n * dimension);
+		content.resize(n);
+		#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); i++) {
+			const index source = order[i].second;
+			std::copy(unsortedCoordinates.begin() + source * dimension, unsortedCoordinates.begin() + (source + 1) * dimension, coordinates.begin() + i * dimension);
+			content[i] = unsortedContent[source];
+		}
+
+		buildLevels(order);
+		computeBoundingBoxes();
+	}
+
+	/**
+	 * Splits the cells level by level; the cells of a level are handled in parallel.
+	 */
+	void buildLevels(const vector<std::pair<uint64_t, index> > &order) {
+		nodes.clear();
+		levelBegin.assign(1, 0);
+		if (order.empty()) return;
+
+		nodes.push_back({0, order.size(), 0, 0});
+		levelBegin.push_back(1);
+
+		const count maxChildren = count{1} << dimension;
+		auto forChildRanges = [&](const Node &node, count level, std::function<void(index, index)> handle) {
+			auto digitLess = [&](const std::pair<uint64_t, index> &entry, uint64_t value) {
+				return digit(entry.first, level) < value;
+			};
+			index begin = node.begin;
+			while (begin < node.end) {
+				const uint64_t childDigit = digit(order[begin].first, level);
+				const index end = std::lower_bound(order.begin() + begin, order.begin() + node.end, childDigit + 1, digitLess) - order.begin();
+				handle(begin, end);
+				begin = end;
+			}
+		};
+
+		for (count level = 0; level < bitsPerDimension; level++) {
+			const index first = levelBegin[level];
+			const index last = levelBegin[level + 1];
+
+			// count the non-empty children of each cell that is split
+			vector<count> offsets(last - first + 1, 0);
+			#pragma omp parallel for schedule(guided)
+			for (omp_index v = first; v < static_cast<omp_index>(last); v++) {
+				const Node &node = nodes[v];
+				if (node.end - node.begin <= capacity) continue;
+				count numChildren = 0;
+				forChildRanges(node, level, [&](index, index) { numChildren++; });
+				assert(numChildren <= maxChildren);
+				offsets[v - first + 1] = numChildren;
+			}
+			for (index i = 1; i < offsets.size(); i++) {
+				offsets[i] += offsets[i - 1];
+			}
+			if (offsets.back() == 0) break;
+
+			nodes.resize(last + offsets.back());
+			#pragma omp parallel for schedule(guided)
+			for (omp_index v = first; v < static_cast<omp_index>(last); v++) {
+				Node &node = nodes[v];
+				const count numChildren = offsets[v - first + 1] - offsets[v - first];
+				if (numChildren == 0) continue;
+				node.firstChild = last + offsets[v - first];
+				node.numChildren = numChildren;
+				index child = node.firstChild;
+				forChildRanges(node, level, [&](index begin, index end) {
+					nodes[child++] = {begin, end, 0, 0};
+				});
+			}
+			levelBegin.push_back(nodes.size());
+		}
+	}
+
+	/**
+	 * Computes tight bounding boxes bottom-up: leaves from their points,
+	 * inner nodes from their children.
+	 */
+	void computeBoundingBoxes() {
+		lowerBounds.assign(nodes.size() * dimension, std::numeric_limits<double>::max());
+		upperBounds.assign(nodes.size() * dimension, std::numeric_limits<double>::lowest());
+
+		for (index level = levelBegin.size() - 1; level-- > 0;) {
+			#pragma omp parallel for schedule(guided)
+			for (omp_index v = levelBegin[level]; v < static_cast<omp_index>(levelBegin[level + 1]); v++) {
+				const Node &node = nodes[v];
+				double *lower = &lowerBounds[v * dimension];
+				double *upper = &upperBounds[v * dimension];
+				if (node.numChildren == 0) {
+					for (index i = node.begin; i < node.end; i++) {
+						for (index d = 0; d < dimension; d++) {
+							lower[d] = std::min(lower[d], coordinates[i * dimension + d]);
+							upper[d] = std::max(upper[d], coordinates[i * dimension + d]);
+						}
+					}
+				} else {
+					for (index c = node.firstChild; c < node.firstChild + node.numChildren; c++) {
+						for (index d = 0; d < dimension; d++) {
+							lower[d] = std::min(lower[d], lowerBounds[c * dimension + d]);
+							upper[d] = std::max(upper[d], upperBounds[c * dimension + d]);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	/**
+	 * Squared minimal and maximal distance between @a query and the bounding box of node v
+	 */
+	std::pair<double, double> squaredDistancesToBox(const Point<double> &query, index v) const {
+		double minDistance = 0, maxDistance = 0;
+		for (index d = 0; d < dimension; d++) {
+			const double lower = lowerBounds[v * dimension + d];
+			const double upper = upperBounds[v * dimension + d];
+			const double below = lower - query[d];
+			const double above = query[d] - upper;
+			const double closest = std::max(0.0, std::max(below, above));
+			const double farthest = std::max(std::abs(below), std::abs(above));
+			minDistance += closest * closest;
+			maxDistance += farthest * farthest;
+		}
+		return std::make_pair(minDistance, maxDistance);
+	}
+
+	double squaredDistanceToPoint(const Point<double> &query, index i) const {
+		double result = 0;
+		for (index d = 0; d < dimension; d++) {
+			const double diff = coordinates[i * dimension + d] - query[d];
+			result += diff * diff;
+		}
+		return result;
+	}
+};
+}
+
+#endif /* STATICQUADTREECARTESIANEUCLID_H_ */
@@ -20,6 +20,7 @@
 
 #include "../QuadtreeCartesianEuclid.h"
 #include "../QuadtreePolarEuclid.h"
+#include "../StaticQuadtreeCartesianEuclid.h"
 
 namespace NetworKit {
 
@@ -540,6 +541,18 @@ TEST_F(QuadTreeGTest, testCartesianEuclidQuery) {
 	near.clear();
 	quad.getElementsProbabilistically(positions[0], edgeProb2, near);
 	EXPECT_EQ(0u, near.size());
+
+	vector<double> radii(n, 0.01);
+	vector<vector<index> > results;
+	quad.getElementsInEuclideanCircles(positions, radii, results);
+	ASSERT_EQ(n, results.size());
+	for (index i = 0; i < 100; i++) {
+		count expected = 0;
+		for (index j = 0; j < n; j++) {
+			if (positions[i].distance(positions[j]) < radii[i]) expected++;
+		}
+		EXPECT_EQ(expected, results[i].size());
+	}
 }
 
 
@@ -867,4 +880,112 @@ TEST_F(QuadTreeGTest, testQuadNodeCartesianDistances) {
 
 }
 
+TEST_F(QuadTreeGTest, testStaticCartesianEuclidQuery) {
+	Aux::Random::setSeed(42, false);
+	const count n = 20000;
+
+	for (count dimension : {2, 3}) {
+		vector<Point<double> > positions(n);
+		vector<index> content(n);
+		for (index i = 0; i < n; i++) {
+			if (i % 100 == 99) {
+				// some coinciding points
+				positions[i] = positions[i-1];
+			} else {
+				vector<double> coordinates(dimension);
+				for (index d = 0; d < dimension; d++) {
+					coordinates[d] = Aux::Random::real(-1, 1);
+				}
+				positions[i] = Point<double>(coordinates);
+			}
+			content[i] = i;
+		}
+
+		StaticQuadtreeCartesianEuclid<index> tree(positions, content, 16);
+		EXPECT_EQ(n, tree.size());
+		EXPECT_EQ(dimension, tree.getDimension());
+		EXPECT_GT(tree.height(), 1u);
+		EXPECT_GE(tree.countLeaves(), n / 16);
+
+		vector<index> elements = tree.getElements();
+		std::sort(elements.begin(), elements.end());
+		EXPECT_EQ(content, elements);
+
+		const count numQueries = 200;
+		vector<Point<double> > centers(numQueries);
+		vector<double> radii(numQueries);
+		for (index q = 0; q < numQueries; q++) {
+			centers[q] = positions[Aux::Random::integer(n-1)];
+			radii[q] = Aux::Random::real(0, 0.5);
+		}
+		vector<vector<index> > results;
+		tree.getElementsInEuclideanCircles(centers, radii, results);
+		ASSERT_EQ(numQueries, results.size());
+
+		for (index q = 0; q < numQueries; q++) {
+			vector<index> expected;
+			for (index i = 0; i < n; i++) {
+				if (positions[i].squaredDistance(centers[q]) < radii[q] * radii[q]) {
+					expected.push_back(i);
+				}
+			}
+
+			vector<index> single;
+			tree.getElementsInEuclideanCircle(centers[q], radii[q], single);
+			std::sort(single.begin(), single.end());
+			EXPECT_EQ(expected, single);
+
+			std::sort(results[q].begin(), results[q].end());
+			EXPECT_EQ(expected, results[q]);
+		}
+	}
+
+	StaticQuadtreeCartesianEuclid<index> empty{vector<Point<double> >(), vector<index>()};
+	vector<index> result;
+	empty.getElementsInEuclideanCircle(Point<double>({0.0, 0.0}), 1, result);
+	EXPECT_EQ(0u, empty.size());
+	EXPECT_TRUE(result.empty());
+}
+
+TEST_F(QuadTreeGTest, testStaticPolarEuclidQuery) {
+	Aux::Random::setSeed(42, false);
+	const count n = 10000;
+	vector<double> angles(n);
+	vector<double> radii(n);
+	vector<index> content(n);
+	for (index i = 0; i < n; i++) {
+		angles[i] = Aux::Random::real(0, 2*PI);
+		radii[i] = Aux::Random::real(0, 0.99);
+		content[i] = i;
+	}
+
+	QuadtreePolarEuclid<index> dynamicTree(angles, radii, content, true);
+	StaticQuadtreeCartesianEuclid<index> staticTree(angles, radii, content);
+
+	const count numQueries = 100;
+	vector<Point2D<double> > centers(numQueries);
+	vector<Point<double> > staticCenters(numQueries);
+	vector<double> queryRadii(numQueries);
+	for (index q = 0; q < numQueries; q++) {
+		index query = Aux::Random::integer(n-1);
+		centers[q] = HyperbolicSpace::polarToCartesian(angles[query], radii[query]);
+		staticCenters[q] = Point<double>({centers[q].getX(), centers[q].getY()});
+		queryRadii[q] = Aux::Random::real(0, 0.5);
+	}
+
+	vector<vector<index> > dynamicResults, staticResults;
+	dynamicTree.getElementsInEuclideanCircles(centers, queryRadii, dynamicResults);
+	staticTree.getElementsInEuclideanCircles(staticCenters, queryRadii, staticResults);
+
+	for (index q = 0; q < numQueries; q++) {
+		vector<index> single;
+		dynamicTree.getElementsInEuclideanCircle(centers[q], queryRadii[q], single);
+		std::sort(single.begin(), single.end());
+		std::sort(dynamicResults[q].begin(), dynamicResults[q].end());
+		std::sort(staticResults[q].begin(), staticResults[q].end());
+		EXPECT_EQ(single, dynamicResults[q]);
+		EXPECT_EQ(single, staticResults[q]);
+	}
+}
+
 } /* namespace NetworKit */
@@ -7,8 +7,18 @@ Dy * GeneratorsTest.cpp
 
 #include <gtest/gtest.h>
 
+#include <omp.h>
+
 #include <numeric>
 #include <cmath>
+#include <fstream>
+#include <sstream>
+#ifdef NETWORKIT_WINDOWS
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
 
 #include "../ClusteredRandomGraphGenerator.h"
 #include "../DynamicGraphSource.h"
@@ -303,6 +313,49 @@ TEST_F(GeneratorsGTest, testDynamicHyperbolicGeneratorOnMovedNodes) {
 	EXPECT_NEAR(G.numberOfEdges(), initialEdgeCount, initialEdgeCount/5);
 }
 
+TEST_F(GeneratorsGTest, testDynamicHyperbolicGeneratorAddNodes) {
+	for (double T : {0.0, 0.5}) {
+		Aux::Random::setSeed(0, false);
+		const count n = 1000;
+		DynamicHyperbolicGenerator dynGen(n, 6, 3, T);
+		Graph G = dynGen.getGraph();
+		GraphUpdater gu(G);
+
+		for (index step = 0; step < 3; step++) {
+			const count oldEdges = G.numberOfEdges();
+			std::vector<GraphEvent> stream = dynGen.addNodes(300);
+
+			count nodeAdditions = 0;
+			for (const GraphEvent &event : stream) {
+				if (event.type == GraphEvent::NODE_ADDITION) {
+					EXPECT_EQ(G.upperNodeIdBound() + nodeAdditions, event.u);
+					++nodeAdditions;
+				} else if (event.type == GraphEvent::EDGE_ADDITION) {
+					// every new edge has a new endpoint
+					EXPECT_LT(event.u, event.v);
+					EXPECT_GE(event.v, G.upperNodeIdBound());
+				} else {
+					EXPECT_EQ(GraphEvent::TIME_STEP, event.type);
+				}
+			}
+			EXPECT_EQ(300u, nodeAdditions);
+
+			gu.update(stream);
+			EXPECT_TRUE(G.checkConsistency());
+			EXPECT_GT(G.numberOfEdges(), oldEdges);
+		}
+		EXPECT_EQ(n + 900, G.numberOfNodes());
+
+		if (T == 0) {
+			Graph comparison = dynGen.getGraph();
+			EXPECT_EQ(comparison.numberOfEdges(), G.numberOfEdges());
+			comparison.forEdges([&](node u, node v) {
+				EXPECT_TRUE(G.hasEdge(u, v));
+			});
+		}
+	}
+}
+
 /**
  * creates a series of pictures visualizing the effect of the dynamic hyperbolic generator
  */
@@ -437,6 +490,41 @@ TEST_F(GeneratorsGTest, testBarabasiAlbertGeneratorBatagelj) {
 
 }
 
+TEST_F(GeneratorsGTest, testBarabasiAlbertGeneratorBatageljReproducibility) {
+	const count k = 4, nMax = 20000, n0 = 5;
+
+	auto generateWithThreads = [&](int threads) {
+		const int oldThreads = omp_get_max_threads();
+		omp_set_num_threads(threads);
+		Aux::Random::setSeed(42, false);
+		BarabasiAlbertGenerator generator(k, nMax, n0, true);
+		Graph G = generator.generate();
+		omp_set_num_threads(oldThreads);
+		return G;
+	};
+
+	Graph G1 = generateWithThreads(1);
+	Graph G2 = generateWithThreads(4);
+
+	EXPECT_TRUE(G1.checkConsistency());
+	EXPECT_EQ(0u, G1.numberOfSelfLoops());
+	EXPECT_LE(G1.numberOfEdges(), (n0 - 1) + (nMax - n0) * k);
+	// only few edges are lost to self loops and duplicates
+	EXPECT_GE(G1.numberOfEdges(), 0.9 * (nMax - n0) * k);
+
+	// preferential attachment results in hubs
+	count maxDegree = 0;
+	G1.forNodes([&](node u) {
+		maxDegree = std::max(maxDegree, G1.degree(u));
+	});
+	EXPECT_GE(maxDegree, 10 * k);
+
+	ASSERT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+	G1.forEdges([&](node u, node v) {
+		EXPECT_TRUE(G2.hasEdge(u, v));
+	});
+}
+
 TEST_F(GeneratorsGTest, generatetBarabasiAlbertGeneratorGraph) {
 		count k = 3;
 		count nMax = 1000;
@@ -522,6 +610,139 @@ TEST_F(GeneratorsGTest, testRmatGenerator) {
 }
 
 
+TEST_F(GeneratorsGTest, testRmatGeneratorReproducibility) {
+	auto generateWithThreads = [&](int threads) {
+		const int oldThreads = omp_get_max_threads();
+		omp_set_num_threads(threads);
+		Aux::Random::setSeed(42, false);
+		RmatGenerator rmat(10, 8, 0.57, 0.19, 0.19, 0.05);
+		Graph G = rmat.generate();
+		omp_set_num_threads(oldThreads);
+		return G;
+	};
+
+	Graph G1 = generateWithThreads(1);
+	Graph G2 = generateWithThreads(4);
+
+	EXPECT_TRUE(G1.checkConsistency());
+	EXPECT_EQ(G1.numberOfEdges(), 8u << 10);
+	ASSERT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+	G1.forEdges([&](node u, node v) {
+		EXPECT_TRUE(G2.hasEdge(u, v));
+	});
+}
+
+TEST_F(GeneratorsGTest, testRmatGeneratorEdgeStream) {
+	for (bool externalMemory : {false, true}) {
+		RmatGenerator rmat(10, 8, 0.57, 0.19, 0.19, 0.05, true);
+		if (externalMemory)
+			rmat.setExternalMemoryParameters(1000, "output");
+
+		Aux::Random::setSeed(42, false);
+		Graph G = rmat.generate();
+
+		Aux::Random::setSeed(42, false);
+		count numEdges = 0;
+		edgeweight totalWeight = 0.0;
+		std::pair<node, node> last{0, 0};
+		rmat.forEdgeBatches([&](const EdgeStreamGenerator::EdgeBatch& batch) {
+			for (const WeightedEdge& e : batch) {
+				EXPECT_LE(e.u, e.v);
+				if (numEdges) {
+					EXPECT_LT(last, std::make_pair(e.u, e.v));
+				}
+				last = std::make_pair(e.u, e.v);
+				EXPECT_EQ(G.weight(e.u, e.v), e.weight);
+				++numEdges;
+				totalWeight += e.weight;
+			}
+		});
+
+		EXPECT_EQ(G.numberOfEdges(), numEdges);
+		EXPECT_EQ(G.totalEdgeWeight(), totalWeight);
+		EXPECT_EQ(static_cast<edgeweight>(8u << 10), totalWeight);
+	}
+
+	// the run files are removed if the handle throws
+	RmatGenerator rmat(10, 8, 0.57, 0.19, 0.19, 0.05, true);
+	rmat.setExternalMemoryParameters(1000, "output");
+	EXPECT_THROW(rmat.forEdgeBatches([&](const EdgeStreamGenerator::EdgeBatch&) {
+		throw std::runtime_error("abort");
+	}), std::runtime_error);
+	count leftover = 0;
+	for (index id = 0; id < 100; ++id) {
+		for (index run = 0; run < 16; ++run) {
+			std::stringstream path;
+			path << "output/rmat-" << getpid() << "-" << id << "-" << run << ".run";
+			leftover += std::ifstream(path.str()).good();
+		}
+	}
+	EXPECT_EQ(0u, leftover);
+}
+
+TEST_F(GeneratorsGTest, testEdgeStreamGenerators) {
+	// for the same seed, the stream has to contain the edges of generate()
+	auto checkStream = [](StaticGraphGenerator& staticGen, EdgeStreamGenerator& streamGen) {
+		Aux::Random::setSeed(42, false);
+		Graph G = staticGen.generate();
+
+		Aux::Random::setSeed(42, false);
+		count numEdges = 0;
+		std::pair<node, node> last{0, 0};
+		streamGen.forEdgeBatches([&](const EdgeStreamGenerator::EdgeBatch& batch) {
+			for (const WeightedEdge& e : batch) {
+				EXPECT_LT(e.u, e.v);
+				EXPECT_LT(e.v, streamGen.numberOfNodes());
+				if (streamGen.emitsSortedEdges() && numEdges) {
+					EXPECT_LT(last, std::make_pair(e.u, e.v));
+				}
+				last = std::make_pair(e.u, e.v);
+				EXPECT_TRUE(G.hasEdge(e.u, e.v));
+				++numEdges;
+			}
+		});
+
+		EXPECT_EQ(G.numberOfNodes(), streamGen.numberOfNodes());
+		EXPECT_EQ(G.numberOfEdges(), numEdges);
+	};
+
+	std::vector<count> sequence(2000);
+	for (index i = 0; i < sequence.size(); ++i)
+		sequence[i] = 1 + (i * 7919) % 100;
+	ChungLuGenerator chungLu(sequence);
+	checkStream(chungLu, chungLu);
+
+	BarabasiAlbertGenerator barabasiAlbert(5, 20000, 10);
+	checkStream(barabasiAlbert, barabasiAlbert);
+
+	RegularRingLatticeGenerator ringLattice(1000, 7);
+	checkStream(ringLattice, ringLattice);
+
+	HyperbolicGenerator hyperbolic(5000, 8, 2.7);
+	checkStream(hyperbolic, hyperbolic);
+}
+
+TEST_F(GeneratorsGTest, testErdosRenyiGeneratorEdgeStream) {
+	const count n = 2000;
+	ErdosRenyiGenerator generator(n, 0.01);
+
+	std::vector<std::pair<node, node>> edges;
+	generator.forEdgeBatches([&](const EdgeStreamGenerator::EdgeBatch& batch) {
+		for (const WeightedEdge& e : batch) {
+			EXPECT_LT(e.u, e.v);
+			EXPECT_LT(e.v, n);
+			edges.emplace_back(e.u, e.v);
+		}
+	});
+
+	std::sort(edges.begin(), edges.end());
+	EXPECT_TRUE(std::adjacent_find(edges.begin(), edges.end()) == edges.end());
+	EXPECT_NEAR(0.01 * n * (n - 1) / 2, edges.size(), 1000);
+
+	ErdosRenyiGenerator directed(n, 0.01, true);
+	EXPECT_THROW(directed.forEdgeBatches([](const EdgeStreamGenerator::EdgeBatch&) {}), std::runtime_error);
+}
+
 TEST_F(GeneratorsGTest, testChungLuGenerator) {
 	count n = 400;
 	count maxDegree = n / 8;
@@ -587,6 +808,35 @@ TEST_F(GeneratorsGTest, testChungLuGeneratorVolumeConsistency) {
 	EXPECT_NEAR(G.numberOfEdges() * 2, expectedVolume, 0.2 * expectedVolume);
 }
 
+TEST_F(GeneratorsGTest, testChungLuGeneratorReproducibility) {
+	const count n = 20000;
+	std::vector<count> vec(n);
+	for (index i = 0; i < n; i++) {
+		// a few heavy nodes force rows to be split into segments
+		vec[i] = (i < 20) ? n / 4 : Aux::Random::integer(1, 50);
+	}
+
+	auto generateWithThreads = [&](int threads) {
+		const int oldThreads = omp_get_max_threads();
+		omp_set_num_threads(threads);
+		Aux::Random::setSeed(42, false);
+		ChungLuGenerator generator(vec);
+		Graph G = generator.generate();
+		omp_set_num_threads(oldThreads);
+		return G;
+	};
+
+	Graph G1 = generateWithThreads(1);
+	Graph G2 = generateWithThreads(4);
+
+	EXPECT_TRUE(G1.checkConsistency());
+	EXPECT_TRUE(G2.checkConsistency());
+	ASSERT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+	G1.forEdges([&](node u, node v) {
+		EXPECT_TRUE(G2.hasEdge(u, v));
+	});
+}
+
 TEST_F(GeneratorsGTest, testHavelHakimiGeneratorOnRandomSequence) {
 	count n = 400;
 	count maxDegree = n / 10;
@@ -807,6 +1057,70 @@ TEST_F(GeneratorsGTest, testStochasticBlockmodel) {
 
 	EXPECT_EQ(n, G.numberOfNodes());
 	EXPECT_EQ(20u, G.numberOfEdges());
+
+	// an asymmetric affinity matrix is rejected, as the graph is undirected
+	std::vector<std::vector<double> > asymmetric = {{1.0, 0.5}, {0.0, 1.0}};
+	EXPECT_THROW(StochasticBlockmodel(n, nBlocks, membership, asymmetric), std::runtime_error);
+}
+
+TEST_F(GeneratorsGTest, testStochasticBlockmodelEdgeCount) {
+	Aux::Random::setSeed(42, false);
+	const count n = 3000, nBlocks = 3;
+	std::vector<index> membership(n);
+	for (node u = 0; u < n; ++u)
+		membership[u] = u % nBlocks;
+	std::vector<std::vector<double> > affinity = {{0.05, 0.002, 0.0}, {0.002, 0.1, 0.01}, {0.0, 0.01, 0.2}};
+
+	StochasticBlockmodel sbm(n, nBlocks, membership, affinity);
+	Graph G = sbm.generate();
+	EXPECT_TRUE(G.checkConsistency());
+	EXPECT_EQ(0u, G.numberOfSelfLoops());
+
+	const double blockSize = n / nBlocks;
+	double expectedEdges = 0.0;
+	count edgesBetween0And2 = 0;
+	for (index a = 0; a < nBlocks; ++a) {
+		expectedEdges += affinity[a][a] * blockSize * (blockSize - 1) / 2;
+		for (index b = 0; b < a; ++b)
+			expectedEdges += affinity[a][b] * blockSize * blockSize;
+	}
+	G.forEdges([&](node u, node v) {
+		if (membership[u] + membership[v] == 2 && membership[u] != membership[v])
+			++edgesBetween0And2;
+	});
+
+	EXPECT_NEAR(G.numberOfEdges(), expectedEdges, 0.03 * expectedEdges);
+	EXPECT_EQ(0u, edgesBetween0And2);
+}
+
+TEST_F(GeneratorsGTest, testDegreeCorrectedStochasticBlockmodel) {
+	Aux::Random::setSeed(42, false);
+	const count n = 2000, nBlocks = 2;
+	std::vector<index> membership(n);
+	std::vector<double> weights(n);
+	for (node u = 0; u < n; ++u) {
+		membership[u] = u % nBlocks;
+		weights[u] = (u < n / 2) ? 1.5 : 0.5;
+	}
+	std::vector<std::vector<double> > affinity = {{0.02, 0.005}, {0.005, 0.02}};
+
+	StochasticBlockmodel sbm(n, nBlocks, membership, affinity, weights);
+	Graph G = sbm.generate();
+	EXPECT_TRUE(G.checkConsistency());
+
+	// as the weights average to one within each block, the expected number
+	// of edges is the same as in the uncorrected model
+	const double blockSize = n / nBlocks;
+	const double expectedEdges = 2 * 0.02 * blockSize * (blockSize - 1) / 2 + 0.005 * blockSize * blockSize;
+	EXPECT_NEAR(G.numberOfEdges(), expectedEdges, 0.05 * expectedEdges);
+
+	count heavyVolume = 0, lightVolume = 0;
+	G.forNodes([&](node u) {
+		(u < n / 2 ? heavyVolume : lightVolume) += G.degree(u);
+	});
+	EXPECT_NEAR(static_cast<double>(heavyVolume) / lightVolume, 3.0, 0.3);
+
+	EXPECT_THROW(StochasticBlockmodel(n, nBlocks, membership, affinity, std::vector<double>(n - 1, 1.0)), std::runtime_error);
 }
 
 /**
@@ -958,6 +1272,68 @@ TEST_F(GeneratorsGTest, testLFRGenerator) {
 	EXPECT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
 }
 
+TEST_F(GeneratorsGTest, testLFRGeneratorScalableMode) {
+	const count n = 20000;
+	const double mu = 0.3;
+
+	auto setupGenerator = [&](LFRGenerator &gen) {
+		Aux::Random::setSeed(42, false);
+		gen.setScalableMode(true);
+		gen.generatePowerlawDegreeSequence(20, 200, -2);
+		gen.generatePowerlawCommunitySizeSequence(50, 500, -1);
+		gen.setMuWithBinomialDistribution(mu);
+	};
+
+	auto generateWithThreads = [&](int threads) {
+		const int oldThreads = omp_get_max_threads();
+		omp_set_num_threads(threads);
+		LFRGenerator gen(n);
+		setupGenerator(gen);
+		gen.run();
+		omp_set_num_threads(oldThreads);
+		return std::make_pair(gen.getMoveGraph(), gen.getMovePartition());
+	};
+
+	auto result1 = generateWithThreads(1);
+	auto result2 = generateWithThreads(4);
+	const Graph &G = result1.first;
+	const Partition &zeta = result1.second;
+
+	EXPECT_TRUE(G.checkConsistency());
+	EXPECT_EQ(0u, G.numberOfSelfLoops());
+	EXPECT_EQ(n, G.numberOfNodes());
+	EXPECT_GE(G.numberOfEdges(), n * 20 / 2 * 0.95);
+
+	// the result must not depend on the number of threads
+	ASSERT_EQ(G.numberOfEdges(), result2.first.numberOfEdges());
+	G.forEdges([&](node u, node v) {
+		EXPECT_TRUE(result2.first.hasEdge(u, v));
+	});
+	G.forNodes([&](node u) {
+		EXPECT_EQ(zeta[u], result2.second[u]);
+	});
+
+	count interEdges = 0;
+	G.forEdges([&](node u, node v) {
+		if (zeta[u] != zeta[v]) ++interEdges;
+	});
+	EXPECT_NEAR(mu, static_cast<double>(interEdges) / G.numberOfEdges(), 0.05);
+
+	// the stream consists of the same edges
+	LFRGenerator gen(n);
+	setupGenerator(gen);
+	count numEdges = 0;
+	gen.forEdgeBatches([&](const EdgeStreamGenerator::EdgeBatch &batch) {
+		for (const WeightedEdge &e : batch) {
+			EXPECT_LE(e.u, e.v);
+			EXPECT_TRUE(G.hasEdge(e.u, e.v));
+			++numEdges;
+		}
+	});
+	EXPECT_EQ(G.numberOfEdges(), numEdges);
+	EXPECT_EQ(zeta.numberOfSubsets(), gen.getPartition().numberOfSubsets());
+}
+
 TEST_F(GeneratorsGTest, testLFRGeneratorImpossibleSequence) {
 	LFRGenerator gen(100);
 	gen.generatePowerlawDegreeSequence(10, 11, -2);
@@ -1117,4 +1493,26 @@ TEST_F(GeneratorsGTest, testMocnikGeneratorBasic) {
 	EXPECT_NEAR(G.numberOfEdges() * 1. / G.numberOfNodes(), std::pow(k, dim), 10000);
 }
 
+TEST_F(GeneratorsGTest, testMocnikGeneratorEqualsBasic) {
+	// for the same seed, both generators draw the same positions and have to create the same edges
+	for (count dim : {1, 2, 3}) {
+		const count n = 2000;
+		const double k = 2.6;
+
+		Aux::Random::setSeed(42, false);
+		MocnikGenerator mocnik(dim, n, k);
+		Graph G = mocnik.generate();
+
+		Aux::Random::setSeed(42, false);
+		MocnikGeneratorBasic basic(dim, n, k);
+		Graph expected = basic.generate();
+
+		ASSERT_EQ(expected.numberOfNodes(), G.numberOfNodes());
+		EXPECT_EQ(expected.numberOfEdges(), G.numberOfEdges());
+		expected.forEdges([&](node u, node v) {
+			EXPECT_TRUE(G.hasEdge(u, v));
+		});
+	}
+}
+
 } /* namespace NetworKit */
@@ -7,14 +7,84 @@
  */
 
 #include <cmath>
+#include <numeric>
 #include <random>
 #include <sstream>
 
 #include "Graph.h"
 #include "GraphBuilder.h"
+#include "../auxiliary/Parallel.h"
 
 namespace NetworKit {
 
+namespace {
+
+using HalfEdge = std::pair<node, index>;
+
+/**
+ * Returns the half edges (u, k) and (v, k) of the edges {u, v} = endpoints(k)
+ * for all k in @a selected, sorted by node and position in the batch. For
+ * directed graphs, the half edges (v, k) of the incoming edges are returned in
+ * @a inHalfEdges.
+ */
+template <typename F>
+void collectHalfEdges(bool directed, const std::vector<index> &selected,
+                      F endpoints, std::vector<HalfEdge> &outHalfEdges,
+                      std::vector<HalfEdge> &inHalfEdges) {
+	outHalfEdges.reserve(directed ? selected.size() : 2 * selected.size());
+	inHalfEdges.reserve(directed ? selected.size() : 0);
+	for (index k : selected) {
+		std::pair<node, node> e = endpoints(k);
+		outHalfEdges.emplace_back(e.first, k);
+		if (directed) {
+			inHalfEdges.emplace_back(e.second, k);
+		} else if (e.first != e.second) {
+			outHalfEdges.emplace_back(e.second, k);
+		}
+	}
+
+	Aux::Parallel::sort(outHalfEdges.begin(), outHalfEdges.end());
+	Aux::Parallel::sort(inHalfEdges.begin(), inHalfEdges.end());
+}
+
+/**
+ * Returns the first positions of the groups of half edges with the same node
+ * in the sorted @a halfEdges, followed by the number of half edges.
+ */
+std::vector<index> groupBegins(const std::vector<HalfEdge> &halfEdges) {
+	std::vector<index> begins;
+	for (index i = 0; i < halfEdges.size(); ++i) {
+		if (i == 0 || halfEdges[i].first != halfEdges[i - 1].first) {
+			begins.push_back(i);
+		}
+	}
+	begins.push_back(halfEdges.size());
+	return begins;
+}
+
+/**
+ * Returns the batch positions sorted by the edge {u, v} = endpoints(k) and
+ * the position k, i.e. equal edges are consecutive in batch order. Edges of
+ * undirected graphs are compared without orientation.
+ */
+template <typename F>
+std::vector<std::pair<std::pair<node, node>, index>>
+sortedEdgeKeys(bool directed, count size, F endpoints) {
+	std::vector<std::pair<std::pair<node, node>, index>> keys(size);
+#pragma omp parallel for
+	for (omp_index k = 0; k < static_cast<omp_index>(size); ++k) {
+		std::pair<node, node> e = endpoints(k);
+		if (!directed && e.first > e.second) {
+			std::swap(e.first, e.second);
+		}
+		keys[k] = std::make_pair(e, k);
+	}
+	Aux::Parallel::sort(keys.begin(), keys.end());
+	return keys;
+}
+
+} // namespace
+
 /** CONSTRUCTORS **/
 
 Graph::Graph(count n, bool weighted, bool directed)
@@ -23,6 +93,7 @@ Graph::Graph(count n, bool weighted, bool directed)
       weighted(weighted),  // indicates whether the graph is weighted or not
       directed(directed),  // indicates whether the graph is directed or not
       edgesIndexed(false), // edges are not indexed by default
+      edgeLookupIndexed(false), edgeLookupThreshold(0),
 
       exists(n, true),
 
@@ -72,7 +143,7 @@ Graph::Graph(const Graph &G, bool weighted, bool directed)
     : n(G.n), m(G.m), storedNumberOfSelfLoops(G.storedNumberOfSelfLoops),
       z(G.z), omega(0), t(G.t), weighted(weighted), directed(directed),
       edgesIndexed(false), // edges are not indexed by default
-      exists(G.exists),
+      edgeLookupIndexed(false), edgeLookupThreshold(0), exists(G.exists),
 
       // let the following be empty for the start, we fill them later
       inDeg(0), outDeg(0), inEdges(0), outEdges(0), inEdgeWeights(0),
@@ -194,6 +265,12 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 	if (!directed) {
 		return indexInOutEdgeArray(v, u);
 	}
+	if (edgeLookupIndexed) {
+		auto it = inEdgeLookup.find(v);
+		if (it != inEdgeLookup.end()) {
+			return findInEdgeLookup(it->second, u);
+		}
+	}
 	for (index i = 0; i < inEdges[v].size(); i++) {
 		node x = inEdges[v][i];
 		if (x == u) {
@@ -204,6 +281,12 @@ index Graph::indexInInEdgeArray(node v, node u) const {
 }
 
 index Graph::indexInOutEdgeArray(node u, node v) const {
+	if (edgeLookupIndexed) {
+		auto it = outEdgeLookup.find(u);
+		if (it != outEdgeLookup.end()) {
+			return findInEdgeLookup(it->second, v);
+		}
+	}
 	for (index i = 0; i < outEdges[u].size(); i++) {
 		node x = outEdges[u][i];
 		if (x == v) {
@@ -213,6 +296,97 @@ index Graph::indexInOutEdgeArray(node u, node v) const {
 	return none;
 }
 
+index Graph::findInEdgeLookup(const EdgeLookup &lookup, node v) {
+	// for multi-edges, the first position is the one a linear scan would find
+	index result = none;
+	auto range = lookup.equal_range(v);
+	for (auto it = range.first; it != range.second; ++it) {
+		result = std::min(result, it->second);
+	}
+	return result;
+}
+
+void Graph::edgeLookupAppended(std::unordered_map<node, EdgeLookup> &lookup,
+                               const std::vector<std::vector<node>> &adjacency,
+                               node u) {
+	const std::vector<node> &neighbors = adjacency[u];
+	auto it = lookup.find(u);
+	if (it != lookup.end()) {
+		it->second.emplace(neighbors.back(), neighbors.size() - 1);
+	} else if (neighbors.size() >= edgeLookupThreshold) {
+		EdgeLookup &entries = lookup[u];
+		entries.reserve(neighbors.size());
+		for (index i = 0; i < neighbors.size(); ++i) {
+			if (neighbors[i] != none) {
+				entries.emplace(neighbors[i], i);
+			}
+		}
+	}
+}
+
+void Graph::edgeLookupErase(std::unordered_map<node, EdgeLookup> &lookup,
+                            node u, node v, index i) {
+	auto it = lookup.find(u);
+	if (it == lookup.end()) {
+		return;
+	}
+	auto range = it->second.equal_range(v);
+	for (auto entry = range.first; entry != range.second; ++entry) {
+		if (entry->second == i) {
+			it->second.erase(entry);
+			return;
+		}
+	}
+}
+
+void Graph::rebuildEdgeLookup() {
+	outEdgeLookup.clear();
+	inEdgeLookup.clear();
+	if (!edgeLookupIndexed) {
+		return;
+	}
+
+	auto build = [&](const std::vector<std::vector<node>> &adjacency,
+	                 std::unordered_map<node, EdgeLookup> &lookup) {
+		std::vector<node> hubs;
+		forNodes([&](node u) {
+			if (adjacency[u].size() >= edgeLookupThreshold) {
+				hubs.push_back(u);
+				lookup[u];
+			}
+		});
+
+		// the hash maps of different nodes are independent
+#pragma omp parallel for schedule(dynamic)
+		for (omp_index k = 0; k < static_cast<omp_index>(hubs.size()); ++k) {
+			const std::vector<node> &neighbors = adjacency[hubs[k]];
+			EdgeLookup &entries = lookup.find(hubs[k])->second;
+			entries.reserve(neighbors.size());
+			for (index i = 0; i < neighbors.size(); ++i) {
+				if (neighbors[i] != none) {
+					entries.emplace(neighbors[i], i);
+				}
+			}
+		}
+	};
+
+	build(outEdges, outEdgeLookup);
+	if (directed) {
+		build(inEdges, inEdgeLookup);
+	}
+}
+
+void Graph::indexEdgeLookup(count degreeThreshold) {
+	edgeLookupIndexed = true;
+	edgeLookupThreshold = std::max(degreeThreshold, (count)1);
+	rebuildEdgeLookup();
+}
+
+void Graph::removeEdgeLookupIndex() {
+	edgeLookupIndexed = false;
+	rebuildEdgeLookup();
+}
+
 /** EDGE IDS **/
 
 void Graph::indexEdges(bool force) {
@@ -378,6 +552,10 @@ void Graph::compactEdges() {
 			}
 		}
 	});
+
+	if (edgeLookupIndexed) {
+		rebuildEdgeLookup();
+	}
 }
 
 void Graph::sortEdges() {
@@ -439,6 +617,10 @@ void Graph::sortEdges() {
 		inEdgeWeights.swap(targetWeight);
 		inEdgeIds.swap(targetEdgeIds);
 	}
+
+	if (edgeLookupIndexed) {
+		rebuildEdgeLookup();
+	}
 }
 
 count Graph::maxDegree() const { return computeMaxDegree(); }
@@ -657,7 +839,7 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 		inEdges[v].push_back(u);
 
 		if (edgesIndexed) {
-			inEdgeIds[v].push_back(id);
+			inEdgeIds[v].push_back(omega - 1);
 		}
 
 		if (weighted) {
@@ -687,6 +869,15 @@ void Graph::addEdge(node u, node v, edgeweight ew) {
 	if (u == v) { // count self loop
 		storedNumberOfSelfLoops++;
 	}
+
+	if (edgeLookupIndexed) {
+		edgeLookupAppended(outEdgeLookup, outEdges, u);
+		if (directed) {
+			edgeLookupAppended(inEdgeLookup, inEdges, v);
+		} else if (u != v) {
+			edgeLookupAppended(outEdgeLookup, outEdges, v);
+		}
+	}
 }
 
 void Graph::removeEdge(node u, node v) {
@@ -733,11 +924,299 @@ void Graph::removeEdge(node u, node v) {
 		assert(storedNumberOfSelfLoops >= 0);
 	}
 
+	if (edgeLookupIndexed) {
+		edgeLookupErase(outEdgeLookup, u, v, vi);
+		if (directed) {
+			edgeLookupErase(inEdgeLookup, v, u, ui);
+		} else if (u != v) {
+			edgeLookupErase(outEdgeLookup, v, u, ui);
+		}
+	}
+
 	// dose not make a lot of sense do remove attributes,
 	// cause the edge is marked as deleted and we have no null values for the
 	// attributes
 }
 
+void Graph::addEdges(const std::vector<WeightedEdge> &edges,
+                     bool removeDuplicates) {
+	auto endpoints = [&](index k) {
+		return std::make_pair(edges[k].u, edges[k].v);
+	};
+
+	std::vector<index> selected;
+	if (removeDuplicates) {
+		// keep the first occurrence of each edge that is not in the graph yet
+		auto keys = sortedEdgeKeys(directed, edges.size(), endpoints);
+		std::vector<char> keep(edges.size(), false);
+#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(keys.size()); ++i) {
+			if (i == 0 || keys[i].first != keys[i - 1].first) {
+				const WeightedEdge &e = edges[keys[i].second];
+				keep[keys[i].second] = !hasEdge(e.u, e.v);
+			}
+		}
+		for (index k = 0; k < edges.size(); ++k) {
+			if (keep[k]) {
+				selected.push_back(k);
+			}
+		}
+	} else {
+		selected.resize(edges.size());
+		std::iota(selected.begin(), selected.end(), 0);
+	}
+
+	std::vector<HalfEdge> outHalfEdges, inHalfEdges;
+	collectHalfEdges(directed, selected, endpoints, outHalfEdges, inHalfEdges);
+
+	// edge ids in batch order, as addEdge would assign them
+	std::vector<edgeid> ids;
+	if (edgesIndexed) {
+		ids.assign(edges.size(), none);
+		for (index i = 0; i < selected.size(); ++i) {
+			ids[selected[i]] = omega + i;
+		}
+		omega += selected.size();
+	}
+
+	appendHalfEdges(outHalfEdges, edges, ids, false);
+	if (directed) {
+		appendHalfEdges(inHalfEdges, edges, ids, true);
+	}
+
+	m += selected.size();
+	for (index k : selected) {
+		if (edges[k].u == edges[k].v) {
+			storedNumberOfSelfLoops++;
+		}
+	}
+}
+
+void Graph::appendHalfEdges(const std::vector<HalfEdge> &halfEdges,
+                            const std::vector<WeightedEdge> &edges,
+                            const std::vector<edgeid> &ids, bool in) {
+	std::vector<std::vector<node>> &adjacency = in ? inEdges : outEdges;
+	std::vector<std::vector<edgeweight>> &weights =
+	    in ? inEdgeWeights : outEdgeWeights;
+	std::vector<std::vector<edgeid>> &edgeIds = in ? inEdgeIds : outEdgeIds;
+	std::vector<count> &degrees = in ? inDeg : outDeg;
+	std::unordered_map<node, EdgeLookup> &lookup =
+	    in ? inEdgeLookup : outEdgeLookup;
+
+	const std::vector<index> begins = groupBegins(halfEdges);
+	std::vector<char> reachesThreshold(begins.size() - 1, false);
+#pragma omp parallel for schedule(guided)
+	for (omp_index g = 0; g < static_cast<omp_index>(begins.size() - 1); ++g) {
+		const node u = halfEdges[begins[g]].first;
+		const count added = begins[g + 1] - begins[g];
+		adjacency[u].reserve(adjacency[u].size() + added);
+
+		// only the hash index of u is changed, the map of indices is not
+		auto it = edgeLookupIndexed ? lookup.find(u) : lookup.end();
+		for (index i = begins[g]; i < begins[g + 1]; ++i) {
+			const WeightedEdge &e = edges[halfEdges[i].second];
+			node v = e.u == u ? e.v : e.u;
+			adjacency[u].push_back(v);
+			if (weighted) {
+				weights[u].push_back(e.weight);
+			}
+			if (edgesIndexed) {
+				edgeIds[u].push_back(ids[halfEdges[i].second]);
+			}
+			if (it != lookup.end()) {
+				it->second.emplace(v, adjacency[u].size() - 1);
+			}
+		}
+		degrees[u] += added;
+
+		reachesThreshold[g] = edgeLookupIndexed && it == lookup.end() &&
+		                      adjacency[u].size() >= edgeLookupThreshold;
+	}
+
+	// new indices change the map of indices and are built sequentially
+	for (index g = 0; g + 1 < begins.size(); ++g) {
+		if (reachesThreshold[g]) {
+			edgeLookupAppended(lookup, adjacency, halfEdges[begins[g]].first);
+		}
+	}
+}
+
+void Graph::removeEdges(const std::vector<std::pair<node, node>> &edges) {
+	auto endpoints = [&](index k) { return edges[k]; };
+
+	// check that every edge exists at least as often as it is removed
+	auto keys = sortedEdgeKeys(directed, edges.size(), endpoints);
+	std::vector<index> begins;
+	for (index i = 0; i < keys.size(); ++i) {
+		if (i == 0 || keys[i].first != keys[i - 1].first) {
+			begins.push_back(i);
+		}
+	}
+	begins.push_back(keys.size());
+
+	index missing = none;
+#pragma omp parallel for
+	for (omp_index g = 0; g < static_cast<omp_index>(begins.size() - 1); ++g) {
+		const std::pair<node, node> &e = edges[keys[begins[g]].second];
+		const count removals = begins[g + 1] - begins[g];
+		bool exists = hasEdge(e.first, e.second);
+		if (exists && removals > 1) {
+			exists = std::count(outEdges[e.first].begin(), outEdges[e.first].end(),
+			                    e.second) >= static_cast<std::ptrdiff_t>(removals);
+		}
+		if (!exists) {
+#pragma omp critical
+			missing = std::min(missing, keys[begins[g]].second);
+		}
+	}
+
+	if (missing != none) {
+		std::stringstream strm;
+		strm << "edge (" << edges[missing].first << "," << edges[missing].second
+		     << ") does not exist";
+		throw std::runtime_error(strm.str());
+	}
+
+	std::vector<index> selected(edges.size());
+	std::iota(selected.begin(), selected.end(), 0);
+	std::vector<HalfEdge> outHalfEdges, inHalfEdges;
+	collectHalfEdges(directed, selected, endpoints, outHalfEdges, inHalfEdges);
+
+	removeHalfEdges(outHalfEdges, edges, false);
+	if (directed) {
+		removeHalfEdges(inHalfEdges, edges, true);
+	}
+
+	m -= edges.size();
+	for (const std::pair<node, node> &e : edges) {
+		if (e.first == e.second) {
+			storedNumberOfSelfLoops--;
+		}
+	}
+}
+
+void Graph::removeHalfEdges(const std::vector<HalfEdge> &halfEdges,
+                            const std::vector<std::pair<node, node>> &edges,
+                            bool in) {
+	std::vector<std::vector<node>> &adjacency = in ? inEdges : outEdges;
+	std::vector<std::vector<edgeweight>> &weights =
+	    in ? inEdgeWeights : outEdgeWeights;
+	std::vector<count> &degrees = in ? inDeg : outDeg;
+	std::unordered_map<node, EdgeLookup> &lookup =
+	    in ? inEdgeLookup : outEdgeLookup;
+
+	const std::vector<index> begins = groupBegins(halfEdges);
+#pragma omp parallel for schedule(guided)
+	for (omp_index g = 0; g < static_cast<omp_index>(begins.size() - 1); ++g) {
+		const node u = halfEdges[begins[g]].first;
+		for (index i = begins[g]; i < begins[g + 1]; ++i) {
+			const std::pair<node, node> &e = edges[halfEdges[i].second];
+			node v = e.first == u ? e.second : e.first;
+			index vi = in ? indexInInEdgeArray(u, v) : indexInOutEdgeArray(u, v);
+			assert(vi != none);
+
+			adjacency[u][vi] = none;
+			if (weighted) {
+				weights[u][vi] = nullWeight;
+			}
+			if (edgeLookupIndexed) {
+				edgeLookupErase(lookup, u, v, vi);
+			}
+		}
+		degrees[u] -= begins[g + 1] - begins[g];
+	}
+}
+
+void Graph::setWeights(const std::vector<WeightedEdge> &edges) {
+	updateWeights(edges, false);
+}
+
+void Graph::increaseWeights(const std::vector<WeightedEdge> &edges) {
+	updateWeights(edges, true);
+}
+
+void Graph::updateWeights(const std::vector<WeightedEdge> &edges,
+                          bool increase) {
+	if (!weighted) {
+		throw std::runtime_error("Cannot set edge weight in unweighted graph.");
+	}
+
+	auto endpoints = [&](index k) {
+		return std::make_pair(edges[k].u, edges[k].v);
+	};
+
+	// The first update of a missing edge inserts it, the following ones change
+	// the weight of the inserted edge. They are merged into one insertion.
+	auto keys = sortedEdgeKeys(directed, edges.size(), endpoints);
+	std::vector<char> exists(edges.size(), true);
+	std::vector<index> insertedAt(edges.size(), none);
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(keys.size()); ++i) {
+		if (i > 0 && keys[i].first == keys[i - 1].first) {
+			continue;
+		}
+		const WeightedEdge &e = edges[keys[i].second];
+		if (hasEdge(e.u, e.v)) {
+			continue;
+		}
+		for (index j = i; j < keys.size() && keys[j].first == keys[i].first; ++j) {
+			exists[keys[j].second] = false;
+		}
+		insertedAt[keys[i].second] = i;
+	}
+
+	std::vector<WeightedEdge> insertions;
+	std::vector<index> selected;
+	for (index k = 0; k < edges.size(); ++k) {
+		if (exists[k]) {
+			selected.push_back(k);
+		} else if (insertedAt[k] != none) {
+			WeightedEdge e = edges[k];
+			for (index j = insertedAt[k] + 1;
+			     j < keys.size() && keys[j].first == keys[insertedAt[k]].first;
+			     ++j) {
+				const WeightedEdge &update = edges[keys[j].second];
+				e.weight = increase ? e.weight + update.weight : update.weight;
+			}
+			insertions.push_back(e);
+		}
+	}
+
+	std::vector<HalfEdge> outHalfEdges, inHalfEdges;
+	collectHalfEdges(directed, selected, endpoints, outHalfEdges, inHalfEdges);
+	updateHalfEdgeWeights(outHalfEdges, edges, false, increase);
+	if (directed) {
+		updateHalfEdgeWeights(inHalfEdges, edges, true, increase);
+	}
+
+	addEdges(insertions);
+}
+
+void Graph::updateHalfEdgeWeights(const std::vector<HalfEdge> &halfEdges,
+                                  const std::vector<WeightedEdge> &edges,
+                                  bool in, bool increase) {
+	std::vector<std::vector<edgeweight>> &weights =
+	    in ? inEdgeWeights : outEdgeWeights;
+
+	const std::vector<index> begins = groupBegins(halfEdges);
+#pragma omp parallel for schedule(guided)
+	for (omp_index g = 0; g < static_cast<omp_index>(begins.size() - 1); ++g) {
+		const node u = halfEdges[begins[g]].first;
+		for (index i = begins[g]; i < begins[g + 1]; ++i) {
+			const WeightedEdge &e = edges[halfEdges[i].second];
+			node v = e.u == u ? e.v : e.u;
+			index vi = in ? indexInInEdgeArray(u, v) : indexInOutEdgeArray(u, v);
+			assert(vi != none);
+
+			if (increase) {
+				weights[u][vi] += e.weight;
+			} else {
+				weights[u][vi] = e.weight;
+			}
+		}
+	}
+}
+
 void Graph::removeAllEdges() {
 #pragma omp parallel for
 	for (omp_index u = 0; u < z; ++u) {
@@ -756,6 +1235,9 @@ void Graph::removeAllEdges() {
 	}
 
 	m = 0;
+	if (edgeLookupIndexed) {
+		rebuildEdgeLookup();
+	}
 }
 
 void Graph::removeEdgesFromIsolatedSet(const std::vector<node> &nodesInSet) {
@@ -773,6 +1255,9 @@ void Graph::removeEdgesFromIsolatedSet(const std::vector<node> &nodesInSet) {
 		}
 	}
 	this->m -= removedEdges;
+	if (edgeLookupIndexed) {
+		rebuildEdgeLookup();
+	}
 }
 
 void Graph::removeSelfLoops() {
@@ -794,6 +1279,14 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 		throw std::runtime_error("The second edge does not exist");
 	index t2s2 = indexInInEdgeArray(t2, s2);
 
+	if (edgeLookupIndexed) {
+		edgeLookupErase(outEdgeLookup, s1, t1, s1t1);
+		edgeLookupErase(outEdgeLookup, s2, t2, s2t2);
+		auto &lookup = directed ? inEdgeLookup : outEdgeLookup;
+		edgeLookupErase(lookup, t1, s1, t1s1);
+		edgeLookupErase(lookup, t2, s2, t2s2);
+	}
+
 	std::swap(outEdges[s1][s1t1], outEdges[s2][s2t2]);
 
 	if (directed) {
@@ -817,6 +1310,22 @@ void Graph::swapEdge(node s1, node t1, node s2, node t2) {
 			std::swap(outEdgeIds[t1][t1s1], outEdgeIds[t2][t2s2]);
 		}
 	}
+
+	if (edgeLookupIndexed) {
+		// the swapped positions hold (s1, t2) and (s2, t1) now
+		auto reinsert = [](std::unordered_map<node, EdgeLookup> &lookup, node u,
+		                   node v, index i) {
+			auto it = lookup.find(u);
+			if (it != lookup.end()) {
+				it->second.emplace(v, i);
+			}
+		};
+		reinsert(outEdgeLookup, s1, t2, s1t1);
+		reinsert(outEdgeLookup, s2, t1, s2t2);
+		auto &lookup = directed ? inEdgeLookup : outEdgeLookup;
+		reinsert(lookup, t1, s2, t1s1);
+		reinsert(lookup, t2, s1, t2s2);
+	}
 }
 
 bool Graph::hasEdge(node u, node v) const {
@@ -14,6 +14,7 @@
 #include <queue>
 #include <stack>
 #include <stdexcept>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -104,6 +105,9 @@ private:
 	bool weighted;     //!< true if the graph is weighted, false otherwise
 	bool directed;     //!< true if the graph is directed, false otherwise
 	bool edgesIndexed; //!< true if edge ids have been assigned
+	bool edgeLookupIndexed; //!< true if large adjacency arrays have hash indices
+	count edgeLookupThreshold; //!< minimal size of an adjacency array with a
+	                           //!< hash index
 
 	// per node data
 	std::vector<bool> exists;       //!< exists[v] is true if node v has not been
@@ -133,6 +137,17 @@ private:
 	std::vector<std::vector<edgeid>>
 	    outEdgeIds; //!< same schema (and same order!) as outEdges
 
+	/**
+	 * Maps the neighbors of a node to their positions in its adjacency array.
+	 */
+	using EdgeLookup = std::unordered_multimap<node, index>;
+
+	std::unordered_map<node, EdgeLookup>
+	    inEdgeLookup; //!< only used for directed graphs, hash indices of the
+	                  //!< large arrays in inEdges
+	std::unordered_map<node, EdgeLookup>
+	    outEdgeLookup; //!< hash indices of the large arrays in outEdges
+
 	/**
 	 * Returns the next unique graph id.
 	 */
@@ -150,6 +165,62 @@ private:
 	 */
 	index indexInOutEdgeArray(node u, node v) const;
 
+	/**
+	 * Returns the smallest position of @a v in @a lookup or none.
+	 */
+	static index findInEdgeLookup(const EdgeLookup &lookup, node v);
+
+	/**
+	 * Updates the hash index of @a adjacency[u] after a neighbor has been
+	 * appended to it.
+	 */
+	void edgeLookupAppended(std::unordered_map<node, EdgeLookup> &lookup,
+	                        const std::vector<std::vector<node>> &adjacency,
+	                        node u);
+
+	/**
+	 * Removes the entry of @a v at position @a i from the hash index of node
+	 * @a u, if there is one.
+	 */
+	static void edgeLookupErase(std::unordered_map<node, EdgeLookup> &lookup,
+	                            node u, node v, index i);
+
+	/**
+	 * Rebuilds the hash indices from the adjacency arrays.
+	 */
+	void rebuildEdgeLookup();
+
+	/**
+	 * Appends the neighbors of the half edges (u, k), i.e. the other endpoint
+	 * of @a edges[k], to the adjacency arrays of the nodes u in parallel. The
+	 * half edges have to be sorted. @a in selects the incoming edges of a
+	 * directed graph.
+	 */
+	void appendHalfEdges(const std::vector<std::pair<node, index>> &halfEdges,
+	                     const std::vector<WeightedEdge> &edges,
+	                     const std::vector<edgeid> &ids, bool in);
+
+	/**
+	 * Removes the neighbors of the sorted half edges (u, k) from the adjacency
+	 * arrays of the nodes u in parallel.
+	 */
+	void removeHalfEdges(const std::vector<std::pair<node, index>> &halfEdges,
+	                     const std::vector<std::pair<node, node>> &edges,
+	                     bool in);
+
+	/**
+	 * Sets or increases the weights of the sorted half edges (u, k) to the
+	 * weights of @a edges[k] in parallel.
+	 */
+	void updateHalfEdgeWeights(
+	    const std::vector<std::pair<node, index>> &halfEdges,
+	    const std::vector<WeightedEdge> &edges, bool in, bool increase);
+
+	/**
+	 * Common part of setWeights and increaseWeights.
+	 */
+	void updateWeights(const std::vector<WeightedEdge> &edges, bool increase);
+
 	/**
 	 * Computes the weighted in/out degree of a graph.
 	 *
@@ -488,6 +559,28 @@ public:
 	 */
 	bool hasEdgeIds() const { return edgesIndexed; }
 
+	/**
+	 * Builds hash indices for the adjacency arrays with at least
+	 * @a degreeThreshold entries. The indices are maintained by all edge
+	 * modifiers, so that hasEdge, edgeId, weight, setWeight, increaseWeight and
+	 * removeEdge take expected constant time instead of time linear in the
+	 * degree for high-degree nodes. Arrays that grow beyond the threshold are
+	 * indexed when they reach it.
+	 *
+	 * @param degreeThreshold Minimal size of an adjacency array to be indexed.
+	 */
+	void indexEdgeLookup(count degreeThreshold = 64);
+
+	/**
+	 * Checks if the adjacency arrays of high-degree nodes have hash indices.
+	 */
+	bool hasEdgeLookupIndex() const { return edgeLookupIndexed; }
+
+	/**
+	 * Removes the hash indices built by indexEdgeLookup.
+	 */
+	void removeEdgeLookupIndex();
+
 	/**
 	 * Get the id of the given edge.
 	 */
@@ -756,6 +849,30 @@ public:
 	 */
 	void removeEdge(node u, node v);
 
+	/**
+	 * Inserts a batch of edges. The result, including the order of the
+	 * adjacency arrays and the edge ids, is the same as calling addEdge for
+	 * the edges in the given order. The batch is grouped by endpoint so that
+	 * the adjacency arrays of different nodes are appended to in parallel
+	 * without locking.
+	 *
+	 * @param edges The edges, their weights are ignored for unweighted graphs.
+	 * @param removeDuplicates If true, edges that already exist or occur
+	 * earlier in the batch are skipped.
+	 */
+	void addEdges(const std::vector<WeightedEdge> &edges,
+	              bool removeDuplicates = false);
+
+	/**
+	 * Removes a batch of edges in parallel, with the same result as calling
+	 * removeEdge for each of them. If one of the edges does not exist (as often
+	 * as it occurs in the batch), a std::runtime_error is thrown and the graph
+	 * remains unchanged.
+	 *
+	 * @param edges The edges.
+	 */
+	void removeEdges(const std::vector<std::pair<node, node>> &edges);
+
 	/**
 	 * Efficiently removes all the edges adjacent to a set of nodes that is not
 	 * connected to the rest of the graph. This is meant to optimize the Kadabra
@@ -1004,6 +1121,24 @@ public:
 	 */
 	void increaseWeight(node u, node v, edgeweight ew);
 
+	/**
+	 * Sets the weights of a batch of edges in parallel, with the same result as
+	 * calling setWeight for the edges in the given order. Edges that do not
+	 * exist are inserted.
+	 *
+	 * @param edges The edges with their new weights.
+	 */
+	void setWeights(const std::vector<WeightedEdge> &edges);
+
+	/**
+	 * Increases the weights of a batch of edges in parallel, with the same
+	 * result as calling increaseWeight for the edges in the given order. Edges
+	 * that do not exist are inserted.
+	 *
+	 * @param edges The edges with the weight increments.
+	 */
+	void increaseWeights(const std::vector<WeightedEdge> &edges);
+
 	/* SUMS */
 
 	/**
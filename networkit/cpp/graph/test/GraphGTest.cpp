@@ -15,6 +15,7 @@
 
 #include "../../auxiliary/NumericTools.h"
 #include "../../auxiliary/Parallel.h"
+#include "../../auxiliary/Random.h"
 #include "../../distance/DynBFS.h"
 #include "../../generators/ErdosRenyiGenerator.h"
 #include "../../io/METISGraphReader.h"
@@ -2257,4 +2258,195 @@ TEST_P(GraphGTest, testSortEdges) {
 	}
 }
 
+TEST_P(GraphGTest, testEdgeLookupIndex) {
+	Aux::Random::setSeed(42, false);
+	const count n = 200;
+	Graph G = createGraph(n);
+	G.indexEdges();
+	G.indexEdgeLookup(8);
+	EXPECT_TRUE(G.hasEdgeLookupIndex());
+	Graph R = G; // reference without lookup index
+	R.removeEdgeLookupIndex();
+
+	auto expectSameEdges = [&]() {
+		ASSERT_EQ(R.numberOfEdges(), G.numberOfEdges());
+		for (node u = 0; u < n; ++u) {
+			for (node v = 0; v < n; ++v) {
+				ASSERT_EQ(R.hasEdge(u, v), G.hasEdge(u, v));
+				if (R.hasEdge(u, v)) {
+					EXPECT_EQ(R.weight(u, v), G.weight(u, v));
+					EXPECT_EQ(R.edgeId(u, v), G.edgeId(u, v));
+				}
+			}
+		}
+	};
+
+	// the first nodes become hubs
+	auto randomNode = [&]() {
+		return Aux::Random::real() < 0.5 ? Aux::Random::integer(4) : Aux::Random::integer(n - 1);
+	};
+	for (count round = 0; round < 3; ++round) {
+		for (count k = 0; k < 2000; ++k) {
+			node u = randomNode();
+			node v = randomNode();
+			if (!R.hasEdge(u, v)) {
+				edgeweight w = Aux::Random::real();
+				R.addEdge(u, v, w);
+				G.addEdge(u, v, w);
+			}
+		}
+		expectSameEdges();
+
+		std::vector<std::pair<node, node>> edges = R.edges();
+		for (count k = 0; k < 500; ++k) {
+			std::pair<node, node> e = edges[Aux::Random::integer(edges.size() - 1)];
+			if (!R.hasEdge(e.first, e.second)) continue;
+			if (k % 2 == 0) {
+				R.removeEdge(e.first, e.second);
+				G.removeEdge(e.first, e.second);
+			} else if (isWeighted()) {
+				R.increaseWeight(e.first, e.second, 1.0);
+				G.increaseWeight(e.first, e.second, 1.0);
+			}
+		}
+		expectSameEdges();
+
+		for (count k = 0; k < 200; ++k) {
+			std::pair<node, node> e1 = edges[Aux::Random::integer(edges.size() - 1)];
+			std::pair<node, node> e2 = edges[Aux::Random::integer(edges.size() - 1)];
+			node s1 = e1.first, t1 = e1.second, s2 = e2.first, t2 = e2.second;
+			if (s1 == t1 || s2 == t2 || s1 == s2 || s1 == t2 || t1 == s2 || t1 == t2) continue;
+			if (!R.hasEdge(s1, t1) || !R.hasEdge(s2, t2) || R.hasEdge(s1, t2) || R.hasEdge(s2, t1)) continue;
+			R.swapEdge(s1, t1, s2, t2);
+			G.swapEdge(s1, t1, s2, t2);
+		}
+		expectSameEdges();
+
+		if (round == 0) {
+			R.compactEdges();
+			G.compactEdges();
+		} else if (round == 1) {
+			R.sortEdges();
+			G.sortEdges();
+		}
+		expectSameEdges();
+	}
+
+	// multi-edges are found until their last copy is removed
+	G.addEdge(0, 1);
+	G.addEdge(0, 1);
+	G.removeEdge(0, 1);
+	EXPECT_TRUE(G.hasEdge(0, 1));
+	G.removeEdge(0, 1);
+	EXPECT_EQ(R.hasEdge(0, 1), G.hasEdge(0, 1));
+
+	G.removeAllEdges();
+	EXPECT_FALSE(G.hasEdge(0, 1));
+}
+
+TEST_P(GraphGTest, testBatchMutations) {
+	Aux::Random::setSeed(42, false);
+	const count n = 100;
+	Graph G = createGraph(n);
+	G.indexEdges();
+	G.indexEdgeLookup(16);
+	Graph R = G; // reference with sequential updates
+
+	auto expectSameAdjacency = [&]() {
+		ASSERT_EQ(R.numberOfEdges(), G.numberOfEdges());
+		EXPECT_EQ(R.numberOfSelfLoops(), G.numberOfSelfLoops());
+		EXPECT_EQ(R.upperEdgeIdBound(), G.upperEdgeIdBound());
+		for (node u = 0; u < n; ++u) {
+			ASSERT_EQ(R.degree(u), G.degree(u));
+			ASSERT_EQ(R.degreeIn(u), G.degreeIn(u));
+			std::vector<std::tuple<node, edgeweight, edgeid>> expected, actual;
+			R.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) { expected.emplace_back(v, w, id); });
+			G.forEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) { actual.emplace_back(v, w, id); });
+			EXPECT_EQ(expected, actual);
+			expected.clear();
+			actual.clear();
+			R.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) { expected.emplace_back(v, w, id); });
+			G.forInEdgesOf(u, [&](node, node v, edgeweight w, edgeid id) { actual.emplace_back(v, w, id); });
+			EXPECT_EQ(expected, actual);
+		}
+	};
+
+	auto randomNode = [&]() {
+		return Aux::Random::real() < 0.3 ? Aux::Random::integer(2) : Aux::Random::integer(n - 1);
+	};
+	for (count round = 0; round < 3; ++round) {
+		// insertions, including multi-edges and self-loops
+		std::vector<WeightedEdge> insertions;
+		for (count k = 0; k < 1000; ++k) {
+			insertions.emplace_back(randomNode(), randomNode(), Aux::Random::real());
+		}
+		G.addEdges(insertions);
+		for (const WeightedEdge &e : insertions) {
+			R.addEdge(e.u, e.v, e.weight);
+		}
+		expectSameAdjacency();
+
+		// removals, multi-edges can be removed more than once
+		std::vector<std::pair<node, node>> edges = R.edges();
+		std::vector<std::pair<node, node>> removals;
+		Graph removed = R;
+		for (count k = 0; k < 300; ++k) {
+			std::pair<node, node> e = edges[Aux::Random::integer(edges.size() - 1)];
+			if (removed.hasEdge(e.first, e.second)) {
+				removed.removeEdge(e.first, e.second);
+				removals.push_back(e);
+			}
+		}
+
+		// a batch with a missing edge fails without changes
+		std::vector<std::pair<node, node>> invalid = removals;
+		node u = 0, v = 0;
+		while (removed.hasEdge(u, v)) {
+			u = randomNode();
+			v = randomNode();
+		}
+		invalid.emplace_back(u, v);
+		EXPECT_THROW(G.removeEdges(invalid), std::runtime_error);
+		expectSameAdjacency();
+
+		G.removeEdges(removals);
+		R = removed;
+		expectSameAdjacency();
+
+		// weight updates of existing and new edges
+		if (isWeighted()) {
+			std::vector<WeightedEdge> updates;
+			for (count k = 0; k < 500; ++k) {
+				updates.emplace_back(randomNode(), randomNode(), Aux::Random::real());
+			}
+			G.setWeights(updates);
+			for (const WeightedEdge &e : updates) {
+				R.setWeight(e.u, e.v, e.weight);
+			}
+			expectSameAdjacency();
+
+			G.increaseWeights(updates);
+			for (const WeightedEdge &e : updates) {
+				R.increaseWeight(e.u, e.v, e.weight);
+			}
+			expectSameAdjacency();
+		} else {
+			EXPECT_THROW(G.setWeights(insertions), std::runtime_error);
+		}
+	}
+
+	// deduplicated insertions skip existing edges and repetitions in the batch
+	std::vector<WeightedEdge> insertions;
+	for (count k = 0; k < 1000; ++k) {
+		insertions.emplace_back(randomNode(), randomNode(), 1.0);
+	}
+	G.addEdges(insertions, true);
+	for (const WeightedEdge &e : insertions) {
+		if (!R.hasEdge(e.u, e.v)) {
+			R.addEdge(e.u, e.v, e.weight);
+		}
+	}
+	expectSameAdjacency();
+}
+
 } /* namespace NetworKit */
@@ -51,4 +51,27 @@ void EdgeListWriter::write(const Graph& G, std::string path) {
 
 }
 
+void EdgeListWriter::write(EdgeStreamGenerator& generator, std::string path) {
+	std::ofstream file(path);
+	Aux::enforceOpened(file);
+
+	const bool weighted = generator.isWeighted();
+	auto writeEdge = [&](node u, node v, edgeweight weight) {
+		file << (u + firstNode) << separator << (v + firstNode);
+		if (weighted)
+			file << separator << weight;
+		file << '\n';
+	};
+
+	generator.forEdgeBatches([&](const EdgeStreamGenerator::EdgeBatch& batch) {
+		for (const WeightedEdge& e : batch) {
+			writeEdge(e.u, e.v, e.weight);
+			if (bothDirections && e.u != e.v)
+				writeEdge(e.v, e.u, e.weight);
+		}
+	});
+
+	file.close();
+}
+
 } /* namespace NetworKit */
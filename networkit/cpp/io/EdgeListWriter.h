@@ -13,6 +13,7 @@
 #include <string>
 
 #include "GraphReader.h"
+#include "../generators/EdgeStreamGenerator.h"
 
 namespace NetworKit {
 
@@ -43,6 +44,14 @@ public:
 	 */
 	void write(const Graph& G, std::string path);
 
+	/**
+	 * Write the edges emitted by @a generator to a file without building a graph.
+	 * Weights are written if the generator is weighted. bothDirections is honored.
+	 * @param[in]	generator	the edge stream
+	 * @param[in]	path	the output file path
+	 */
+	void write(EdgeStreamGenerator& generator, std::string path);
+
 protected:
 
 	char separator; 	//!< character separating nodes in an edge line
@@ -0,0 +1,152 @@
+/*
+ * GraphEventLogReader.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "GraphEventLogReader.h"
+
+#include <cstring>
+#include <omp.h>
+
+#include "../dynamics/GraphUpdater.h"
+
+namespace NetworKit {
+
+namespace {
+
+const char magic[] = "NKEVLOG1";
+const size_t blockHeaderSize = 2 * sizeof(uint64_t);
+
+uint64_t readUInt64(const char* it) {
+	uint64_t x = 0;
+	for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+		x |= static_cast<uint64_t>(static_cast<uint8_t>(it[i])) << (8 * i);
+	}
+	return x;
+}
+
+bool readVarint(const char*& it, const char* end, uint64_t& x) {
+	x = 0;
+	for (unsigned shift = 0; it != end && shift < 64; shift += 7) {
+		const uint8_t byte = static_cast<uint8_t>(*it++);
+		x |= static_cast<uint64_t>(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) return true;
+	}
+	return false;
+}
+
+} // namespace
+
+GraphEventLogReader::GraphEventLogReader(const std::string& path, count blocksPerBatch) : file(path), totalEvents(0), blocksPerBatch(blocksPerBatch > 0 ? blocksPerBatch : omp_get_max_threads()), nextBlock(0) {
+	const size_t size = file.size();
+	const char* data = file.cbegin();
+	if (size < 8 || std::memcmp(data, magic, 8) != 0) {
+		throw std::runtime_error("File is not an event log: " + path);
+	}
+
+	// only the headers are read, the payload is decoded on demand
+	index offset = 8;
+	while (offset < size) {
+		if (size - offset < blockHeaderSize) {
+			throw std::runtime_error("Event log is truncated: " + path);
+		}
+		Block b;
+		b.numEvents = readUInt64(data + offset);
+		b.numBytes = readUInt64(data + offset + sizeof(uint64_t));
+		b.begin = offset + blockHeaderSize;
+		if (b.numBytes > size - b.begin) {
+			throw std::runtime_error("Event log is truncated: " + path);
+		}
+		if (b.numEvents > b.numBytes) {
+			// every event takes at least one byte, so the count is corrupt
+			throw std::runtime_error("Event log is corrupt: " + path);
+		}
+		blocks.push_back(b);
+		totalEvents += b.numEvents;
+		offset = b.begin + b.numBytes;
+	}
+}
+
+std::vector<GraphEvent> GraphEventLogReader::next() {
+	const index first = nextBlock;
+	const index last = std::min(first + blocksPerBatch, static_cast<index>(blocks.size()));
+
+	std::vector<index> eventOffset(last - first + 1, 0);
+	for (index b = first; b < last; ++b) {
+		eventOffset[b - first + 1] = eventOffset[b - first] + blocks[b].numEvents;
+	}
+
+	std::vector<GraphEvent> events(eventOffset.back());
+	bool corrupt = false;
+#pragma omp parallel for schedule(dynamic, 1) reduction(||:corrupt)
+	for (omp_index b = static_cast<omp_index>(first); b < static_cast<omp_index>(last); ++b) {
+		if (!decodeBlock(blocks[b], events.data() + eventOffset[b - first])) {
+			corrupt = true;
+		}
+	}
+	if (corrupt) {
+		throw std::runtime_error("Event log is corrupt");
+	}
+
+	nextBlock = last;
+	return events;
+}
+
+std::vector<GraphEvent> GraphEventLogReader::getStream() {
+	const count blocksBefore = blocksPerBatch;
+	blocksPerBatch = blocks.size();
+	std::vector<GraphEvent> stream = next();
+	blocksPerBatch = blocksBefore;
+	return stream;
+}
+
+void GraphEventLogReader::replay(Graph& G) {
+	GraphUpdater updater(G);
+	while (hasNext()) {
+		updater.update(next());
+	}
+}
+
+bool GraphEventLogReader::decodeBlock(const Block& b, GraphEvent* events) const {
+	const char* it = file.cbegin() + b.begin;
+	const char* end = it + b.numBytes;
+	for (index i = 0; i < b.numEvents; ++i) {
+		if (it == end) return false;
+		const uint8_t tag = static_cast<uint8_t>(*it++);
+		const GraphEvent::Type type = static_cast<GraphEvent::Type>(tag & 0x7);
+		uint64_t u = none, diff = 0;
+		edgeweight w = 1.0;
+		switch (type) {
+			case GraphEvent::NODE_ADDITION :
+			case GraphEvent::NODE_REMOVAL :
+			case GraphEvent::NODE_RESTORATION : {
+				if (!readVarint(it, end, u)) return false;
+				events[i] = GraphEvent(type, u);
+				break;
+			}
+			case GraphEvent::EDGE_ADDITION :
+			case GraphEvent::EDGE_REMOVAL :
+			case GraphEvent::EDGE_WEIGHT_UPDATE :
+			case GraphEvent::EDGE_WEIGHT_INCREMENT : {
+				if (!readVarint(it, end, u) || !readVarint(it, end, diff)) return false;
+				if (tag & 0x8) {
+					if (end - it < static_cast<std::ptrdiff_t>(sizeof(double))) return false;
+					const uint64_t bits = readUInt64(it);
+					std::memcpy(&w, &bits, sizeof(double));
+					it += sizeof(double);
+				}
+				const int64_t delta = static_cast<int64_t>(diff >> 1) ^ -static_cast<int64_t>(diff & 1);
+				events[i] = GraphEvent(type, u, u + static_cast<uint64_t>(delta), w);
+				break;
+			}
+			default: { // TIME_STEP, the only remaining value of three bits
+				events[i] = GraphEvent(GraphEvent::TIME_STEP);
+			}
+		}
+	}
+
+	return it == end;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,99 @@
+/*
+ * GraphEventLogReader.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef GRAPHEVENTLOGREADER_H_
+#define GRAPHEVENTLOGREADER_H_
+
+#include <string>
+#include <vector>
+
+#include "MemoryMappedFile.h"
+#include "../dynamics/GraphEvent.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Reads binary event logs written by the GraphEventLogWriter. The file is mapped into memory and the events are
+ * decoded lazily in batches of blocks, the blocks of a batch in parallel. Thus, logs larger than the main memory
+ * can be replayed.
+ */
+class GraphEventLogReader {
+public:
+	/**
+	 * Maps the event log @a path into memory and reads the block headers.
+	 * @param path
+	 * @param blocksPerBatch Number of blocks decoded per batch; 0 chooses the number of threads.
+	 */
+	GraphEventLogReader(const std::string& path, count blocksPerBatch = 0);
+
+	/**
+	 * @return Number of events in the log.
+	 */
+	count numberOfEvents() const {
+		return totalEvents;
+	}
+
+	/**
+	 * @return Number of blocks in the log.
+	 */
+	count numberOfBlocks() const {
+		return blocks.size();
+	}
+
+	/**
+	 * @return True if not all batches have been read.
+	 */
+	bool hasNext() const {
+		return nextBlock < blocks.size();
+	}
+
+	/**
+	 * Decodes the next batch of events.
+	 * @return The events of the next blocks in the order of the log.
+	 */
+	std::vector<GraphEvent> next();
+
+	/**
+	 * Restarts reading at the first batch.
+	 */
+	void reset() {
+		nextBlock = 0;
+	}
+
+	/**
+	 * Decodes all remaining events.
+	 */
+	std::vector<GraphEvent> getStream();
+
+	/**
+	 * Applies all remaining events to @a G batch by batch with a GraphUpdater, i.e. consecutive edge events of the
+	 * same type are applied with the parallel batch updates of Graph.
+	 */
+	void replay(Graph& G);
+
+private:
+	struct Block {
+		index begin; //!< offset of the payload in the file
+		count numEvents;
+		count numBytes;
+	};
+
+	MemoryMappedFile file;
+	std::vector<Block> blocks;
+	count totalEvents;
+	count blocksPerBatch;
+	index nextBlock;
+
+	/**
+	 * Decodes block @a b into @a events and returns false if the block is corrupt.
+	 */
+	bool decodeBlock(const Block& b, GraphEvent* events) const;
+};
+
+} /* namespace NetworKit */
+
+#endif /* GRAPHEVENTLOGREADER_H_ */
@@ -0,0 +1,130 @@
+/*
+ * GraphEventLogWriter.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include "GraphEventLogWriter.h"
+
+#include <cstring>
+
+#include "../auxiliary/Log.h"
+
+namespace NetworKit {
+
+namespace {
+
+void writeVarint(std::vector<uint8_t>& buffer, uint64_t x) {
+	while (x >= 0x80) {
+		buffer.push_back(static_cast<uint8_t>(x | 0x80));
+		x >>= 7;
+	}
+	buffer.push_back(static_cast<uint8_t>(x));
+}
+
+void writeUInt64(std::ofstream& out, uint64_t x) {
+	// little endian, independent of the host
+	for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+		out.put(static_cast<char>(x & 0xFF));
+		x >>= 8;
+	}
+}
+
+} // namespace
+
+GraphEventLogWriter::GraphEventLogWriter(const std::string& path, count eventsPerBlock) : out(path, std::ios::trunc | std::ios::binary), eventsPerBlock(eventsPerBlock), bufferedEvents(0) {
+	if (!out) {
+		throw std::runtime_error("Event log file could not be opened: " + path);
+	}
+	if (eventsPerBlock == 0) {
+		throw std::runtime_error("Event log blocks must contain at least one event");
+	}
+	out.write("NKEVLOG1", 8);
+}
+
+GraphEventLogWriter::~GraphEventLogWriter() {
+	if (out.is_open()) {
+		try {
+			close();
+		} catch (const std::exception& e) {
+			ERROR("event log could not be written: ", e.what());
+		}
+	}
+}
+
+void GraphEventLogWriter::write(const GraphEvent& event) {
+	if (!out.is_open()) {
+		throw std::runtime_error("Event log is already closed");
+	}
+
+	const bool weighted = event.w != 1.0 && (event.type == GraphEvent::EDGE_ADDITION || event.type == GraphEvent::EDGE_WEIGHT_UPDATE || event.type == GraphEvent::EDGE_WEIGHT_INCREMENT);
+	buffer.push_back(static_cast<uint8_t>(event.type | (weighted ? 0x8 : 0x0)));
+	switch (event.type) {
+		case GraphEvent::NODE_ADDITION :
+		case GraphEvent::NODE_REMOVAL :
+		case GraphEvent::NODE_RESTORATION : {
+			writeVarint(buffer, event.u);
+			break;
+		}
+		case GraphEvent::EDGE_ADDITION :
+		case GraphEvent::EDGE_REMOVAL :
+		case GraphEvent::EDGE_WEIGHT_UPDATE :
+		case GraphEvent::EDGE_WEIGHT_INCREMENT : {
+			// the endpoints of an edge are often close, the difference is stored zigzag-encoded
+			const int64_t diff = static_cast<int64_t>(event.v - event.u);
+			writeVarint(buffer, event.u);
+			writeVarint(buffer, (static_cast<uint64_t>(diff) << 1) ^ static_cast<uint64_t>(diff >> 63));
+			if (weighted) {
+				uint64_t bits;
+				std::memcpy(&bits, &event.w, sizeof(double));
+				for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+					buffer.push_back(static_cast<uint8_t>(bits >> (8 * i)));
+				}
+			}
+			break;
+		}
+		case GraphEvent::TIME_STEP : {
+			break;
+		}
+		default: {
+			throw std::runtime_error("unknown event type");
+		}
+	}
+
+	if (++bufferedEvents == eventsPerBlock) {
+		flushBlock();
+	}
+}
+
+void GraphEventLogWriter::write(const std::vector<GraphEvent>& stream) {
+	for (const GraphEvent& event : stream) {
+		write(event);
+	}
+}
+
+void GraphEventLogWriter::close() {
+	flushBlock();
+	out.close();
+}
+
+void GraphEventLogWriter::write(const std::vector<GraphEvent>& stream, const std::string& path) {
+	GraphEventLogWriter writer(path);
+	writer.write(stream);
+	writer.close();
+}
+
+void GraphEventLogWriter::flushBlock() {
+	if (bufferedEvents == 0) return;
+
+	writeUInt64(out, bufferedEvents);
+	writeUInt64(out, buffer.size());
+	out.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+	if (!out) {
+		throw std::runtime_error("Event log could not be written");
+	}
+
+	buffer.clear();
+	bufferedEvents = 0;
+}
+
+} /* namespace NetworKit */
@@ -0,0 +1,75 @@
+/*
+ * GraphEventLogWriter.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef GRAPHEVENTLOGWRITER_H_
+#define GRAPHEVENTLOGWRITER_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../dynamics/GraphEvent.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup io
+ * Writes a stream of GraphEvents in a compact binary event log that the GraphEventLogReader maps into memory.
+ *
+ * The log starts with the 8 byte magic "NKEVLOG1" and consists of blocks. Each block has a header of two 64 bit
+ * little endian integers, the number of events and the number of payload bytes, followed by the events. An event
+ * is a tag byte with the event type in the lower three bits and a flag for a weight different from 1.0, followed by
+ * the varint-encoded node @a u, for edge events the zigzag varint of v - u and, if flagged, the weight as little
+ * endian 8 byte double. A time step takes a single byte. Since each block can be decoded on its own, the reader
+ * decodes blocks in parallel.
+ *
+ * Only the parameters that the event type uses are stored, i.e. @a v and @a w of node events and @a w of edge
+ * removals are not preserved.
+ */
+class GraphEventLogWriter {
+public:
+	/**
+	 * Creates the log file @a path, an existing file is overwritten.
+	 * @param path
+	 * @param eventsPerBlock Number of events in a block, the unit of parallel decoding (default = 65536).
+	 */
+	GraphEventLogWriter(const std::string& path, count eventsPerBlock = 1 << 16);
+
+	/** Writes the buffered events and closes the file. */
+	~GraphEventLogWriter();
+
+	/**
+	 * Appends @a event to the log.
+	 */
+	void write(const GraphEvent& event);
+
+	/**
+	 * Appends all events of @a stream to the log.
+	 */
+	void write(const std::vector<GraphEvent>& stream);
+
+	/**
+	 * Writes the buffered events and closes the file. Further events cannot be written.
+	 */
+	void close();
+
+	/**
+	 * Writes @a stream as event log to @a path.
+	 */
+	static void write(const std::vector<GraphEvent>& stream, const std::string& path);
+
+private:
+	std::ofstream out;
+	count eventsPerBlock;
+	count bufferedEvents;
+	std::vector<uint8_t> buffer;
+
+	void flushBlock();
+};
+
+} /* namespace NetworKit */
+
+#endif /* GRAPHEVENTLOGWRITER_H_ */
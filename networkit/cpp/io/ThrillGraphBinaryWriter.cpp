@@ -1,5 +1,32 @@
 #include "ThrillGraphBinaryWriter.h"
 
+namespace {
+
+void writeNeighbors(std::ofstream &out_stream, const std::vector<uint32_t> &neighbors) {
+	size_t deg = neighbors.size();
+
+	// Write variable length int for the degree
+	if(!deg) {
+		out_stream << uint8_t(0);
+	}
+
+	while(deg) {
+		size_t u = deg & 0x7F;
+		deg >>= 7;
+		out_stream << uint8_t(u | (deg ? 0x80 : 0));
+	}
+
+	for (uint32_t v : neighbors) {
+		// write neighbor as little endian
+		for (size_t i = 0; i < sizeof(uint32_t); ++i) {
+			out_stream << uint8_t(v);
+			v >>= 8;
+		}
+	}
+}
+
+} // namespace
+
 void NetworKit::ThrillGraphBinaryWriter::write( const NetworKit::Graph &G, const std::string &path ) {
 	if (G.upperNodeIdBound() > std::numeric_limits<uint32_t>::max()) {
 		throw std::runtime_error("Thrill binary graphs only support graphs with up to 2^32-1 nodes.");
@@ -20,26 +47,39 @@ void NetworKit::ThrillGraphBinaryWriter::write( const NetworKit::Graph &G, const
 					});
 		}
 
-		size_t deg = neighbors.size();
+		writeNeighbors(out_stream, neighbors);
+	}
 
-		// Write variable length int for the degree
-		if(!deg) {
-			out_stream << uint8_t(0);
-		}
+	out_stream.close();
+}
 
-		while(deg) {
-			size_t u = deg & 0x7F;
-			deg >>= 7;
-			out_stream << uint8_t(u | (deg ? 0x80 : 0));
-		}
+void NetworKit::ThrillGraphBinaryWriter::write( NetworKit::EdgeStreamGenerator &generator, const std::string &path ) {
+	if (generator.numberOfNodes() > std::numeric_limits<uint32_t>::max()) {
+		throw std::runtime_error("Thrill binary graphs only support graphs with up to 2^32-1 nodes.");
+	}
+	if (!generator.emitsSortedEdges()) {
+		throw std::runtime_error("Thrill binary graphs can only be written from sorted edge streams.");
+	}
 
-		for (uint32_t v : neighbors) {
-			// write neighbor as little endian
-			for (size_t i = 0; i < sizeof(uint32_t); ++i) {
-				out_stream << uint8_t(v);
-				v >>= 8;
+	std::ofstream out_stream(path, std::ios::trunc | std::ios::binary);
+
+	std::vector<uint32_t> neighbors;
+	node u = 0;
+
+	generator.forEdgeBatches([&](const EdgeStreamGenerator::EdgeBatch &batch) {
+		for (const WeightedEdge &e : batch) {
+			// rows may span several batches; nodes without edges are written with degree 0
+			for (; u < e.u; ++u) {
+				writeNeighbors(out_stream, neighbors);
+				neighbors.clear();
 			}
+			neighbors.push_back(e.v);
 		}
+	});
+
+	for (; u < generator.numberOfNodes(); ++u) {
+		writeNeighbors(out_stream, neighbors);
+		neighbors.clear();
 	}
 
 	out_stream.close();
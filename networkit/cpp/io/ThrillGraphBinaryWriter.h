@@ -8,6 +8,7 @@
 #define THRILLGRAPHBINARYWRITER_H_
 
 #include "GraphWriter.h"
+#include "../generators/EdgeStreamGenerator.h"
 
 namespace NetworKit {
 
@@ -20,6 +21,15 @@ public:
 	 * @param[in] path The path where to write the graph.
 	 */
 	virtual void write(const Graph& G, const std::string& path);
+
+	/**
+	 * Write the edges emitted by @a generator into a binary file at the given path
+	 * without building a graph. The generator has to emit sorted edges.
+	 *
+	 * @param[in] generator The edge stream to write.
+	 * @param[in] path The path where to write the graph.
+	 */
+	virtual void write(EdgeStreamGenerator& generator, const std::string& path);
 };
 
 } /* namespace NetworKit */
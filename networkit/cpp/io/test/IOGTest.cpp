@@ -38,7 +38,11 @@
 #include "../BinaryPartitionReader.h"
 #include "../BinaryEdgeListPartitionWriter.h"
 #include "../BinaryEdgeListPartitionReader.h"
+#include "../GraphEventLogWriter.h"
+#include "../GraphEventLogReader.h"
+#include "../../generators/ChungLuGenerator.h"
 #include "../../generators/ErdosRenyiGenerator.h"
+#include "../../generators/RmatGenerator.h"
 
 #include "../../community/GraphClusteringTools.h"
 #include "../../auxiliary/Log.h"
@@ -75,6 +79,28 @@ TEST_F(IOGTest, testEdgeListWriter){
 	EXPECT_EQ(G.isWeighted(),G2.isWeighted());
 }
 
+TEST_F(IOGTest, testEdgeListWriterFromEdgeStream) {
+	std::vector<count> sequence(500);
+	for (index i = 0; i < sequence.size(); ++i)
+		sequence[i] = 1 + i % 20;
+	ChungLuGenerator generator(sequence);
+
+	std::string path = "output/edgelist-stream.txt";
+	EdgeListWriter writer(' ', 0, false);
+	Aux::Random::setSeed(42, false);
+	writer.write(generator, path);
+
+	Aux::Random::setSeed(42, false);
+	Graph G = generator.generate();
+
+	EdgeListReader reader(' ', 0, "#", true, false);
+	Graph H = reader.read(path);
+	EXPECT_EQ(G.numberOfEdges(), H.numberOfEdges());
+	G.forEdges([&](node u, node v) {
+		EXPECT_TRUE(H.hasEdge(u, v));
+	});
+}
+
 TEST_F(IOGTest, testGraphIOEdgeList) {
 	ErdosRenyiGenerator graphGen(100, 0.1);
 	Graph G = graphGen.generate();
@@ -726,6 +752,29 @@ TEST_F(IOGTest, testThrillGraphBinaryWriterAndReader) {
 	EXPECT_EQ(diff.getEdits().size(), 0);
 }
 
+TEST_F(IOGTest, testThrillGraphBinaryWriterFromEdgeStream) {
+	RmatGenerator rmat(9, 4, 0.57, 0.19, 0.19, 0.05);
+	std::string path = "output/rmat.thrillbin";
+
+	Aux::Random::setSeed(42, false);
+	ThrillGraphBinaryWriter writer;
+	writer.write(rmat, path);
+
+	ThrillGraphBinaryReader reader;
+	Graph H = reader.read(path);
+	EXPECT_EQ(rmat.numberOfNodes(), H.numberOfNodes());
+
+	count numEdges = 0;
+	Aux::Random::setSeed(42, false);
+	rmat.forEdgeBatches([&](const EdgeStreamGenerator::EdgeBatch& batch) {
+		for (const WeightedEdge& e : batch) {
+			EXPECT_TRUE(H.hasEdge(e.u, e.v));
+			++numEdges;
+		}
+	});
+	EXPECT_EQ(numEdges, H.numberOfEdges());
+}
+
 TEST_F(IOGTest, testBinaryPartitionWriterAndReader) {
 	Partition P(5);
 	P.setUpperBound((1ull<<32));
@@ -776,6 +825,82 @@ TEST_F(IOGTest, testBinaryEdgeListPartitionWriterAndReader) {
 	EXPECT_EQ(Q.upperBound(), P[4]+1);
 }
 
+TEST_F(IOGTest, testGraphEventLogWriterAndReader) {
+	Aux::Random::setSeed(42, false);
+	const count n = 1000;
+	std::vector<GraphEvent> stream;
+	for (node u = 0; u < n; ++u) {
+		stream.emplace_back(GraphEvent::NODE_ADDITION, u);
+	}
+	Graph H(n, true, false);
+	for (count step = 0; step < 50; ++step) {
+		for (count k = 0; k < 200; ++k) {
+			node u = Aux::Random::integer(n - 1);
+			node v = Aux::Random::integer(n - 1);
+			if (!H.hasEdge(u, v)) {
+				edgeweight w = k % 2 ? Aux::Random::real() : 1.0;
+				stream.emplace_back(GraphEvent::EDGE_ADDITION, u, v, w);
+				H.addEdge(u, v, w);
+			}
+		}
+		for (count k = 0; k < 20; ++k) {
+			std::pair<node, node> e = H.randomEdge();
+			stream.emplace_back(GraphEvent::EDGE_REMOVAL, e.first, e.second);
+			H.removeEdge(e.first, e.second);
+		}
+		for (count k = 0; k < 20; ++k) {
+			std::pair<node, node> e = H.randomEdge();
+			stream.emplace_back(GraphEvent::EDGE_WEIGHT_INCREMENT, e.first, e.second, 0.5);
+			H.increaseWeight(e.first, e.second, 0.5);
+		}
+		stream.emplace_back(GraphEvent::TIME_STEP);
+	}
+
+	std::string path = "output/events.evlog";
+	{
+		GraphEventLogWriter writer(path, 1000);
+		writer.write(stream);
+	}
+
+	// batches of two blocks
+	GraphEventLogReader reader(path, 2);
+	EXPECT_EQ(stream.size(), reader.numberOfEvents());
+	EXPECT_EQ((stream.size() + 999) / 1000, reader.numberOfBlocks());
+	std::vector<GraphEvent> read;
+	while (reader.hasNext()) {
+		std::vector<GraphEvent> batch = reader.next();
+		EXPECT_LE(batch.size(), 2000u);
+		read.insert(read.end(), batch.begin(), batch.end());
+	}
+	ASSERT_EQ(stream.size(), read.size());
+	for (index i = 0; i < stream.size(); ++i) {
+		EXPECT_TRUE(GraphEvent::equal(stream[i], read[i])) << stream[i].toString() << " != " << read[i].toString();
+	}
+
+	// replay into an empty graph gives the same graph as the stream
+	reader.reset();
+	Graph G(0, true, false);
+	reader.replay(G);
+	GraphDifference diff(G, H);
+	diff.run();
+	EXPECT_EQ(0u, diff.getNumberOfEdits());
+	H.forEdges([&](node u, node v, edgeweight w) {
+		EXPECT_EQ(w, G.weight(u, v));
+	});
+
+	// a file with another format is rejected
+	EXPECT_THROW(GraphEventLogReader("input/example2.dgs"), std::runtime_error);
+
+	// a block with more events than bytes is rejected while reading the headers
+	{
+		std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp(8);
+		const char numEvents[8] = {0, 0, 0, 0, 0, 0, 0, 0x10};
+		file.write(numEvents, sizeof(numEvents));
+	}
+	EXPECT_THROW(GraphEventLogReader reader(path), std::runtime_error);
+}
+
 TEST_F(IOGTest, testKONECTGraphReader){
 	KONECTGraphReader reader;
 	Graph G = reader.read("input/foodweb-baydry.konect");
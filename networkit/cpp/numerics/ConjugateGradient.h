@@ -8,23 +8,34 @@
 #ifndef CONJUGATE_GRADIENT_H_
 #define CONJUGATE_GRADIENT_H_
 
+#include <cmath>
 #include <cstdint>
 #include <utility>
 
 #include "LinearSolver.h"
 #include "../algebraic/Vector.h"
 #include "../algebraic/CSRMatrix.h"
+#include "../algebraic/DenseMatrix.h"
+#include "../algebraic/GraphBLAS.h"
+#include "../auxiliary/Timer.h"
 
 namespace NetworKit {
 
 /**
  * @ingroup numerics
- * Implementation of Conjugate Gradient.
+ * Implementation of Conjugate Gradient. Several right-hand sides can be solved at once with the block conjugate
+ * gradient method, see blockSolve().
  */
 template<class Matrix, class Preconditioner>
 class ConjugateGradient : public LinearSolver<Matrix> {
 public:
-	ConjugateGradient(double tolerance = 1e-5) : LinearSolver<Matrix>(tolerance), matrix(Matrix()) {}
+	/**
+	 * Constructs a conjugate gradient solver with the given @a tolerance for the relative residual. Up to
+	 * @a blockSize right-hand sides are solved together by blockSolve().
+	 * @param tolerance
+	 * @param blockSize
+	 */
+	ConjugateGradient(double tolerance = 1e-5, count blockSize = 16) : LinearSolver<Matrix>(tolerance), matrix(Matrix()), blockSize(std::max<count>(blockSize, 1)) {}
 
 	void setup(const Matrix& matrix) {
 		this->matrix = matrix;
@@ -58,10 +69,26 @@ public:
 	 */
 	void parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
 
+	/**
+	 * Solves the linear systems with the breakdown-free block conjugate gradient method of Ji and Li (2017) in
+	 * blocks of up to blockSize right-hand sides. All systems of a block share the search space, and the matrix is
+	 * traversed once per iteration for the whole block. The entries of @a results are used as initial guesses.
+	 * Systems whose relative residual is below the tolerance are removed from the block.
+	 * @param rhs
+	 * @param results
+	 * @param maxConvergenceTime Maximum time in milliseconds for all systems; blocks that are reached afterwards keep
+	 * their initial guesses.
+	 * @param maxIterations
+	 * @return The @ref SolverStatus of each system.
+	 */
+	std::vector<SolverStatus> blockSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max()) override;
+
 private:
 	Matrix matrix;
 	Preconditioner precond;
+	count blockSize;
 
+	void solveBlock(const std::vector<Vector>& rhs, std::vector<Vector>& results, index first, index last, const Aux::Timer& timer, count maxConvergenceTime, count maxIterations, std::vector<SolverStatus>& stati) const;
 };
 
 template<class Matrix, class Preconditioner>
@@ -69,31 +96,42 @@ SolverStatus ConjugateGradient<Matrix, Preconditioner>::solve(const Vector& rhs,
 	assert(matrix.numberOfRows() == rhs.getDimension());
 
 	// Absolute residual to achieve
-	double sqr_desired_residual = this->tolerance * this->tolerance * (rhs.length() * rhs.length());
+	double sqr_desired_residual = this->tolerance * this->tolerance * Vector::innerProduct(rhs, rhs);
 
 	// Main loop. See: http://en.wikipedia.org/wiki/Conjugate_gradient_method#The_resulting_algorithm
-	Vector residual_dir = rhs - matrix*result;
+	// The Polak-Ribiere update of the search direction also allows preconditioners that are not strictly linear,
+	// e.g. a multigrid cycle, and coincides with the classic update otherwise. As the change of the residual is
+	// -step * tmp, its inner product with the preconditioned residual is computed without keeping the old residual.
+	// The vectors are updated in place with fused kernels.
+	Vector residual_dir = matrix*result;
+	residual_dir.axpby(1.0, rhs, -1.0);
 	Vector conjugate_dir = precond.rhs(residual_dir);
-	double sqr_residual = Vector::innerProduct(residual_dir, residual_dir);
-	double sqr_residual_precond = Vector::innerProduct(residual_dir, conjugate_dir);
+	std::pair<double, double> products = Vector::innerProducts(residual_dir, residual_dir, conjugate_dir);
+	double sqr_residual = products.first;
+	double sqr_residual_precond = products.second;
+	std::vector<double> residualHistory(1, std::sqrt(sqr_residual));
 
+	Aux::Timer timer;
+	timer.start();
 	count niters = 0;
 	Vector tmp, residual_precond;
 	while (sqr_residual > sqr_desired_residual) {
 		niters++;
-		if (niters > maxIterations) {
+		if (niters > maxIterations || timer.elapsedMilliseconds() > maxConvergenceTime) {
 			break;
 		}
 
 		tmp = matrix * conjugate_dir;
 		double step = sqr_residual_precond / Vector::innerProduct(conjugate_dir, tmp);
-		result += step * conjugate_dir;
-		residual_dir -= step * tmp;
-		sqr_residual = Vector::innerProduct(residual_dir, residual_dir);
+		result.axpy(step, conjugate_dir);
+		sqr_residual = residual_dir.axpyAndSquaredLength(-step, tmp);
+		residualHistory.push_back(std::sqrt(sqr_residual));
 
 		residual_precond = precond.rhs(residual_dir);
-		double new_sqr_residual_precond = Vector::innerProduct(residual_dir, residual_precond);
-		conjugate_dir = (new_sqr_residual_precond / sqr_residual_precond) * conjugate_dir + residual_precond;
+		products = Vector::innerProducts(residual_precond, residual_dir, tmp);
+		double new_sqr_residual_precond = products.first;
+		double beta = -step * products.second / sqr_residual_precond;
+		conjugate_dir.axpby(1.0, residual_precond, beta);
 		sqr_residual_precond = new_sqr_residual_precond;
 	}
 
@@ -101,6 +139,7 @@ SolverStatus ConjugateGradient<Matrix, Preconditioner>::solve(const Vector& rhs,
 	status.numIters = niters;
 	status.residual = (rhs - matrix*result).length();
 	status.converged = status.residual / rhs.length() <= this->tolerance;
+	status.residualHistory = std::move(residualHistory);
 
 	return status;
 }
@@ -114,9 +153,159 @@ void ConjugateGradient<Matrix, Preconditioner>::parallelSolve(const std::vector<
 }
 
 
+template<class Matrix, class Preconditioner>
+std::vector<SolverStatus> ConjugateGradient<Matrix, Preconditioner>::blockSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
+	assert(rhs.size() == results.size());
+	Aux::Timer timer;
+	timer.start();
+	std::vector<SolverStatus> stati(rhs.size());
+	for (index first = 0; first < rhs.size(); first += blockSize) {
+		solveBlock(rhs, results, first, std::min<index>(first + blockSize, rhs.size()), timer, maxConvergenceTime, maxIterations, stati);
+	}
+
+	return stati;
+}
+
+template<class Matrix, class Preconditioner>
+void ConjugateGradient<Matrix, Preconditioner>::solveBlock(const std::vector<Vector>& rhs, std::vector<Vector>& results, index first, index last, const Aux::Timer& timer, count maxConvergenceTime, count maxIterations, std::vector<SolverStatus>& stati) const {
+	const count n = matrix.numberOfRows();
+	const count k = last - first;
+
+	// X and R hold the solutions and residuals of the active systems, column c belongs to system active[c]
+	std::vector<index> active(k);
+	std::vector<double> desiredResidual(k);
+	DenseMatrix X(n, k);
+	DenseMatrix B(n, k);
+	for (index c = 0; c < k; ++c) {
+		assert(rhs[first + c].getDimension() == n && results[first + c].getDimension() == n);
+		active[c] = first + c;
+		desiredResidual[c] = this->tolerance * rhs[first + c].length();
+#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+			X.setValue(i, c, results[first + c][i]);
+			B.setValue(i, c, rhs[first + c][i]);
+		}
+	}
+	DenseMatrix R = B - GraphBLAS::MxMultiV(matrix, X);
+
+	auto residualNorms = [&](const DenseMatrix& R) {
+		std::vector<double> norms(R.numberOfColumns(), 0.0);
+		for (index i = 0; i < n; ++i) {
+			for (index c = 0; c < R.numberOfColumns(); ++c) {
+				norms[c] += R(i, c) * R(i, c);
+			}
+		}
+		for (double& norm : norms) {
+			norm = std::sqrt(norm);
+		}
+		return norms;
+	};
+
+	auto precondition = [&](const DenseMatrix& R) {
+		DenseMatrix Z(n, R.numberOfColumns());
+#pragma omp parallel for
+		for (omp_index c = 0; c < static_cast<omp_index>(R.numberOfColumns()); ++c) {
+			Vector z = precond.rhs(R.column(c));
+			for (index i = 0; i < n; ++i) {
+				Z.setValue(i, c, z[i]);
+			}
+		}
+		return Z;
+	};
+
+	// writes the solution of column c back and finishes its status
+	auto finish = [&](index c, const std::vector<double>& norms, count iterations) {
+		index s = active[c];
+		for (index i = 0; i < n; ++i) {
+			results[s][i] = X(i, c);
+		}
+		stati[s].numIters = iterations;
+		stati[s].residual = norms[c];
+		stati[s].converged = norms[c] <= desiredResidual[c];
+	};
+
+	// removes the converged columns from X, R and the bookkeeping
+	auto deflate = [&](const std::vector<double>& norms, count iterations) {
+		std::vector<index> keep;
+		for (index c = 0; c < active.size(); ++c) {
+			if (norms[c] <= desiredResidual[c]) {
+				finish(c, norms, iterations);
+			} else {
+				keep.push_back(c);
+			}
+		}
+
+		if (keep.size() == active.size()) return;
+		DenseMatrix newX(n, keep.size()), newR(n, keep.size());
+#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+			for (index c = 0; c < keep.size(); ++c) {
+				newX.setValue(i, c, X(i, keep[c]));
+				newR.setValue(i, c, R(i, keep[c]));
+			}
+		}
+		std::vector<index> newActive(keep.size());
+		std::vector<double> newDesired(keep.size());
+		for (index c = 0; c < keep.size(); ++c) {
+			newActive[c] = active[keep[c]];
+			newDesired[c] = desiredResidual[keep[c]];
+		}
+		X = std::move(newX);
+		R = std::move(newR);
+		active = std::move(newActive);
+		desiredResidual = std::move(newDesired);
+	};
+
+	std::vector<double> norms = residualNorms(R);
+	for (index c = 0; c < k; ++c) {
+		stati[first + c].residualHistory.assign(1, norms[c]);
+	}
+	deflate(norms, 0);
+
+	DenseMatrix P = DenseMatrix::orthonormalizeColumns(precondition(R));
+	count iterations = 0;
+	while (!active.empty() && P.numberOfColumns() > 0 && iterations < maxIterations && timer.elapsedMilliseconds() <= maxConvergenceTime) {
+		++iterations;
+		DenseMatrix Q = GraphBLAS::MxMultiV(matrix, P);
+		// P^T A P is decomposed once for both small systems
+		DenseMatrix PtQ = DenseMatrix::mTmMultiply(P, Q);
+		DenseMatrix::LUDecomposition(PtQ);
+		DenseMatrix alpha = DenseMatrix::LUSolve(PtQ, DenseMatrix::mTmMultiply(P, R));
+		X += P * alpha;
+		R -= Q * alpha;
 
+		norms = residualNorms(R);
+		for (index c = 0; c < active.size(); ++c) {
+			stati[active[c]].residualHistory.push_back(norms[c]);
+		}
 
+		// the next search directions are A-orthogonal to P
+		DenseMatrix Z = precondition(R);
+		DenseMatrix beta = DenseMatrix::LUSolve(PtQ, DenseMatrix::mTmMultiply(Q, Z));
+		DenseMatrix D = Z - P * beta;
 
+		// columns of converged systems no longer contribute to the search space
+		std::vector<index> open;
+		for (index c = 0; c < active.size(); ++c) {
+			if (norms[c] > desiredResidual[c]) open.push_back(c);
+		}
+		DenseMatrix Dopen(n, open.size());
+#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+			for (index c = 0; c < open.size(); ++c) {
+				Dopen.setValue(i, c, D(i, open[c]));
+			}
+		}
+
+		deflate(norms, iterations);
+		P = DenseMatrix::orthonormalizeColumns(Dopen);
+	}
+
+	norms = residualNorms(R);
+	for (index c = 0; c < active.size(); ++c) {
+		finish(c, norms, iterations);
+	}
+}
 
 } /* namespace NetworKit */
 
@@ -0,0 +1,88 @@
+/*
+ * EigenSolver.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_NUMERICS_EIGENSOLVER_H_
+#define NETWORKIT_CPP_NUMERICS_EIGENSOLVER_H_
+
+#include "../algebraic/Vector.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace NetworKit {
+
+/** Specifies the end of the spectrum an EigenSolver computes. */
+enum SpectrumEnd {SMALLEST, LARGEST};
+
+/** Describes the status of an EigenSolver after the solver finished. */
+struct EigenSolverStatus {
+	count numIters; // number of iterations (restart cycles for Lanczos)
+	count numConverged; // number of eigenpairs whose residual is below the tolerance
+	bool converged; // flag of conversion status of all requested eigenpairs
+	std::vector<double> residuals; // absolute residuals ||Ax - lambda x|| of the eigenpairs
+};
+
+/**
+ * @ingroup numerics
+ * Abstract base class for solvers that compute a few eigenpairs at one end of the spectrum of a symmetric matrix,
+ * e.g. of the adjacency, Laplacian or normalized Laplacian matrix of an undirected graph.
+ */
+template<class Matrix>
+class EigenSolver {
+protected:
+	double tolerance;
+	Matrix matrix;
+	double normBound; // upper bound on the spectral norm of matrix
+
+	/** Returns ||Ax - lambda x||. */
+	double residual(const Vector& x, double lambda) const {
+		return (matrix * x - lambda * x).length();
+	}
+
+public:
+	/**
+	 * Constructs an abstract eigensolver with the given @a tolerance. An eigenpair (lambda, x) with ||x|| = 1 is
+	 * converged if ||Ax - lambda x|| is less than or equal to @a tolerance times an upper bound on the spectral
+	 * norm of A.
+	 * @param tolerance
+	 */
+	EigenSolver(const double tolerance) : tolerance(tolerance), normBound(0.0) {}
+	virtual ~EigenSolver() = default;
+
+	/**
+	 * Sets the solver up for the symmetric @a matrix.
+	 * @param matrix
+	 */
+	virtual void setup(const Matrix& matrix) {
+		this->matrix = matrix;
+
+		// the maximal absolute row sum bounds the spectral norm
+		normBound = 0.0;
+		for (index i = 0; i < matrix.numberOfRows(); ++i) {
+			double rowSum = 0.0;
+			matrix.forNonZeroElementsInRow(i, [&](index, double value) {
+				rowSum += std::abs(value);
+			});
+			normBound = std::max(normBound, rowSum);
+		}
+	}
+
+	/**
+	 * Computes the @a k smallest or largest eigenvalues and the corresponding orthonormal eigenvectors of the
+	 * matrix that has been setup in @ref setup.
+	 * @param k Number of eigenpairs.
+	 * @param which SMALLEST or LARGEST end of the spectrum.
+	 * @param eigenvalues The eigenvalues, ordered from the requested end of the spectrum.
+	 * @param eigenvectors The corresponding eigenvectors.
+	 * @param maxIterations
+	 * @return A @ref EigenSolverStatus object which provides the residuals of the eigenpairs.
+	 */
+	virtual EigenSolverStatus solve(count k, SpectrumEnd which, std::vector<double>& eigenvalues, std::vector<Vector>& eigenvectors, count maxIterations = 1000) = 0;
+};
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_NUMERICS_EIGENSOLVER_H_ */
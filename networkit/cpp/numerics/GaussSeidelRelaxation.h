@@ -56,16 +56,15 @@ public:
 template<class Matrix>
 Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, const Vector& initialGuess, const count maxIterations) const {
 	count iterations = 0;
-	Vector x_old = initialGuess;
 	Vector x_new = initialGuess;
 	if (maxIterations == 0) return initialGuess;
 
 	count dimension = A.numberOfColumns();
 	Vector diagonal = A.diagonal();
+	double desiredResidual = tolerance * b.length();
+	Vector residual;
 
 	do {
-		x_old = x_new;
-
 		for (index i = 0; i < dimension; ++i) {
 			double sigma = 0.0;
 			A.forNonZeroElementsInRow(i, [&](index column, double value) {
@@ -78,7 +77,10 @@ Vector GaussSeidelRelaxation<Matrix>::relax(const Matrix& A, const Vector& b, co
 		}
 
 		iterations++;
-	} while (iterations < maxIterations && (A*x_new - b).length() / b.length() > tolerance);
+		if (iterations >= maxIterations) break;
+
+		residual = A * x_new;
+	} while (residual.axpyAndSquaredLength(-1.0, b) > desiredResidual * desiredResidual);
 
 	return x_new;
 }
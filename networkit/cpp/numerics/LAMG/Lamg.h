@@ -8,6 +8,8 @@
 #ifndef NETWORKIT_CPP_NUMERICS_LAMG_LAMG_H_
 #define NETWORKIT_CPP_NUMERICS_LAMG_LAMG_H_
 
+#include <cstdio>
+#include <fstream>
 #include <vector>
 
 #include "../LinearSolver.h"
@@ -16,6 +18,7 @@
 #include "../GaussSeidelRelaxation.h"
 #include "../../algebraic/MatrixTools.h"
 #include "../../components/ParallelConnectedComponents.h"
+#include "../../auxiliary/Log.h"
 #include "omp.h"
 
 namespace NetworKit {
@@ -46,6 +49,17 @@ private:
 
 	void initializeForOneComponent();
 
+	/**
+	 * Computes the @a hierarchy for the Laplacian @a matrix with fingerprint @a fingerprint, or loads it from the
+	 * hierarchy cache directory if it has been stored there before.
+	 */
+	void setupHierarchy(const Matrix& matrix, uint64_t fingerprint, LevelHierarchy<Matrix>& hierarchy);
+
+	static std::string& hierarchyCacheDirectory() {
+		static std::string directory;
+		return directory;
+	}
+
 public:
 	/**
 	 * Construct a solver with the given @a tolerance. The relative residual ||Ax-b||/||b|| will be less than or equal to
@@ -65,12 +79,37 @@ public:
 	void setup(const Matrix& laplacianMatrix);
 
 	/**
-	 * Compute the multigrid hierarchy for te given Laplacian matrix @a laplacianMatrix.
+	 * Compute the multigrid hierarchy for te given Laplacian matrix @a laplacianMatrix. If the solver has already been
+	 * set up for the same Laplacian matrix, the existing hierarchy is kept.
 	 * @param laplacianMatrix
 	 * @note The graph has to be connected for this method to work. Otherwise the output is undefined.
 	 */
 	void setupConnected(const Matrix& laplacianMatrix);
 
+	/**
+	 * Set up the solver for the Laplacian matrix @a laplacianMatrix of a connected graph with the precomputed
+	 * @a hierarchy, e.g. one returned by getHierarchy() or loaded with LevelHierarchy::load.
+	 * @param laplacianMatrix
+	 * @param hierarchy The hierarchy of @a laplacianMatrix.
+	 */
+	void setupConnected(const Matrix& laplacianMatrix, const LevelHierarchy<Matrix>& hierarchy);
+
+	/**
+	 * @return The hierarchy of the Laplacian matrix the solver has been set up for with @ref setupConnected.
+	 */
+	const LevelHierarchy<Matrix>& getHierarchy() const;
+
+	/**
+	 * Sets the @a directory in which the hierarchies computed by all LAMG solvers are stored, keyed by the
+	 * fingerprint of the Laplacian matrix. Setting up a solver for a Laplacian whose hierarchy is stored there loads
+	 * the hierarchy instead of recomputing it, also across program runs. An empty string disables the cache, which
+	 * is the default.
+	 * @param directory An existing directory.
+	 */
+	static void setHierarchyCacheDirectory(const std::string& directory) {
+		hierarchyCacheDirectory() = directory;
+	}
+
 	/**
 	 * Computes the @a result for the matrix currently setup and the right-hand side @a rhs.
 	 * The maximum spent time can be specified by @a maxConvergenceTime and the maximum number of iterations can be set
@@ -96,10 +135,43 @@ public:
 
 };
 
+template<class Matrix>
+void Lamg<Matrix>::setupHierarchy(const Matrix& matrix, uint64_t fingerprint, LevelHierarchy<Matrix>& hierarchy) {
+	const std::string& directory = hierarchyCacheDirectory();
+	if (directory.empty()) {
+		lamgSetup.setup(matrix, hierarchy);
+		return;
+	}
+
+	char name[32];
+	std::snprintf(name, sizeof(name), "%016llx.lamg", static_cast<unsigned long long>(fingerprint));
+	std::string path = directory + "/" + name;
+	if (std::ifstream(path).good()) {
+		try {
+			hierarchy.load(path);
+			const Matrix& A = hierarchy.at(0).getLaplacian();
+			if (hierarchy.getFingerprint() == fingerprint && A.numberOfRows() == matrix.numberOfRows() && A.nnz() == matrix.nnz()) {
+				return;
+			}
+		} catch (std::exception& e) {
+			WARN("ignoring cached LAMG hierarchy ", path, ": ", e.what());
+		}
+		// a cached hierarchy of another matrix must not be mixed with the new levels
+		hierarchy = LevelHierarchy<Matrix>();
+	}
+
+	lamgSetup.setup(matrix, hierarchy);
+	try {
+		hierarchy.save(path);
+	} catch (std::exception& e) {
+		WARN("unable to cache LAMG hierarchy in ", path, ": ", e.what());
+	}
+}
+
 template<class Matrix>
 void Lamg<Matrix>::initializeForOneComponent() {
 	compHierarchies = std::vector<LevelHierarchy<Matrix>>(1);
-	lamgSetup.setup(laplacianMatrix, compHierarchies[0]);
+	setupHierarchy(laplacianMatrix, LevelHierarchy<Matrix>::fingerprint(laplacianMatrix), compHierarchies[0]);
 	compSolvers.clear();
 	compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
 	validSetup = true;
@@ -107,11 +179,40 @@ void Lamg<Matrix>::initializeForOneComponent() {
 
 template<class Matrix>
 void Lamg<Matrix>::setupConnected(const Matrix& laplacianMatrix) {
+	if (validSetup && numComponents == 1 && this->laplacianMatrix.numberOfRows() == laplacianMatrix.numberOfRows()
+			&& this->laplacianMatrix.nnz() == laplacianMatrix.nnz()
+			&& compHierarchies[0].getFingerprint() == LevelHierarchy<Matrix>::fingerprint(laplacianMatrix)) {
+		return; // the hierarchy is still valid
+	}
+
 	this->laplacianMatrix = laplacianMatrix;
 	initializeForOneComponent();
 	numComponents = 1;
 }
 
+template<class Matrix>
+void Lamg<Matrix>::setupConnected(const Matrix& laplacianMatrix, const LevelHierarchy<Matrix>& hierarchy) {
+	if (hierarchy.getFingerprint() != LevelHierarchy<Matrix>::fingerprint(laplacianMatrix)) {
+		throw std::runtime_error("The hierarchy does not belong to the given Laplacian matrix.");
+	}
+
+	this->laplacianMatrix = laplacianMatrix;
+	compHierarchies = std::vector<LevelHierarchy<Matrix>>(1, hierarchy);
+	compSolvers.clear();
+	compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[0], smoother));
+	validSetup = true;
+	numComponents = 1;
+}
+
+template<class Matrix>
+const LevelHierarchy<Matrix>& Lamg<Matrix>::getHierarchy() const {
+	if (!validSetup || numComponents != 1) {
+		throw std::runtime_error("The solver has not been set up for a connected graph.");
+	}
+
+	return compHierarchies[0];
+}
+
 template<class Matrix>
 void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
 	this->laplacianMatrix = laplacianMatrix;
@@ -153,7 +254,7 @@ void Lamg<Matrix>::setup(const Matrix& laplacianMatrix) {
 			Matrix compMatrix(component.size(), component.size(), triplets);
 			initialVectors[compIdx] = Vector(component.size());
 			rhsVectors[compIdx] = Vector(component.size());
-			lamgSetup.setup(compMatrix, compHierarchies[compIdx]);
+			setupHierarchy(compMatrix, LevelHierarchy<Matrix>::fingerprint(compMatrix), compHierarchies[compIdx]);
 			compSolvers.push_back(SolverLamg<Matrix>(compHierarchies[compIdx], smoother));
 			LAMGSolverStatus status;
 			status.desiredResidualReduction = this->tolerance * component.size() / G.numberOfNodes();
@@ -185,6 +286,7 @@ SolverStatus Lamg<Matrix>::solve(const Vector& rhs, Vector& result, count maxCon
 		status.residual = stat.residual;
 		status.numIters = stat.numIters;
 		status.converged = stat.converged;
+		status.residualHistory = stat.residualHistory;
 	} else {
 		// solve on every component
 		count maxIters = 0;
@@ -27,6 +27,10 @@ private:
 public:
 	LevelElimination(const Matrix& A, const std::vector<EliminationStage<Matrix>>& coarseningStages);
 
+	inline const std::vector<EliminationStage<Matrix>>& getStages() const {
+		return coarseningStages;
+	}
+
 	void coarseType(const Vector& xf, Vector& xc) const;
 	void restrict(const Vector& bf, Vector& bc, std::vector<Vector>& bStages) const;
 	void interpolate(const Vector& xc, Vector& xf, const std::vector<Vector>& bStages) const;
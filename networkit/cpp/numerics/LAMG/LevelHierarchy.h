@@ -15,6 +15,16 @@
 #include "LAMGSettings.h"
 #include "../../algebraic/DenseMatrix.h"
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
 namespace NetworKit {
 
 /**
@@ -29,9 +39,22 @@ private:
 	std::vector<LevelAggregation<Matrix>> aggregationLevels;
 	LevelFinest<Matrix> finestLevel;
 	DenseMatrix coarseLUMatrix;
+	uint64_t finestFingerprint = 0;
+
+	static const uint64_t FILE_MAGIC = 0x314847414D4C4B4EULL; // "NKLAMGH1"
 
 	void createCoarseMatrix();
 
+	template<typename T> static void writeValue(std::ostream& os, T value);
+	template<typename T> static T readValue(std::istream& is);
+	template<typename T> static void writeArray(std::ostream& os, const std::vector<T>& values);
+	template<typename T> static std::vector<T> readArray(std::istream& is);
+	static uint64_t remainingBytes(std::istream& is);
+	static void checkMatrix(count nRows, count nCols, const std::vector<index>& rowIdx, const std::vector<index>& columnIdx, const std::vector<double>& nonZeros);
+	static void writeMatrix(std::ostream& os, const Matrix& A);
+	template<class M> static void readMatrix(std::istream& is, M& A);
+	static void readMatrix(std::istream& is, CSRMatrix& A);
+
 public:
 	LevelHierarchy() = default;
 
@@ -50,11 +73,57 @@ public:
 	LevelType getType(index levelIdx) const;
 	Level<Matrix>& at(index levelIdx);
 	double cycleIndex(index levelIdx);
+
+	/**
+	 * @return The fingerprint of the Laplacian matrix of the finest level.
+	 */
+	inline uint64_t getFingerprint() const {
+		return finestFingerprint;
+	}
+
+	/**
+	 * Computes a 64 bit fingerprint of the Laplacian matrix @a A that does not depend on the order of the non-zeros
+	 * within the rows. A stored hierarchy can be reused for a Laplacian with the same dimension and fingerprint.
+	 * @param A
+	 * @return The fingerprint of @a A.
+	 */
+	static uint64_t fingerprint(const Matrix& A);
+
+	/**
+	 * Writes the hierarchy in a binary format to @a os. The format depends on the endianness of the machine.
+	 * @param os
+	 */
+	void write(std::ostream& os) const;
+
+	/**
+	 * Replaces this hierarchy with the hierarchy read from @a is, as written by write(). Throws a std::runtime_error
+	 * if the stream is truncated or its arrays do not fit the dimensions of the matrices; the hierarchy is left
+	 * unchanged in this case.
+	 * @param is
+	 */
+	void read(std::istream& is);
+
+	/**
+	 * Writes the hierarchy to the file at @a path. The file is written under a temporary name in the same directory
+	 * and renamed to @a path afterwards, so that a concurrent load() never reads a partially written file.
+	 * @param path
+	 */
+	void save(const std::string& path) const;
+
+	/**
+	 * Replaces this hierarchy with the hierarchy stored in the file at @a path.
+	 * @param path
+	 */
+	void load(const std::string& path);
 };
 
+template<class Matrix>
+const uint64_t LevelHierarchy<Matrix>::FILE_MAGIC;
+
 template<class Matrix>
 void LevelHierarchy<Matrix>::addFinestLevel(const Matrix& A) {
 	finestLevel = LevelFinest<Matrix>(A);
+	finestFingerprint = fingerprint(A);
 }
 
 template<class Matrix>
@@ -136,6 +205,283 @@ double LevelHierarchy<Matrix>::cycleIndex(index levelIdx) {
 	return gamma;
 }
 
+template<class Matrix>
+uint64_t LevelHierarchy<Matrix>::fingerprint(const Matrix& A) {
+	auto mix = [](uint64_t z) {
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		return z ^ (z >> 31);
+	};
+
+	// the hashes of the entries are summed up, so the order of the non-zeros does not matter
+	uint64_t hash = 0;
+#pragma omp parallel for reduction(+:hash)
+	for (omp_index i = 0; i < static_cast<omp_index>(A.numberOfRows()); ++i) {
+		A.forNonZeroElementsInRow(i, [&](index j, double value) {
+			hash += mix(mix(i * 0x9E3779B97F4A7C15ULL + j) ^ std::hash<double>()(value));
+		});
+	}
+
+	return mix(hash ^ mix(A.numberOfRows())) ^ mix(A.numberOfColumns() + 0x9E3779B97F4A7C15ULL);
+}
+
+template<class Matrix>
+template<typename T>
+void LevelHierarchy<Matrix>::writeValue(std::ostream& os, T value) {
+	os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<class Matrix>
+template<typename T>
+T LevelHierarchy<Matrix>::readValue(std::istream& is) {
+	T value = T();
+	is.read(reinterpret_cast<char*>(&value), sizeof(T));
+	return value;
+}
+
+template<class Matrix>
+template<typename T>
+void LevelHierarchy<Matrix>::writeArray(std::ostream& os, const std::vector<T>& values) {
+	writeValue<uint64_t>(os, values.size());
+	os.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+template<class Matrix>
+template<typename T>
+std::vector<T> LevelHierarchy<Matrix>::readArray(std::istream& is) {
+	uint64_t size = readValue<uint64_t>(is);
+	if (!is || size > remainingBytes(is) / sizeof(T)) {
+		// a corrupt size would otherwise end in a huge allocation
+		throw std::runtime_error("The stored LAMG level hierarchy is truncated");
+	}
+	std::vector<T> values(size);
+	is.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
+	if (!is) {
+		throw std::runtime_error("The stored LAMG level hierarchy is truncated");
+	}
+	return values;
+}
+
+template<class Matrix>
+uint64_t LevelHierarchy<Matrix>::remainingBytes(std::istream& is) {
+	std::istream::pos_type pos = is.tellg();
+	if (pos == std::istream::pos_type(-1)) return std::numeric_limits<uint64_t>::max(); // not seekable
+	is.seekg(0, std::ios::end);
+	std::istream::pos_type end = is.tellg();
+	is.seekg(pos);
+	return end > pos ? static_cast<uint64_t>(end - pos) : 0;
+}
+
+template<class Matrix>
+void LevelHierarchy<Matrix>::checkMatrix(count nRows, count nCols, const std::vector<index>& rowIdx, const std::vector<index>& columnIdx, const std::vector<double>& nonZeros) {
+	bool valid = rowIdx.size() == nRows + 1 && rowIdx[0] == 0 && rowIdx[nRows] == columnIdx.size() && columnIdx.size() == nonZeros.size();
+	for (index i = 0; i < nRows && valid; ++i) {
+		valid = rowIdx[i] <= rowIdx[i+1];
+	}
+	for (index k = 0; k < columnIdx.size() && valid; ++k) {
+		valid = columnIdx[k] < nCols;
+	}
+	if (!valid) {
+		throw std::runtime_error("The stored LAMG level hierarchy is corrupt");
+	}
+}
+
+template<class Matrix>
+void LevelHierarchy<Matrix>::writeMatrix(std::ostream& os, const Matrix& A) {
+	std::vector<index> rowIdx(A.numberOfRows()+1, 0);
+	std::vector<index> columnIdx;
+	std::vector<double> nonZeros;
+	columnIdx.reserve(A.nnz());
+	nonZeros.reserve(A.nnz());
+	A.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+		++rowIdx[i+1];
+		columnIdx.push_back(j);
+		nonZeros.push_back(value);
+	});
+
+	for (index i = 0; i < A.numberOfRows(); ++i) {
+		rowIdx[i+1] += rowIdx[i];
+	}
+
+	writeValue<uint64_t>(os, A.numberOfRows());
+	writeValue<uint64_t>(os, A.numberOfColumns());
+	writeValue<double>(os, A.getZero());
+	writeArray(os, rowIdx);
+	writeArray(os, columnIdx);
+	writeArray(os, nonZeros);
+}
+
+template<class Matrix>
+template<class M>
+void LevelHierarchy<Matrix>::readMatrix(std::istream& is, M& A) {
+	count nRows = readValue<uint64_t>(is);
+	count nCols = readValue<uint64_t>(is);
+	double zero = readValue<double>(is);
+	std::vector<index> rowIdx = readArray<index>(is);
+	std::vector<index> columnIdx = readArray<index>(is);
+	std::vector<double> nonZeros = readArray<double>(is);
+	checkMatrix(nRows, nCols, rowIdx, columnIdx, nonZeros);
+
+	std::vector<Triplet> triplets(nonZeros.size());
+	for (index i = 0; i < nRows; ++i) {
+		for (index k = rowIdx[i]; k < rowIdx[i+1]; ++k) {
+			triplets[k] = {i, columnIdx[k], nonZeros[k]};
+		}
+	}
+
+	A = M(nRows, nCols, triplets, zero);
+}
+
+template<class Matrix>
+void LevelHierarchy<Matrix>::readMatrix(std::istream& is, CSRMatrix& A) {
+	count nRows = readValue<uint64_t>(is);
+	count nCols = readValue<uint64_t>(is);
+	double zero = readValue<double>(is);
+	std::vector<index> rowIdx = readArray<index>(is);
+	std::vector<index> columnIdx = readArray<index>(is);
+	std::vector<double> nonZeros = readArray<double>(is);
+	checkMatrix(nRows, nCols, rowIdx, columnIdx, nonZeros);
+
+	bool sorted = true;
+	for (index i = 0; i < nRows && sorted; ++i) {
+		for (index k = rowIdx[i] + 1; k < rowIdx[i+1]; ++k) {
+			if (columnIdx[k-1] > columnIdx[k]) {
+				sorted = false;
+				break;
+			}
+		}
+	}
+
+	A = CSRMatrix(nRows, nCols, rowIdx, columnIdx, nonZeros, zero, sorted);
+}
+
+template<class Matrix>
+void LevelHierarchy<Matrix>::write(std::ostream& os) const {
+	writeValue<uint64_t>(os, FILE_MAGIC);
+	writeValue<uint64_t>(os, finestFingerprint);
+	writeMatrix(os, finestLevel.getLaplacian());
+
+	writeValue<uint64_t>(os, levelType.size());
+	for (index l = 0; l < levelType.size(); ++l) {
+		writeValue<uint64_t>(os, levelType[l]);
+		if (levelType[l] == ELIMINATION) {
+			const LevelElimination<Matrix>& level = eliminationLevels[levelIndex[l]];
+			writeMatrix(os, level.getLaplacian());
+			writeValue<uint64_t>(os, level.getStages().size());
+			for (const EliminationStage<Matrix>& stage : level.getStages()) {
+				writeMatrix(os, stage.getP());
+				std::vector<double> q(stage.getQ().getDimension());
+				for (index i = 0; i < q.size(); ++i) {
+					q[i] = stage.getQ()[i];
+				}
+				writeArray(os, q);
+				writeArray(os, stage.getFSet());
+				writeArray(os, stage.getCSet());
+			}
+		} else {
+			const LevelAggregation<Matrix>& level = aggregationLevels[levelIndex[l]];
+			writeMatrix(os, level.getLaplacian());
+			writeMatrix(os, level.getP());
+			writeMatrix(os, level.getR());
+		}
+	}
+
+	std::vector<double> lu(coarseLUMatrix.numberOfRows() * coarseLUMatrix.numberOfColumns());
+	for (index i = 0; i < coarseLUMatrix.numberOfRows(); ++i) {
+		for (index j = 0; j < coarseLUMatrix.numberOfColumns(); ++j) {
+			lu[i * coarseLUMatrix.numberOfColumns() + j] = coarseLUMatrix(i, j);
+		}
+	}
+	writeValue<uint64_t>(os, coarseLUMatrix.numberOfRows());
+	writeValue<uint64_t>(os, coarseLUMatrix.numberOfColumns());
+	writeArray(os, lu);
+}
+
+template<class Matrix>
+void LevelHierarchy<Matrix>::read(std::istream& is) {
+	if (readValue<uint64_t>(is) != FILE_MAGIC || !is) {
+		throw std::runtime_error("The stream does not contain a LAMG level hierarchy");
+	}
+
+	// the levels are read into a new hierarchy, so that this one is unchanged if the stream is corrupt
+	LevelHierarchy<Matrix> result;
+	uint64_t storedFingerprint = readValue<uint64_t>(is);
+	Matrix A;
+	readMatrix(is, A);
+	result.addFinestLevel(A);
+	if (result.finestFingerprint != storedFingerprint) {
+		throw std::runtime_error("The stored LAMG level hierarchy is corrupt");
+	}
+
+	count numLevels = readValue<uint64_t>(is);
+	for (index l = 0; l < numLevels; ++l) {
+		LevelType type = static_cast<LevelType>(readValue<uint64_t>(is));
+		readMatrix(is, A);
+		if (type == ELIMINATION) {
+			std::vector<EliminationStage<Matrix>> stages;
+			count numStages = readValue<uint64_t>(is);
+			for (index k = 0; k < numStages; ++k) {
+				Matrix P;
+				readMatrix(is, P);
+				Vector q(readArray<double>(is));
+				std::vector<index> fSet = readArray<index>(is);
+				std::vector<index> cSet = readArray<index>(is);
+				bool valid = q.getDimension() == fSet.size() && P.numberOfRows() == fSet.size() && P.numberOfColumns() == cSet.size();
+				for (index i : fSet) valid = valid && i < fSet.size() + cSet.size();
+				for (index i : cSet) valid = valid && i < fSet.size() + cSet.size();
+				if (!valid) {
+					throw std::runtime_error("The stored LAMG level hierarchy is corrupt");
+				}
+				stages.push_back(EliminationStage<Matrix>(P, q, fSet, cSet));
+			}
+			result.addEliminationLevel(A, stages);
+		} else {
+			Matrix P, R;
+			readMatrix(is, P);
+			readMatrix(is, R);
+			result.addAggregationLevel(A, P, R);
+		}
+	}
+
+	count nRows = readValue<uint64_t>(is);
+	count nCols = readValue<uint64_t>(is);
+	std::vector<double> lu = readArray<double>(is);
+	if (!is || lu.size() != nRows * nCols) {
+		throw std::runtime_error("The stored LAMG level hierarchy is truncated");
+	}
+	result.coarseLUMatrix = DenseMatrix(nRows, nCols, lu);
+	*this = std::move(result);
+}
+
+template<class Matrix>
+void LevelHierarchy<Matrix>::save(const std::string& path) const {
+	// the hierarchy is written to a temporary file that is renamed, so that readers never see a partial file
+	uint64_t unique = std::chrono::high_resolution_clock::now().time_since_epoch().count() ^ std::hash<std::thread::id>()(std::this_thread::get_id());
+	std::string tmpPath = path + ".tmp" + std::to_string(unique);
+	try {
+		std::ofstream os(tmpPath, std::ios::trunc | std::ios::binary);
+		os.exceptions(std::ofstream::badbit | std::ofstream::failbit);
+		write(os);
+		os.close();
+	} catch (...) {
+		std::remove(tmpPath.c_str());
+		throw;
+	}
+	if (std::rename(tmpPath.c_str(), path.c_str()) != 0) {
+		std::remove(tmpPath.c_str());
+		throw std::runtime_error("Unable to rename " + tmpPath + " to " + path);
+	}
+}
+
+template<class Matrix>
+void LevelHierarchy<Matrix>::load(const std::string& path) {
+	std::ifstream is(path, std::ios::binary);
+	if (!is) {
+		throw std::runtime_error("Unable to open " + path);
+	}
+	read(is);
+}
+
 } /* namespace NetworKit */
 
 #endif /* LEVELHIERARCHY_H_ */
@@ -105,47 +105,71 @@ void MultiLevelSetup<CSRMatrix>::computeAffinityMatrix(const CSRMatrix& matrix,
 
 template<>
 void MultiLevelSetup<CSRMatrix>::galerkinOperator(const CSRMatrix& P, const CSRMatrix& A, const std::vector<index>& PColIndex, const std::vector<std::vector<index>>& PRowIndex, CSRMatrix& B) const {
-	std::vector<Triplet> triplets;
-	SparseAccumulator spa(P.numberOfColumns());
-	for (index i = 0; i < P.numberOfColumns(); ++i) {
-		for (index k : PRowIndex[i]) {
-			double Pki = P(k,i);
-			A.forNonZeroElementsInRow(k, [&](index l, double value) {
-				index j = PColIndex[l];
-				spa.scatter(Pki * value * P(l, j), j);
-			});
-		}
+	count nCoarse = P.numberOfColumns();
+	std::vector<std::vector<index>> columnIdx(nCoarse);
+	std::vector<std::vector<double>> values(nCoarse);
+
+	// the rows of the coarse operator are independent, each thread accumulates its rows in its own SparseAccumulator
+#pragma omp parallel
+	{
+		SparseAccumulator spa(nCoarse);
+#pragma omp for schedule(guided)
+		for (omp_index i = 0; i < static_cast<omp_index>(nCoarse); ++i) {
+			for (index k : PRowIndex[i]) {
+				double Pki = P(k,i);
+				A.forNonZeroElementsInRow(k, [&](index l, double value) {
+					index j = PColIndex[l];
+					spa.scatter(Pki * value * P(l, j), j);
+				});
+			}
 
-		spa.gather([&](index i, index j, double value) {
-			triplets.push_back({i,j,value});
-		});
+			spa.gather([&](index, index j, double value) {
+				columnIdx[i].push_back(j);
+				values[i].push_back(value);
+			});
 
-		spa.increaseRow();
+			spa.increaseRow();
+		}
 	}
 
-	B = CSRMatrix(P.numberOfColumns(), P.numberOfColumns(), triplets, 0.0, true);
+	B = CSRMatrix(nCoarse, nCoarse, columnIdx, values, 0.0, true);
 }
 
 
 template<>
 void MultiLevelSetup<CSRMatrix>::eliminationOperators(const CSRMatrix& matrix, const std::vector<index>& fSet, const std::vector<index>& coarseIndex, CSRMatrix& P, Vector& q) const {
-	std::vector<Triplet> triples;
 	q = Vector(fSet.size());
-	for (index k = 0; k < fSet.size(); ++k) { // Afc
-		matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w){
+	std::vector<index> rowIdx(fSet.size()+1, 0);
+#pragma omp parallel for
+	for (omp_index k = 0; k < static_cast<omp_index>(fSet.size()); ++k) {
+		matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
 			if (fSet[k] == j) {
 				q[k] = 1.0 / w;
 			} else {
-				triples.push_back({k, coarseIndex[j], w});
+				++rowIdx[k+1];
 			}
 		});
 	}
 
-	for (index i = 0; i < triples.size(); ++i) { // * -Aff^-1
-		triples[i].value *= -q[triples[i].row];
+	for (index k = 0; k < fSet.size(); ++k) {
+		rowIdx[k+1] += rowIdx[k];
 	}
 
-	P = CSRMatrix(fSet.size(), coarseIndex.size() - fSet.size(), triples, 0.0, matrix.sorted());
+	std::vector<index> columnIdx(rowIdx[fSet.size()]);
+	std::vector<double> nonZeros(rowIdx[fSet.size()]);
+#pragma omp parallel for
+	for (omp_index k = 0; k < static_cast<omp_index>(fSet.size()); ++k) { // Afc * -Aff^-1
+		index cIdx = rowIdx[k];
+		matrix.forNonZeroElementsInRow(fSet[k], [&](index j, edgeweight w) {
+			if (fSet[k] != j) {
+				columnIdx[cIdx] = coarseIndex[j];
+				nonZeros[cIdx] = -q[k] * w;
+				++cIdx;
+			}
+		});
+	}
+
+	P = CSRMatrix(fSet.size(), coarseIndex.size() - fSet.size(), rowIdx, columnIdx, nonZeros, 0.0, matrix.sorted());
 }
 
 template<>
@@ -202,7 +226,8 @@ void MultiLevelSetup<CSRMatrix>::coarseningAggregation(CSRMatrix& matrix, LevelH
 		}
 	}
 
-	for (index i = 0; i < matrix.numberOfRows(); ++i) {
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
 		if (S[bestAggregate][i] == UNDECIDED) { // undediced nodes become their own seeds
 			S[bestAggregate][i] = i;
 		}
@@ -216,27 +241,26 @@ void MultiLevelSetup<CSRMatrix>::coarseningAggregation(CSRMatrix& matrix, LevelH
 		}
 	}
 
-	for (index i = 0; i < matrix.numberOfRows(); ++i) {
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(matrix.numberOfRows()); ++i) {
 		status[i] = indexFine[S[bestAggregate][i]];
 	}
 
 	assert(newIndex == nc[bestAggregate]);
 
-	// create interpolation matrix
-	std::vector<Triplet> pTriples(matrix.numberOfRows());
-	std::vector<Triplet> rTriples(matrix.numberOfRows());
-	std::vector<index> PColIndex(matrix.numberOfRows());
+	// create interpolation matrix, P has exactly one entry per row
+	std::vector<index> pRowIdx(matrix.numberOfRows()+1);
+	std::iota(pRowIdx.begin(), pRowIdx.end(), 0);
+	std::vector<double> pNonZeros(matrix.numberOfRows(), 1.0);
+	const std::vector<index>& PColIndex = status;
 	std::vector<std::vector<index>> PRowIndex(nc[bestAggregate]);
 
 	for (index i = 0; i < matrix.numberOfRows(); ++i) {
-		pTriples[i] = {i, status[i], 1};
-		rTriples[i] = {status[i], i, 1};
-		PColIndex[i] = status[i];
 		PRowIndex[status[i]].push_back(i);
 	}
 
-	CSRMatrix P(matrix.numberOfRows(), nc[bestAggregate], pTriples, 0.0, matrix.sorted());
-	CSRMatrix R(nc[bestAggregate], matrix.numberOfRows(), rTriples, 0.0, matrix.sorted());
+	CSRMatrix P(matrix.numberOfRows(), nc[bestAggregate], pRowIdx, PColIndex, pNonZeros, 0.0, true);
+	CSRMatrix R = P.transpose();
 
 	// create coarsened laplacian
 	galerkinOperator(P, matrix, PColIndex, PRowIndex, matrix);
@@ -12,7 +12,9 @@
 #include "../Smoother.h"
 #include "../../algebraic/CSRMatrix.h"
 
+#include <algorithm>
 #include <limits>
+#include <numeric>
 
 namespace NetworKit {
 
@@ -39,8 +41,8 @@ private:
 	bool coarseningElimination(Matrix& matrix, LevelHierarchy<Matrix>& hierarchy) const;
 
 	/**
-	 * Scans the Laplacian matrix for nodes with a low degree (i.e. nodes with less than 5 neighbors). For each node
-	 * having low degree and independent from already found low degree nodes, @code{true} is stored in @a fNode. The
+	 * Scans the Laplacian matrix for nodes with a low degree (i.e. nodes with less than 5 neighbors) and selects a
+	 * maximal independent set of them in parallel. For each selected node, @code{true} is stored in @a fNode. The
 	 * @a stage parameter specifies if we are in the first or subsequent stages during elimination.
 	 * @param matrix Laplacian matrix.
 	 * @param fNode[out] For each node, @code{true} if the node is of low degree and @code{false} otherwise.
@@ -49,6 +51,21 @@ private:
 	 */
 	count lowDegreeSweep(const Matrix& matrix, std::vector<bool>& fNode, index stage) const;
 
+	/** States of the nodes during the low degree sweep. */
+	enum SweepState : uint8_t {CANDIDATE, F_NODE, C_NODE};
+
+	/**
+	 * Pseudo-random but reproducible priority of node @a u for the low degree sweep.
+	 * @param u
+	 * @return The priority of @a u.
+	 */
+	static inline index eliminationPriority(index u) {
+		uint64_t x = u + 0x9E3779B97F4A7C15ULL;
+		x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+		return x ^ (x >> 31);
+	}
+
 	/**
 	 * Computes the projection matrix @a P and the @a q vector used to restrict and interpolate the matrix for an
 	 * elimination stage.
@@ -311,20 +328,64 @@ bool MultiLevelSetup<Matrix>::coarseningElimination(Matrix& matrix, LevelHierarc
 
 template<class Matrix>
 count MultiLevelSetup<Matrix>::lowDegreeSweep(const Matrix& matrix, std::vector<bool>& fNode, index stage) const {
-	fNode.resize(matrix.numberOfRows(), true); // first mark all nodes as f nodes
-	count numFNodes = 0;
+	const count n = matrix.numberOfRows();
 	int degreeOffset = stage != 0;
 
-	for (index i = 0; i < matrix.numberOfRows(); ++i) {
-		if ((int) matrix.nnzInRow(i) - degreeOffset <= (int)SETUP_ELIMINATION_MAX_DEGREE && fNode[i]) { // node i has degree <= 4 and can be eliminated
-			numFNodes++;
-			matrix.forNonZeroElementsInRow(i, [&](index j, edgeweight /*w*/){ // to maintain independence, mark all neighbors as not eliminated
-				if (j != i)	{ // all neighbors of this f node are c nodes
-					fNode[j] = false;
+	// every node of low degree is a candidate, all other nodes are c nodes
+	std::vector<uint8_t> state(n);
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+		state[i] = (int) matrix.nnzInRow(i) - degreeOffset <= (int) SETUP_ELIMINATION_MAX_DEGREE? CANDIDATE : C_NODE;
+	}
+
+	// The f nodes have to be independent. In each round, every candidate with the smallest priority among its
+	// candidate neighbors becomes an f node and its neighbors become c nodes. This yields a maximal independent set
+	// of the candidates after an expected logarithmic number of rounds.
+	auto precedes = [&](index u, index v) {
+		index pu = eliminationPriority(u), pv = eliminationPriority(v);
+		return pu < pv || (pu == pv && u < v);
+	};
+
+	std::vector<index> candidates(n);
+	std::iota(candidates.begin(), candidates.end(), 0);
+	std::vector<uint8_t> selected(n, false);
+	while (!candidates.empty()) {
+#pragma omp parallel for
+		for (omp_index k = 0; k < static_cast<omp_index>(candidates.size()); ++k) {
+			index i = candidates[k];
+			if (state[i] != CANDIDATE) continue;
+			bool localMinimum = true;
+			matrix.forNonZeroElementsInRow(i, [&](index j, edgeweight /*w*/) {
+				if (j != i && state[j] == CANDIDATE && precedes(j, i)) {
+					localMinimum = false;
 				}
 			});
-		} else { // node has high degree, thus it is a c node
-			fNode[i] = false;
+			selected[i] = localMinimum;
+		}
+
+#pragma omp parallel for
+		for (omp_index k = 0; k < static_cast<omp_index>(candidates.size()); ++k) {
+			index i = candidates[k];
+			if (!selected[i]) continue;
+			state[i] = F_NODE;
+			matrix.forNonZeroElementsInRow(i, [&](index j, edgeweight /*w*/) { // all neighbors of this f node are c nodes
+				if (j != i) {
+					state[j] = C_NODE;
+				}
+			});
+		}
+
+		candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [&](index i) {
+			return state[i] != CANDIDATE;
+		}), candidates.end());
+	}
+
+	fNode.assign(n, false);
+	count numFNodes = 0;
+	for (index i = 0; i < n; ++i) {
+		if (state[i] == F_NODE) {
+			fNode[i] = true;
+			numFNodes++;
 		}
 	}
 
@@ -500,16 +561,20 @@ void MultiLevelSetup<Matrix>::addHighDegreeSeedNodes(const Matrix& matrix, std::
 
 template<class Matrix>
 void MultiLevelSetup<Matrix>::aggregateLooseNodes(const Matrix& strongAdjMatrix, std::vector<index>& status, count& nc) const {
-	std::vector<index> looseNodes;
-	for (index i = 0; i < strongAdjMatrix.numberOfRows(); ++i) {
+	std::vector<uint8_t> loose(strongAdjMatrix.numberOfRows(), false);
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(strongAdjMatrix.numberOfRows()); ++i) {
 		double max = std::numeric_limits<double>::min();
 		strongAdjMatrix.forNonZeroElementsInRow(i, [&](index /*j*/, double value) {
 			if (value > max) max = value;
 		});
 
-		if (std::abs(max) < 1e-9 || max == std::numeric_limits<double>::min()) {
-			looseNodes.push_back(i);
-		}
+		loose[i] = std::abs(max) < 1e-9 || max == std::numeric_limits<double>::min();
+	}
+
+	std::vector<index> looseNodes;
+	for (index i = 0; i < strongAdjMatrix.numberOfRows(); ++i) {
+		if (loose[i]) looseNodes.push_back(i);
 	}
 
 	if (looseNodes.size() > 0) {
@@ -621,18 +686,33 @@ void MultiLevelSetup<Matrix>::aggregationStage(const Matrix& matrix, count& nc,
 	}
 
 	for (index k = bins.size(); k-- > 0;) { // iterate over undecided nodes with strong neighbors in decreasing order of strongest neighbor
-		for (index i : bins[k]) {
-			if (status[i] == UNDECIDED) { // node is still undecided
-				index s = 0;
-				if (findBestSeedEnergyCorrected(strongAdjMatrix, affinityMatrix, diag, tVs, status, i, s)) {
-					status[s] = s; // s becomes seed
-					status[i] = s; // i's seed is s
-					nc--;
-
-					for (index j = 0; j < tVs.size(); ++j) { // update test vectors
-						tVs[j][i] = tVs[j][s];
-					}
-				}
+		const std::vector<index>& bin = bins[k];
+
+		// the seeds of all nodes of the bin are searched in parallel...
+		std::vector<index> seeds(bin.size(), UNDECIDED);
+#pragma omp parallel for schedule(guided)
+		for (omp_index b = 0; b < static_cast<omp_index>(bin.size()); ++b) {
+			index i = bin[b];
+			index s = 0;
+			if (status[i] == UNDECIDED && findBestSeedEnergyCorrected(strongAdjMatrix, affinityMatrix, diag, tVs, status, i, s)) {
+				seeds[b] = s;
+			}
+		}
+
+		// ...and committed in the order of the bin. If the proposed seed has been aggregated in the meantime, the seed
+		// of the node is searched again.
+		for (index b = 0; b < bin.size(); ++b) {
+			index i = bin[b];
+			index s = seeds[b];
+			if (status[i] != UNDECIDED || s == UNDECIDED) continue;
+			if (status[s] != UNDECIDED && status[s] != s && !findBestSeedEnergyCorrected(strongAdjMatrix, affinityMatrix, diag, tVs, status, i, s)) continue;
+
+			status[s] = s; // s becomes seed
+			status[i] = s; // i's seed is s
+			nc--;
+
+			for (index j = 0; j < tVs.size(); ++j) { // update test vectors
+				tVs[j][i] = tVs[j][s];
 			}
 		}
 
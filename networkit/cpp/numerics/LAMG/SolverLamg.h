@@ -58,6 +58,9 @@ private:
 	void clearHistory(index level);
 	void minRes(index level, Vector& x, const Vector& r);
 
+	/** Returns the residual b - Ax of the Laplacian A at @a level. */
+	Vector computeResidual(index level, const Vector& b, const Vector& x) const;
+
 public:
 	/**
 	 * Constructs a new solver instance for the specified @a hierarchy. The @a smoother will be used for relaxing and
@@ -117,7 +120,7 @@ void SolverLamg<Matrix>::solve(Vector& x, const Vector& b, LAMGSolverStatus& sta
 		solveCycle(x, b, 0, status);
 	}
 
-	double residual = (b - hierarchy.at(0).getLaplacian() * x).length();
+	double residual = computeResidual(0, b, x).length();
 	status.residual = residual;
 }
 
@@ -141,7 +144,7 @@ void SolverLamg<Matrix>::solveCycle(Vector& x, const Vector& b, int finest, LAMG
 		rHistory[i] = std::vector<Vector>(MAX_COMBINED_ITERATES, Vector(hierarchy.at(i).getNumberOfNodes()));
 	}
 
-	Vector r = b - hierarchy.at(finest).getLaplacian() * x;
+	Vector r = computeResidual(finest, b, x);
 	double residual = r.length();
 	double finalResidual = residual * status.desiredResidualReduction;
 	double bestResidual = std::numeric_limits<double>::max();
@@ -151,7 +154,7 @@ void SolverLamg<Matrix>::solveCycle(Vector& x, const Vector& b, int finest, LAMG
 	count noResReduction = 0;
 	while (residual > finalResidual && noResReduction < 5 && iterations < status.maxIters && timer.elapsedMilliseconds() <= status.maxConvergenceTime ) {
 		cycle(x, b, finest, coarsest, numVisits, X, B, status);
-		r = b - hierarchy.at(finest).getLaplacian() * x;
+		r = computeResidual(finest, b, x);
 		residual = r.length();
 		status.residualHistory.emplace_back(residual);
 		if (residual < bestResidual) {
@@ -166,8 +169,8 @@ void SolverLamg<Matrix>::solveCycle(Vector& x, const Vector& b, int finest, LAMG
 	timer.stop();
 
 	status.numIters = iterations;
-	status.residual = r.length();
-	status.converged = r.length() <= finalResidual;
+	status.residual = residual;
+	status.converged = residual <= finalResidual;
 }
 
 template<class Matrix>
@@ -180,7 +183,7 @@ void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coars
 	int nextLvl = finest;
 	double maxVisits = 0.0;
 
-	saveIterate(currLvl, X[currLvl], B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl]);
+	saveIterate(currLvl, X[currLvl], computeResidual(currLvl, B[currLvl], X[currLvl]));
 	while (true) {
 		if (currLvl == coarsest) {
 			nextLvl = currLvl - 1;
@@ -223,7 +226,7 @@ void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coars
 			if (hierarchy.getType(nextLvl) == ELIMINATION) {
 				hierarchy.at(nextLvl).restrict(B[currLvl], B[nextLvl], bStages[nextLvl]);
 			} else {
-				hierarchy.at(nextLvl).restrict(B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl], B[nextLvl]);
+				hierarchy.at(nextLvl).restrict(computeResidual(currLvl, B[currLvl], X[currLvl]), B[nextLvl]);
 			}
 
 			hierarchy.at(nextLvl).coarseType(X[currLvl], X[nextLvl]);
@@ -231,11 +234,11 @@ void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coars
 			clearHistory(nextLvl);
 		} else { // postProcess
 			if (currLvl == coarsest || hierarchy.getType(currLvl+1) != ELIMINATION) {
-				minRes(currLvl, X[currLvl], B[currLvl] - hierarchy.at(currLvl).getLaplacian() * X[currLvl]);
+				minRes(currLvl, X[currLvl], computeResidual(currLvl, B[currLvl], X[currLvl]));
 			}
 
 			if (nextLvl > finest) {
-				saveIterate(nextLvl, X[nextLvl], B[nextLvl] - hierarchy.at(nextLvl).getLaplacian() * X[nextLvl]);
+				saveIterate(nextLvl, X[nextLvl], computeResidual(nextLvl, B[nextLvl], X[nextLvl]));
 			}
 
 			if (hierarchy.getType(currLvl) == ELIMINATION) {
@@ -257,7 +260,7 @@ void SolverLamg<Matrix>::cycle(Vector& x, const Vector& b, int finest, int coars
 
 	// post-cycle finest
 	if ((int64_t) hierarchy.size() > finest + 1 && hierarchy.getType(finest+1) != ELIMINATION) { // do an iterate recombination on calculated solutions
-		minRes(finest, X[finest], B[finest] - hierarchy.at(finest).getLaplacian() * X[finest]);
+		minRes(finest, X[finest], computeResidual(finest, B[finest], X[finest]));
 	}
 
 
@@ -282,6 +285,13 @@ void SolverLamg<Matrix>::saveIterate(index level, const Vector& x, const Vector&
 	rHistory[level][i] = r;
 }
 
+template<class Matrix>
+Vector SolverLamg<Matrix>::computeResidual(index level, const Vector& b, const Vector& x) const {
+	Vector r = hierarchy.at(level).getLaplacian() * x;
+	r.axpby(1.0, b, -1.0);
+	return r;
+}
+
 template<class Matrix>
 void SolverLamg<Matrix>::clearHistory(index level) {
 	latestIterate[level] = 0;
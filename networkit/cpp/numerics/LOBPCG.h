@@ -0,0 +1,175 @@
+/*
+ * LOBPCG.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_NUMERICS_LOBPCG_H_
+#define NETWORKIT_CPP_NUMERICS_LOBPCG_H_
+
+#include "EigenSolver.h"
+#include "../algebraic/CSRMatrix.h"
+#include "../algebraic/DenseMatrix.h"
+#include "../algebraic/GraphBLAS.h"
+#include "../auxiliary/Random.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Locally optimal block preconditioned conjugate gradient method of Knyazev (SIAM J. Sci. Comput. 2001) for a few
+ * extreme eigenpairs of a symmetric matrix. All eigenpairs are iterated as one block, so that each iteration
+ * multiplies the matrix with a dense multi-vector instead of with single vectors. The preconditioner, e.g. the
+ * IncompleteCholeskyPreconditioner or the LamgPreconditioner of a Laplacian, accelerates the computation of the
+ * smallest eigenpairs; use the IdentityPreconditioner for the largest ones.
+ */
+template<class Matrix, class Preconditioner>
+class LOBPCG : public EigenSolver<Matrix> {
+public:
+	/**
+	 * Constructs a LOBPCG solver with the given @a tolerance.
+	 * @param tolerance
+	 */
+	LOBPCG(double tolerance = 1e-8) : EigenSolver<Matrix>(tolerance) {}
+
+	void setup(const Matrix& matrix) override {
+		EigenSolver<Matrix>::setup(matrix);
+		precond = Preconditioner(matrix);
+	}
+
+	EigenSolverStatus solve(count k, SpectrumEnd which, std::vector<double>& eigenvalues, std::vector<Vector>& eigenvectors, count maxIterations = 1000) override;
+
+private:
+	Preconditioner precond;
+
+	/** Returns the matrix with the columns of @a A followed by the columns of @a B. */
+	static DenseMatrix concatenate(const DenseMatrix& A, const DenseMatrix& B);
+};
+
+template<class Matrix, class Preconditioner>
+EigenSolverStatus LOBPCG<Matrix, Preconditioner>::solve(count k, SpectrumEnd which, std::vector<double>& eigenvalues, std::vector<Vector>& eigenvectors, count maxIterations) {
+	const count n = this->matrix.numberOfRows();
+	assert(k > 0 && 3 * k <= n);
+	const double desiredResidual = this->tolerance * this->normBound;
+
+	// Rayleigh-Ritz on the orthonormal basis S with AS = A * S, X and AX become the k best Ritz vectors and P the
+	// part of them outside the span of the first numKept columns of S
+	Vector theta(k);
+	DenseMatrix X, AX, P;
+	auto rayleighRitz = [&](const DenseMatrix& S, const DenseMatrix& AS, count numKept) {
+		DenseMatrix G = DenseMatrix::mTmMultiply(S, AS);
+		for (index i = 0; i < G.numberOfRows(); ++i) {
+			for (index j = i + 1; j < G.numberOfColumns(); ++j) {
+				double value = 0.5 * (G(i,j) + G(j,i));
+				G.setValue(i, j, value);
+				G.setValue(j, i, value);
+			}
+		}
+
+		Vector values;
+		DenseMatrix vectors;
+		DenseMatrix::symmetricEigenDecomposition(G, values, vectors);
+		const count s = G.numberOfRows();
+		DenseMatrix C(s, k), CP(s, k);
+		for (index c = 0; c < k; ++c) {
+			index e = which == SMALLEST? c : s - 1 - c;
+			theta[c] = values[e];
+			for (index r = 0; r < s; ++r) {
+				C.setValue(r, c, vectors(r, e));
+				if (r >= numKept) CP.setValue(r, c, vectors(r, e));
+			}
+		}
+
+		X = S * C;
+		AX = AS * C;
+		P = S * CP;
+	};
+
+	DenseMatrix X0(n, k);
+	for (index i = 0; i < n; ++i) {
+		for (index c = 0; c < k; ++c) {
+			X0.setValue(i, c, 2.0 * Aux::Random::real() - 1.0);
+		}
+	}
+	X0 = DenseMatrix::orthonormalizeColumns(X0);
+	assert(X0.numberOfColumns() == k);
+	rayleighRitz(X0, GraphBLAS::MxMultiV(this->matrix, X0), k);
+
+	std::vector<double> norms(k);
+	count iterations = 0;
+	while (true) {
+		// residuals of the current Ritz pairs
+		DenseMatrix R = AX;
+#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+			for (index c = 0; c < k; ++c) {
+				R.setValue(i, c, AX(i, c) - theta[c] * X(i, c));
+			}
+		}
+
+		std::vector<index> active;
+		for (index c = 0; c < k; ++c) {
+			norms[c] = R.column(c).length();
+			if (norms[c] > desiredResidual) active.push_back(c);
+		}
+		if (active.empty() || iterations >= maxIterations) break;
+		++iterations;
+
+		// preconditioned residuals of the active pairs
+		DenseMatrix W(n, active.size());
+#pragma omp parallel for
+		for (omp_index a = 0; a < static_cast<omp_index>(active.size()); ++a) {
+			Vector w = precond.rhs(R.column(active[a]));
+			for (index i = 0; i < n; ++i) {
+				W.setValue(i, a, w[i]);
+			}
+		}
+
+		// extend X by the directions of W and P that are orthogonal to it
+		DenseMatrix Z = concatenate(W, P);
+		for (count pass = 0; pass < 2; ++pass) {
+			Z -= X * DenseMatrix::mTmMultiply(X, Z);
+		}
+		DenseMatrix Q = DenseMatrix::orthonormalizeColumns(Z);
+		if (Q.numberOfColumns() == 0) break; // no progress possible
+
+		rayleighRitz(concatenate(X, Q), concatenate(AX, GraphBLAS::MxMultiV(this->matrix, Q)), k);
+	}
+
+	eigenvalues.resize(k);
+	eigenvectors.resize(k);
+	EigenSolverStatus status;
+	status.numIters = iterations;
+	status.numConverged = 0;
+	status.residuals = norms;
+	for (index c = 0; c < k; ++c) {
+		eigenvalues[c] = theta[c];
+		eigenvectors[c] = X.column(c);
+		if (norms[c] <= desiredResidual) ++status.numConverged;
+	}
+	status.converged = status.numConverged == k;
+
+	return status;
+}
+
+template<class Matrix, class Preconditioner>
+DenseMatrix LOBPCG<Matrix, Preconditioner>::concatenate(const DenseMatrix& A, const DenseMatrix& B) {
+	assert(A.numberOfRows() == B.numberOfRows());
+	const count a = A.numberOfColumns();
+	DenseMatrix result(A.numberOfRows(), a + B.numberOfColumns());
+#pragma omp parallel for
+	for (omp_index i = 0; i < static_cast<omp_index>(A.numberOfRows()); ++i) {
+		for (index c = 0; c < a; ++c) {
+			result.setValue(i, c, A(i, c));
+		}
+		for (index c = 0; c < B.numberOfColumns(); ++c) {
+			result.setValue(i, a + c, B(i, c));
+		}
+	}
+
+	return result;
+}
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_NUMERICS_LOBPCG_H_ */
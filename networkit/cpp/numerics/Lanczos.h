@@ -0,0 +1,223 @@
+/*
+ * Lanczos.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_NUMERICS_LANCZOS_H_
+#define NETWORKIT_CPP_NUMERICS_LANCZOS_H_
+
+#include <numeric>
+
+#include "EigenSolver.h"
+#include "../algebraic/DenseMatrix.h"
+#include "../auxiliary/Random.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Thick-restart Lanczos method of Wu and Simon (SIAM J. Matrix Anal. Appl. 2000) for a few extreme eigenpairs of a
+ * symmetric matrix. The Krylov basis is fully reorthogonalized and, once it has reached its maximal size, restarted
+ * with the best Ritz vectors. Lanczos converges fast for well-separated eigenvalues like the largest ones of an
+ * adjacency matrix; for the clustered smallest eigenvalues of a Laplacian, the preconditioned LOBPCG is usually the
+ * better choice.
+ *
+ * Each step multiplies the matrix with a single vector. With a SellCSigmaMatrix instead of a CSRMatrix, these
+ * products run in the SIMD-friendly SELL-C-sigma format.
+ */
+template<class Matrix>
+class Lanczos : public EigenSolver<Matrix> {
+public:
+	/**
+	 * Constructs a Lanczos solver with the given @a tolerance.
+	 * @param tolerance
+	 * @param basisSize Maximal size of the Krylov basis; 0 chooses max(2k + 10, 20) for k eigenpairs.
+	 */
+	Lanczos(double tolerance = 1e-8, count basisSize = 0) : EigenSolver<Matrix>(tolerance), basisSize(basisSize) {}
+
+	/**
+	 * Computes the @a k smallest or largest eigenpairs. @a maxIterations limits the number of restart cycles.
+	 */
+	EigenSolverStatus solve(count k, SpectrumEnd which, std::vector<double>& eigenvalues, std::vector<Vector>& eigenvectors, count maxIterations = 1000) override;
+
+private:
+	count basisSize;
+
+	/**
+	 * Orthogonalizes @a w against the first @a numColumns columns of @a V with classical Gram-Schmidt twice and
+	 * returns the coefficients.
+	 */
+	static std::vector<double> orthogonalize(const DenseMatrix& V, count numColumns, Vector& w);
+
+	static Vector randomVector(count n);
+};
+
+template<class Matrix>
+EigenSolverStatus Lanczos<Matrix>::solve(count k, SpectrumEnd which, std::vector<double>& eigenvalues, std::vector<Vector>& eigenvectors, count maxIterations) {
+	const count n = this->matrix.numberOfRows();
+	assert(k > 0 && k <= n);
+	const count m = std::min(n, std::max(basisSize > 0? basisSize : std::max(2 * k + 10, (count) 20), k + 1));
+	const count keep = std::max(k, std::min(k + (m - k) / 2, m - 1)); // Ritz vectors kept on restart
+	const double desiredResidual = this->tolerance * this->normBound;
+
+	DenseMatrix V(n, m); // Krylov basis in the columns
+	DenseMatrix T(m, m); // projection of the matrix onto the basis
+	Vector r = randomVector(n);
+	r /= r.length();
+	for (index i = 0; i < n; ++i) {
+		V.setValue(i, 0, r[i]);
+	}
+
+	// positions of the wanted Ritz values in the ascending spectrum of T
+	auto wanted = [&](index i) {
+		return which == SMALLEST? i : m - 1 - i;
+	};
+
+	Vector theta;
+	DenseMatrix Y;
+	double beta = 0.0;
+	count start = 0;
+	count cycles = 0;
+	while (true) {
+		++cycles;
+		for (index j = start; j < m; ++j) {
+			Vector w = this->matrix * V.column(j);
+			std::vector<double> h = orthogonalize(V, j + 1, w);
+			for (index i = 0; i <= j; ++i) {
+				T.setValue(i, j, h[i]);
+				T.setValue(j, i, h[i]);
+			}
+
+			beta = w.length();
+			if (j + 1 < m) {
+				if (beta <= 1e-12 * this->normBound) { // invariant subspace, continue with a new direction
+					w = randomVector(n);
+					orthogonalize(V, j + 1, w);
+					w /= w.length();
+				} else {
+					w /= beta;
+				}
+#pragma omp parallel for
+				for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+					V.setValue(i, j + 1, w[i]);
+				}
+			} else {
+				r = w;
+			}
+		}
+
+		// Rayleigh-Ritz, the residual of the Ritz pair (theta_i, V y_i) is beta * |y_i[m-1]|
+		DenseMatrix::symmetricEigenDecomposition(T, theta, Y);
+		count numConverged = 0;
+		for (index i = 0; i < k; ++i) {
+			if (beta * std::abs(Y(m - 1, wanted(i))) <= desiredResidual) ++numConverged;
+		}
+		if (numConverged == k || cycles >= maxIterations || m == n) break;
+
+		// thick restart with the best Ritz vectors and the residual direction
+		std::vector<index> rows(m), columns(keep);
+		std::iota(rows.begin(), rows.end(), 0);
+		for (index i = 0; i < keep; ++i) {
+			columns[i] = wanted(i);
+		}
+		DenseMatrix ritzVectors = V * Y.extract(rows, columns);
+
+		if (beta <= 1e-12 * this->normBound) {
+			r = randomVector(n);
+			beta = 0.0;
+		}
+		r /= r.length();
+#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+			for (index c = 0; c < keep; ++c) {
+				V.setValue(i, c, ritzVectors(i, c));
+			}
+			V.setValue(i, keep, r[i]);
+		}
+		if (beta == 0.0) { // a new random direction has to be orthogonal to the Ritz vectors
+			Vector v = V.column(keep);
+			orthogonalize(V, keep, v);
+			v /= v.length();
+			for (index i = 0; i < n; ++i) {
+				V.setValue(i, keep, v[i]);
+			}
+		}
+
+		T = DenseMatrix(m, m);
+		for (index c = 0; c < keep; ++c) {
+			T.setValue(c, c, theta[wanted(c)]);
+		}
+		start = keep;
+	}
+
+	eigenvalues.resize(k);
+	eigenvectors.resize(k);
+	EigenSolverStatus status;
+	status.numIters = cycles;
+	status.numConverged = 0;
+	status.residuals.resize(k);
+	for (index i = 0; i < k; ++i) {
+		eigenvalues[i] = theta[wanted(i)];
+		eigenvectors[i] = V * Y.column(wanted(i));
+		eigenvectors[i] /= eigenvectors[i].length();
+		status.residuals[i] = this->residual(eigenvectors[i], eigenvalues[i]);
+		if (status.residuals[i] <= desiredResidual) ++status.numConverged;
+	}
+	status.converged = status.numConverged == k;
+
+	return status;
+}
+
+template<class Matrix>
+std::vector<double> Lanczos<Matrix>::orthogonalize(const DenseMatrix& V, count numColumns, Vector& w) {
+	const count n = V.numberOfRows();
+	std::vector<double> coefficients(numColumns, 0.0);
+	for (count pass = 0; pass < 2; ++pass) {
+		std::vector<double> h(numColumns, 0.0);
+#pragma omp parallel
+		{
+			std::vector<double> local(numColumns, 0.0);
+#pragma omp for
+			for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+				for (index c = 0; c < numColumns; ++c) {
+					local[c] += V(i, c) * w[i];
+				}
+			}
+
+#pragma omp critical
+			{
+				for (index c = 0; c < numColumns; ++c) {
+					h[c] += local[c];
+				}
+			}
+		}
+
+#pragma omp parallel for
+		for (omp_index i = 0; i < static_cast<omp_index>(n); ++i) {
+			for (index c = 0; c < numColumns; ++c) {
+				w[i] -= V(i, c) * h[c];
+			}
+		}
+
+		for (index c = 0; c < numColumns; ++c) {
+			coefficients[c] += h[c];
+		}
+	}
+
+	return coefficients;
+}
+
+template<class Matrix>
+Vector Lanczos<Matrix>::randomVector(count n) {
+	Vector v(n);
+	for (index i = 0; i < n; ++i) {
+		v[i] = 2.0 * Aux::Random::real() - 1.0;
+	}
+
+	return v;
+}
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_NUMERICS_LANCZOS_H_ */
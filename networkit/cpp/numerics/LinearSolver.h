@@ -11,6 +11,7 @@
 #include "../algebraic/Vector.h"
 #include "../graph/Graph.h"
 #include <limits>
+#include <vector>
 
 namespace NetworKit {
 
@@ -20,6 +21,7 @@ struct SolverStatus {
 	count numIters; // number of iterations needed during solve phase
 	double residual; // absolute final residual
 	bool converged; // flag of conversion status
+	std::vector<double> residualHistory; // absolute residual after each iteration (if tracked by the solver)
 };
 
 /**
@@ -84,6 +86,19 @@ public:
 	 * @note If the solver does not support parallelism during solves, this function falls back to solving the systems sequentially.
 	 */
 	virtual void parallelSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
+
+	/**
+	 * Computes the @a results for the matrix currently setup and the right-hand sides @a rhs, using the entries of
+	 * @a results as initial guesses. Solvers that can share work between the systems, e.g. the traversals of the
+	 * matrix in a block method, override this function.
+	 * @param rhs
+	 * @param results
+	 * @param maxConvergenceTime
+	 * @param maxIterations
+	 * @return The @ref SolverStatus of each system.
+	 * @note By default, the systems are solved one after another.
+	 */
+	virtual std::vector<SolverStatus> blockSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max());
 };
 
 template<class Matrix>
@@ -103,6 +118,17 @@ void LinearSolver<Matrix>::parallelSolve(const std::vector<Vector>& rhs, std::ve
 	}
 }
 
+template<class Matrix>
+std::vector<SolverStatus> LinearSolver<Matrix>::blockSolve(const std::vector<Vector>& rhs, std::vector<Vector>& results, count maxConvergenceTime, count maxIterations) {
+	assert(rhs.size() == results.size());
+	std::vector<SolverStatus> stati(rhs.size());
+	for (index i = 0; i < rhs.size(); ++i) {
+		stati[i] = solve(rhs[i], results[i], maxConvergenceTime, maxIterations);
+	}
+
+	return stati;
+}
+
 } /* namespace NetworKit */
 
 #endif /* LINEARSOLVER_H_ */
@@ -0,0 +1,101 @@
+/*
+ * MixedPrecisionSolver.h
+ *
+ *  Created on: 18.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_NUMERICS_MIXEDPRECISIONSOLVER_H_
+#define NETWORKIT_CPP_NUMERICS_MIXEDPRECISIONSOLVER_H_
+
+#include "LinearSolver.h"
+#include "ConjugateGradient.h"
+#include "Preconditioner/DiagonalPreconditioner.h"
+#include "../algebraic/CSRMatrix.h"
+#include "../algebraic/CompactCSRMatrix.h"
+#include "../auxiliary/Timer.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Solves linear systems by iterative refinement in mixed precision. The correction equations \f$Ad = r\f$ are
+ * solved approximately by the @a InnerSolver on a copy of the matrix in the @a LowPrecisionMatrix format, e.g.
+ * CSRMatrix32 with single precision values and 32 bit indices. The residuals \f$r = b - Ax\f$ and the solution are
+ * computed in double precision with the original matrix. Almost all products are computed by the inner solver and
+ * read half the bytes per non-zero, while the final accuracy is that of a solver in double precision.
+ */
+template<class LowPrecisionMatrix = CSRMatrix32, class InnerSolver = ConjugateGradient<CSRMatrix32, DiagonalPreconditioner>>
+class MixedPrecisionSolver : public LinearSolver<CSRMatrix> {
+public:
+	/**
+	 * Constructs a mixed precision solver.
+	 * @param tolerance Relative residual that the refined solution has to reach.
+	 * @param innerTolerance Relative residual to which the correction equations are solved (default = 1e-3).
+	 * @param maxRefinements Maximal number of refinement steps (default = 50).
+	 */
+	MixedPrecisionSolver(double tolerance = 1e-8, double innerTolerance = 1e-3, count maxRefinements = 50) : LinearSolver<CSRMatrix>(tolerance), innerTolerance(innerTolerance), maxRefinements(maxRefinements), inner(innerTolerance) {}
+
+	void setup(const CSRMatrix& matrix) override {
+		this->matrix = matrix;
+		inner = InnerSolver(innerTolerance);
+		inner.setup(LowPrecisionMatrix(matrix));
+	}
+
+	void setupConnected(const CSRMatrix& matrix) override {
+		this->matrix = matrix;
+		inner = InnerSolver(innerTolerance);
+		inner.setupConnected(LowPrecisionMatrix(matrix));
+	}
+
+	/**
+	 * Solves \f$Ax = b\f$ starting from @a result. The returned number of iterations is the total number of
+	 * iterations of the inner solver, the residual history contains the residual after each refinement step.
+	 */
+	SolverStatus solve(const Vector& rhs, Vector& result, count maxConvergenceTime = 5 * 60 * 1000, count maxIterations = std::numeric_limits<count>::max()) override;
+
+private:
+	double innerTolerance;
+	count maxRefinements;
+	CSRMatrix matrix;
+	InnerSolver inner;
+};
+
+template<class LowPrecisionMatrix, class InnerSolver>
+SolverStatus MixedPrecisionSolver<LowPrecisionMatrix, InnerSolver>::solve(const Vector& rhs, Vector& result, count maxConvergenceTime, count maxIterations) {
+	assert(matrix.numberOfRows() == rhs.getDimension() && rhs.getDimension() == result.getDimension());
+	Aux::Timer timer;
+	timer.start();
+
+	const double desiredResidual = this->tolerance * rhs.length();
+	Vector residual = rhs - matrix * result;
+	double residualNorm = residual.length();
+
+	SolverStatus status;
+	status.numIters = 0;
+	status.residualHistory.push_back(residualNorm);
+	for (count step = 0; step < maxRefinements && residualNorm > desiredResidual; ++step) {
+		count elapsed = timer.elapsedMilliseconds();
+		if (elapsed >= maxConvergenceTime || status.numIters >= maxIterations) break;
+
+		// correction from the low precision system, the residual is updated in double precision
+		Vector correction(result.getDimension(), 0.0);
+		SolverStatus innerStatus = inner.solve(residual, correction, maxConvergenceTime - elapsed, maxIterations - status.numIters);
+		status.numIters += innerStatus.numIters;
+		result += correction;
+		residual = rhs - matrix * result;
+
+		double previousNorm = residualNorm;
+		residualNorm = residual.length();
+		status.residualHistory.push_back(residualNorm);
+		if (residualNorm >= previousNorm) break; // the refinement stagnates
+	}
+
+	status.residual = residualNorm;
+	status.converged = residualNorm <= desiredResidual;
+
+	return status;
+}
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_NUMERICS_MIXEDPRECISIONSOLVER_H_ */
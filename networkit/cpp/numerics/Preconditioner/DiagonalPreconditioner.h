@@ -26,7 +26,8 @@ public:
 	 * Constructs a diagonal preconditioner for the matrix @a A.
 	 * @param A
 	 */
-	DiagonalPreconditioner(const CSRMatrix& A) : inv_diag(A.numberOfRows()) {
+	template<class Matrix>
+	DiagonalPreconditioner(const Matrix& A) : inv_diag(A.numberOfRows()) {
 		assert(A.numberOfColumns() == A.numberOfRows());
 
 		// Diagonal preconditioner just needs to store the inverse diagonal of A
@@ -22,7 +22,8 @@ public:
 	 * Constructs an identity preconditioner for the matrix @a A.
 	 * @param A
 	 */
-	IdentityPreconditioner(const CSRMatrix &matrix)  {}
+	template<class Matrix>
+	IdentityPreconditioner(const Matrix &matrix)  {}
 	virtual ~IdentityPreconditioner() = default;
 
 	/**
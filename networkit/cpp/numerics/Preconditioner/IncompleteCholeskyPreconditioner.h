@@ -0,0 +1,143 @@
+/*
+ * IncompleteCholeskyPreconditioner.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_NUMERICS_PRECONDITIONER_INCOMPLETECHOLESKYPRECONDITIONER_H_
+#define NETWORKIT_CPP_NUMERICS_PRECONDITIONER_INCOMPLETECHOLESKYPRECONDITIONER_H_
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "../../algebraic/CSRMatrix.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Preconditioner that approximates the symmetric positive (semi-)definite matrix A by L * L^T, where L is the
+ * incomplete Cholesky factor of A without fill-in, i.e. L has the sparsity pattern of the lower triangle of A.
+ * If the factorization breaks down, which happens for singular matrices like Laplacians, the diagonal of A is
+ * increased by a growing multiple of itself until the factorization succeeds.
+ */
+class IncompleteCholeskyPreconditioner {
+public:
+	/** Default constructor */
+	IncompleteCholeskyPreconditioner() = default;
+
+	/**
+	 * Computes the incomplete Cholesky factorization of the symmetric matrix @a A.
+	 * @param A
+	 */
+	IncompleteCholeskyPreconditioner(const CSRMatrix& A) {
+		assert(A.numberOfRows() == A.numberOfColumns());
+		for (shift = 0.0; !factorize(A, shift); shift = (shift == 0.0)? 1e-3 : 2 * shift) {
+			if (shift > 1e3) {
+				throw std::runtime_error("Incomplete Cholesky factorization failed, the matrix is not positive semidefinite");
+			}
+		}
+	}
+
+	virtual ~IncompleteCholeskyPreconditioner() = default;
+
+	/**
+	 * Returns the preconditioned right-hand-side \f$P(b) = L^{-T} L^{-1} b\f$.
+	 */
+	Vector rhs(const Vector& b) const {
+		assert(b.getDimension() == diag.size());
+		const count n = diag.size();
+		Vector x(n);
+		for (index i = 0; i < n; ++i) { // forward substitution with L
+			double value = b[i];
+			for (index k = rowIdx[i]; k < rowIdx[i+1]; ++k) {
+				value -= values[k] * x[columnIdx[k]];
+			}
+			x[i] = value / diag[i];
+		}
+
+		for (index i = n; i-- > 0;) { // backward substitution with L^T
+			x[i] /= diag[i];
+			for (index k = rowIdx[i]; k < rowIdx[i+1]; ++k) {
+				x[columnIdx[k]] -= values[k] * x[i];
+			}
+		}
+
+		return x;
+	}
+
+	/**
+	 * @return The multiple of the diagonal that has been added to the matrix to complete the factorization.
+	 */
+	double getShift() const {
+		return shift;
+	}
+
+private:
+	// strictly lower triangle of L in CSR format with sorted rows, the diagonal is stored separately
+	std::vector<index> rowIdx;
+	std::vector<index> columnIdx;
+	std::vector<double> values;
+	std::vector<double> diag;
+	double shift = 0.0;
+
+	bool factorize(const CSRMatrix& A, double shift) {
+		const count n = A.numberOfRows();
+		rowIdx.assign(n+1, 0);
+		columnIdx.clear();
+		values.clear();
+		diag.assign(n, 0.0);
+
+		std::vector<std::pair<index, double>> row;
+		for (index i = 0; i < n; ++i) {
+			row.clear();
+			double aii = 0.0;
+			A.forNonZeroElementsInRow(i, [&](index j, double value) {
+				if (j < i) {
+					row.emplace_back(j, value);
+				} else if (j == i) {
+					aii = value;
+				}
+			});
+			std::sort(row.begin(), row.end());
+
+			// L_ij = (A_ij - sum_{k < j} L_ik L_jk) / L_jj for all j < i in the pattern of A
+			double sumOfSquares = 0.0;
+			for (index p = 0; p < row.size(); ++p) {
+				index j = row[p].first;
+				double value = row[p].second;
+				index q = rowIdx[j];
+				for (index r = 0; r < p && q < rowIdx[j+1]; ++r) { // sparse dot product of the rows i and j of L
+					while (q < rowIdx[j+1] && columnIdx[q] < row[r].first) ++q;
+					if (q < rowIdx[j+1] && columnIdx[q] == row[r].first) {
+						value -= row[r].second * values[q];
+					}
+				}
+				row[p].second = value / diag[j];
+				sumOfSquares += row[p].second * row[p].second;
+			}
+
+			double pivot = (1.0 + shift) * aii - sumOfSquares;
+			if (aii == 0.0 && row.empty()) { // empty row, e.g. of an isolated node
+				pivot = 1.0;
+			} else if (!(pivot > 1e-8 * std::abs(aii))) {
+				return false;
+			}
+			diag[i] = std::sqrt(pivot);
+
+			for (const auto& entry : row) {
+				columnIdx.push_back(entry.first);
+				values.push_back(entry.second);
+			}
+			rowIdx[i+1] = columnIdx.size();
+		}
+
+		return true;
+	}
+};
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_NUMERICS_PRECONDITIONER_INCOMPLETECHOLESKYPRECONDITIONER_H_ */
@@ -0,0 +1,72 @@
+/*
+ * LamgPreconditioner.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef NETWORKIT_CPP_NUMERICS_PRECONDITIONER_LAMGPRECONDITIONER_H_
+#define NETWORKIT_CPP_NUMERICS_PRECONDITIONER_LAMGPRECONDITIONER_H_
+
+#include <memory>
+#include "../../algebraic/CSRMatrix.h"
+#include "../LAMG/MultiLevelSetup.h"
+#include "../LAMG/SolverLamg.h"
+#include "../GaussSeidelRelaxation.h"
+
+namespace NetworKit {
+
+/**
+ * @ingroup numerics
+ * Preconditioner that applies LAMG multigrid cycles to the right-hand side. The matrix has to be the Laplacian
+ * matrix of a connected graph. Since a cycle is not exactly a linear operator, the preconditioner is best combined
+ * with a flexible Krylov method like ConjugateGradient.
+ */
+class LamgPreconditioner {
+public:
+	/** Default constructor */
+	LamgPreconditioner() : numCycles(1) {}
+
+	/**
+	 * Computes the multigrid hierarchy for the Laplacian matrix @a A.
+	 * @param A
+	 * @param numCycles Number of cycles per application (default = 1).
+	 */
+	LamgPreconditioner(const CSRMatrix& A, count numCycles = 1) : hierarchy(std::make_shared<LevelHierarchy<CSRMatrix>>()), numCycles(numCycles) {
+		MultiLevelSetup<CSRMatrix> setup(smoother);
+		setup.setup(A, *hierarchy);
+	}
+
+	/**
+	 * Uses the precomputed @a hierarchy, e.g. the one of an Lamg solver.
+	 * @param hierarchy
+	 * @param numCycles Number of cycles per application (default = 1).
+	 */
+	LamgPreconditioner(const LevelHierarchy<CSRMatrix>& hierarchy, count numCycles = 1) : hierarchy(std::make_shared<LevelHierarchy<CSRMatrix>>(hierarchy)), numCycles(numCycles) {}
+
+	virtual ~LamgPreconditioner() = default;
+
+	/**
+	 * Returns the approximate solution of \f$Ax = b\f$ after the cycles, starting from \f$x = 0\f$. The method may
+	 * be called concurrently.
+	 */
+	Vector rhs(const Vector& b) const {
+		assert(hierarchy && b.getDimension() == hierarchy->at(0).getNumberOfNodes());
+		SolverLamg<CSRMatrix> solver(*hierarchy, smoother);
+		LAMGSolverStatus status;
+		status.maxIters = numCycles;
+		status.desiredResidualReduction = 0.0;
+		Vector x(b.getDimension(), 0.0);
+		solver.solve(x, b, status);
+		return x;
+	}
+
+private:
+	// shared between copies, the hierarchy is only read during the cycles
+	std::shared_ptr<LevelHierarchy<CSRMatrix>> hierarchy;
+	GaussSeidelRelaxation<CSRMatrix> smoother;
+	count numCycles;
+};
+
+} /* namespace NetworKit */
+
+#endif /* NETWORKIT_CPP_NUMERICS_PRECONDITIONER_LAMGPRECONDITIONER_H_ */
@@ -0,0 +1,159 @@
+/*
+ * ConjugateGradientGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include "../ConjugateGradient.h"
+#include "../MixedPrecisionSolver.h"
+#include "../Preconditioner/IdentityPreconditioner.h"
+#include "../Preconditioner/DiagonalPreconditioner.h"
+#include "../Preconditioner/IncompleteCholeskyPreconditioner.h"
+#include "../Preconditioner/LamgPreconditioner.h"
+#include "../../algebraic/CSRMatrix.h"
+#include "../../io/METISGraphReader.h"
+
+#include <random>
+
+namespace NetworKit {
+
+class ConjugateGradientGTest : public testing::Test {
+protected:
+	/** Random right-hand side of a connected graph whose entries sum up to zero. */
+	Vector randZeroSum(count n, size_t seed) const {
+		std::mt19937 rand(seed);
+		std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+		Vector b(n);
+		double sum = 0.0;
+		for (index i = 0; i < n; ++i) {
+			b[i] = distribution(rand);
+			sum += b[i];
+		}
+		b[0] -= sum;
+		return b;
+	}
+
+	double relativeResidual(const CSRMatrix& A, const Vector& x, const Vector& b) const {
+		return (A * x - b).length() / b.length();
+	}
+};
+
+TEST_F(ConjugateGradientGTest, testPreconditioners) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	Vector b = randZeroSum(G.numberOfNodes(), 42);
+
+	ConjugateGradient<CSRMatrix, IdentityPreconditioner> identityCG(1e-6);
+	identityCG.setup(L);
+	Vector x(G.numberOfNodes(), 0.0);
+	SolverStatus identityStatus = identityCG.solve(b, x);
+	EXPECT_TRUE(identityStatus.converged);
+	EXPECT_LE(relativeResidual(L, x, b), 1e-6);
+	EXPECT_EQ(identityStatus.numIters + 1, identityStatus.residualHistory.size());
+	EXPECT_NEAR(identityStatus.residual, identityStatus.residualHistory.back(), 1e-6 * identityStatus.residual);
+
+	ConjugateGradient<CSRMatrix, DiagonalPreconditioner> diagonalCG(1e-6);
+	diagonalCG.setup(L);
+	x = Vector(G.numberOfNodes(), 0.0);
+	SolverStatus diagonalStatus = diagonalCG.solve(b, x);
+	EXPECT_TRUE(diagonalStatus.converged);
+	EXPECT_LE(relativeResidual(L, x, b), 1e-6);
+
+	ConjugateGradient<CSRMatrix, IncompleteCholeskyPreconditioner> icCG(1e-6);
+	icCG.setup(L);
+	x = Vector(G.numberOfNodes(), 0.0);
+	SolverStatus icStatus = icCG.solve(b, x);
+	EXPECT_TRUE(icStatus.converged);
+	EXPECT_LE(relativeResidual(L, x, b), 1e-6);
+	EXPECT_LT(icStatus.numIters, identityStatus.numIters);
+
+	ConjugateGradient<CSRMatrix, LamgPreconditioner> lamgCG(1e-6);
+	lamgCG.setup(L);
+	x = Vector(G.numberOfNodes(), 0.0);
+	SolverStatus lamgStatus = lamgCG.solve(b, x);
+	EXPECT_TRUE(lamgStatus.converged);
+	EXPECT_LE(relativeResidual(L, x, b), 1e-6);
+	EXPECT_LT(lamgStatus.numIters, icStatus.numIters);
+}
+
+TEST_F(ConjugateGradientGTest, testBlockSolve) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	const count k = 20;
+
+	std::vector<Vector> rhs(k);
+	for (index i = 0; i < k; ++i) {
+		rhs[i] = randZeroSum(G.numberOfNodes(), i);
+	}
+	rhs[k-1] = rhs[0] + rhs[1]; // linearly dependent right-hand sides must not break the block iteration
+
+	ConjugateGradient<CSRMatrix, DiagonalPreconditioner> cg(1e-6, 8);
+	cg.setup(L);
+	std::vector<Vector> results(k, Vector(G.numberOfNodes(), 0.0));
+	std::vector<SolverStatus> stati = cg.blockSolve(rhs, results);
+	ASSERT_EQ(k, stati.size());
+
+	count maxIters = 0;
+	for (index i = 0; i < k; ++i) {
+		EXPECT_TRUE(stati[i].converged);
+		EXPECT_LE(relativeResidual(L, results[i], rhs[i]), 1e-6);
+		maxIters = std::max(maxIters, stati[i].numIters);
+	}
+
+	// the shared search space needs fewer iterations than solving the systems one by one
+	Vector x(G.numberOfNodes(), 0.0);
+	SolverStatus single = cg.solve(rhs[0], x);
+	EXPECT_LT(maxIters, single.numIters);
+	EXPECT_LE((x - results[0]).length(), 1e-3 * x.length());
+}
+
+TEST_F(ConjugateGradientGTest, testBlockSolveWithLamgPreconditioner) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	const count k = 5;
+
+	std::vector<Vector> rhs(k);
+	for (index i = 0; i < k; ++i) {
+		rhs[i] = randZeroSum(G.numberOfNodes(), 100 + i);
+	}
+
+	ConjugateGradient<CSRMatrix, LamgPreconditioner> cg(1e-8, 4);
+	cg.setup(L);
+	std::vector<Vector> results(k, Vector(G.numberOfNodes(), 0.0));
+	std::vector<SolverStatus> stati = cg.blockSolve(rhs, results);
+	for (index i = 0; i < k; ++i) {
+		EXPECT_TRUE(stati[i].converged);
+		EXPECT_LE(relativeResidual(L, results[i], rhs[i]), 1e-8);
+		EXPECT_FALSE(stati[i].residualHistory.empty());
+	}
+}
+
+TEST_F(ConjugateGradientGTest, testMixedPrecisionSolver) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	Vector b = randZeroSum(G.numberOfNodes(), 4711);
+
+	// single precision alone cannot reach the tolerance, the refinement in double precision can
+	MixedPrecisionSolver<> solver(1e-10);
+	solver.setupConnected(L);
+	Vector x(G.numberOfNodes(), 0.0);
+	SolverStatus status = solver.solve(b, x);
+	EXPECT_TRUE(status.converged);
+	EXPECT_LE(relativeResidual(L, x, b), 1e-10);
+	EXPECT_GT(status.residualHistory.size(), 2u);
+	EXPECT_DOUBLE_EQ(status.residual, status.residualHistory.back());
+
+	ConjugateGradient<CSRMatrix32, DiagonalPreconditioner> singleCG(1e-10);
+	singleCG.setup(CSRMatrix32(L));
+	Vector y(G.numberOfNodes(), 0.0);
+	singleCG.solve(b, y, 5 * 60 * 1000, 2000);
+	EXPECT_GT(relativeResidual(L, y, b), relativeResidual(L, x, b));
+}
+
+} /* namespace NetworKit */
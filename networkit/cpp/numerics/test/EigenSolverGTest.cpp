@@ -0,0 +1,122 @@
+/*
+ * EigenSolverGTest.cpp
+ *
+ *  Created on: 18.10.2026
+ */
+
+#include <gtest/gtest.h>
+
+#include "../Lanczos.h"
+#include "../LOBPCG.h"
+#include "../Preconditioner/IdentityPreconditioner.h"
+#include "../Preconditioner/IncompleteCholeskyPreconditioner.h"
+#include "../../algebraic/CSRMatrix.h"
+#include "../../algebraic/DenseMatrix.h"
+#include "../../algebraic/SellCSigmaMatrix.h"
+#include "../../io/METISGraphReader.h"
+
+namespace NetworKit {
+
+class EigenSolverGTest : public testing::Test {
+protected:
+	/** Compares the computed eigenpairs with the complete spectrum of @a A. */
+	void checkEigenpairs(const CSRMatrix& A, SpectrumEnd which, const std::vector<double>& eigenvalues, const std::vector<Vector>& eigenvectors, const EigenSolverStatus& status) const {
+		DenseMatrix dense(A.numberOfRows(), A.numberOfColumns());
+		A.forNonZeroElementsInRowOrder([&](index i, index j, double value) {
+			dense.setValue(i, j, value);
+		});
+		Vector spectrum;
+		DenseMatrix vectors;
+		DenseMatrix::symmetricEigenDecomposition(dense, spectrum, vectors);
+
+		EXPECT_TRUE(status.converged);
+		const count n = spectrum.getDimension();
+		for (index i = 0; i < eigenvalues.size(); ++i) {
+			EXPECT_NEAR(which == SMALLEST? spectrum[i] : spectrum[n - 1 - i], eigenvalues[i], 1e-6);
+			EXPECT_NEAR(1.0, eigenvectors[i].length(), 1e-8);
+			EXPECT_LE((A * eigenvectors[i] - eigenvalues[i] * eigenvectors[i]).length(), 1e-5);
+			for (index j = 0; j < i; ++j) {
+				EXPECT_NEAR(0.0, Vector::innerProduct(eigenvectors[i], eigenvectors[j]), 1e-6);
+			}
+		}
+	}
+};
+
+TEST_F(EigenSolverGTest, testLanczos) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	std::vector<double> eigenvalues;
+	std::vector<Vector> eigenvectors;
+
+	CSRMatrix A = CSRMatrix::adjacencyMatrix(G);
+	Lanczos<CSRMatrix> lanczos(1e-9);
+	lanczos.setup(A);
+	EigenSolverStatus status = lanczos.solve(6, LARGEST, eigenvalues, eigenvectors);
+	checkEigenpairs(A, LARGEST, eigenvalues, eigenvectors, status);
+
+	// a small basis forces several restarts
+	CSRMatrix L = CSRMatrix::normalizedLaplacianMatrix(G);
+	Lanczos<CSRMatrix> restarted(1e-9, 12);
+	restarted.setup(L);
+	status = restarted.solve(4, SMALLEST, eigenvalues, eigenvectors);
+	EXPECT_GT(status.numIters, 1u);
+	checkEigenpairs(L, SMALLEST, eigenvalues, eigenvectors, status);
+
+	Lanczos<SellCSigmaMatrix> sell(1e-9);
+	sell.setup(SellCSigmaMatrix(A));
+	status = sell.solve(6, LARGEST, eigenvalues, eigenvectors);
+	checkEigenpairs(A, LARGEST, eigenvalues, eigenvectors, status);
+}
+
+TEST_F(EigenSolverGTest, testLOBPCG) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/jazz.graph");
+	std::vector<double> eigenvalues;
+	std::vector<Vector> eigenvectors;
+
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	LOBPCG<CSRMatrix, IdentityPreconditioner> lobpcg(1e-9);
+	lobpcg.setup(L);
+	EigenSolverStatus status = lobpcg.solve(5, SMALLEST, eigenvalues, eigenvectors);
+	checkEigenpairs(L, SMALLEST, eigenvalues, eigenvectors, status);
+
+	LOBPCG<CSRMatrix, IncompleteCholeskyPreconditioner> preconditioned(1e-9);
+	preconditioned.setup(L);
+	EigenSolverStatus preconditionedStatus = preconditioned.solve(5, SMALLEST, eigenvalues, eigenvectors);
+	checkEigenpairs(L, SMALLEST, eigenvalues, eigenvectors, preconditionedStatus);
+	EXPECT_LE(preconditionedStatus.numIters, status.numIters);
+
+	status = lobpcg.solve(3, LARGEST, eigenvalues, eigenvectors);
+	checkEigenpairs(L, LARGEST, eigenvalues, eigenvectors, status);
+}
+
+TEST_F(EigenSolverGTest, testFiedlerVector) {
+	// two cliques connected by a single edge are separated by the signs of the Fiedler vector
+	count cliqueSize = 20;
+	Graph G(2 * cliqueSize);
+	for (node u = 0; u < cliqueSize; ++u) {
+		for (node v = u + 1; v < cliqueSize; ++v) {
+			G.addEdge(u, v);
+			G.addEdge(cliqueSize + u, cliqueSize + v);
+		}
+	}
+	G.addEdge(0, cliqueSize);
+
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	LOBPCG<CSRMatrix, IncompleteCholeskyPreconditioner> lobpcg(1e-10);
+	lobpcg.setup(L);
+	std::vector<double> eigenvalues;
+	std::vector<Vector> eigenvectors;
+	EigenSolverStatus status = lobpcg.solve(2, SMALLEST, eigenvalues, eigenvectors);
+	EXPECT_TRUE(status.converged);
+	EXPECT_NEAR(0.0, eigenvalues[0], 1e-8);
+	EXPECT_GT(eigenvalues[1], 1e-3);
+
+	const Vector& fiedler = eigenvectors[1];
+	for (node u = 0; u < cliqueSize; ++u) {
+		EXPECT_GT(fiedler[u] * fiedler[0], 0.0);
+		EXPECT_LT(fiedler[cliqueSize + u] * fiedler[0], 0.0);
+	}
+}
+
+} /* namespace NetworKit */
@@ -16,12 +16,20 @@
 
 #include "../LAMG/MultiLevelSetup.h"
 #include "../LAMG/SolverLamg.h"
+#include "../LAMG/Lamg.h"
 #include "../../io/LineFileReader.h"
 #include "../../auxiliary/Timer.h"
 #include "../../algebraic/CSRMatrix.h"
 
 #include "../GaussSeidelRelaxation.h"
 
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+
 namespace NetworKit {
 
 class LAMGGTest : public testing::Test {
@@ -39,7 +47,7 @@ TEST_F(LAMGGTest, testSmallGraphs) {
 	MultiLevelSetup<CSRMatrix> setup(gaussSmoother);
 	Aux::Timer timer;
 	for (index i = 0; i < GRAPH_INSTANCES.size(); ++i) {
-		string graph = GRAPH_INSTANCES[i];
+		std::string graph = GRAPH_INSTANCES[i];
 		Graph G = reader.read(graph);
 		ConnectedComponents con(G);
 		con.run();
@@ -84,6 +92,131 @@ TEST_F(LAMGGTest, testSmallGraphs) {
 }
 
 
+TEST_F(LAMGGTest, testHierarchyPersistence) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	GaussSeidelRelaxation<CSRMatrix> smoother;
+	MultiLevelSetup<CSRMatrix> setup(smoother);
+
+	LevelHierarchy<CSRMatrix> hierarchy;
+	setup.setup(L, hierarchy);
+	EXPECT_EQ(LevelHierarchy<CSRMatrix>::fingerprint(L), hierarchy.getFingerprint());
+
+	std::stringstream stream;
+	hierarchy.write(stream);
+	LevelHierarchy<CSRMatrix> restored;
+	restored.read(stream);
+
+	ASSERT_EQ(hierarchy.size(), restored.size());
+	EXPECT_EQ(hierarchy.getFingerprint(), restored.getFingerprint());
+	for (index l = 0; l < hierarchy.size(); ++l) {
+		EXPECT_EQ(hierarchy.getType(l), restored.getType(l));
+		EXPECT_TRUE(hierarchy.at(l).getLaplacian() == restored.at(l).getLaplacian());
+	}
+
+	// both hierarchies yield the same solution
+	Vector b = randZeroSum(G, 12345);
+	std::vector<Vector> results(2, Vector(G.numberOfNodes(), 0.0));
+	std::vector<LevelHierarchy<CSRMatrix>*> hierarchies = {&hierarchy, &restored};
+	for (index k = 0; k < 2; ++k) {
+		SolverLamg<CSRMatrix> solver(*hierarchies[k], smoother);
+		LAMGSolverStatus status;
+		status.desiredResidualReduction = 1e-6;
+		solver.solve(results[k], b, status);
+		EXPECT_TRUE(status.converged);
+	}
+	for (index i = 0; i < G.numberOfNodes(); ++i) {
+		EXPECT_DOUBLE_EQ(results[0][i], results[1][i]);
+	}
+
+	// a solver can be set up with a stored hierarchy, but only for the matching Laplacian
+	Lamg<CSRMatrix> lamg(1e-6);
+	lamg.setupConnected(L, restored);
+	Vector x(G.numberOfNodes(), 0.0);
+	EXPECT_TRUE(lamg.solve(b, x).converged);
+	EXPECT_THROW(lamg.setupConnected(CSRMatrix::laplacianMatrix(reader.read("input/jazz.graph")), restored), std::runtime_error);
+
+	std::stringstream garbage("no hierarchy");
+	EXPECT_THROW(restored.read(garbage), std::runtime_error);
+
+	// a corrupt size of the row array of the finest Laplacian, the row array that does not fit its number of rows
+	// and a truncated stream are detected
+	std::string data = stream.str();
+	const size_t rowIdxSize = 5 * sizeof(uint64_t);
+	for (uint64_t size : {std::numeric_limits<uint64_t>::max() / 16, static_cast<uint64_t>(G.numberOfNodes())}) {
+		std::string corrupt = data;
+		std::memcpy(&corrupt[rowIdxSize], &size, sizeof(size));
+		std::stringstream corruptStream(corrupt);
+		EXPECT_THROW(restored.read(corruptStream), std::runtime_error);
+	}
+	for (double fraction : {0.5, 0.9, 0.999}) {
+		std::stringstream truncated(data.substr(0, data.size() * fraction));
+		EXPECT_THROW(restored.read(truncated), std::runtime_error);
+	}
+
+	// a failed read leaves the hierarchy unchanged
+	ASSERT_EQ(hierarchy.size(), restored.size());
+	for (index l = 0; l < hierarchy.size(); ++l) {
+		EXPECT_EQ(hierarchy.getType(l), restored.getType(l));
+	}
+}
+
+TEST_F(LAMGGTest, testHierarchyCache) {
+	METISGraphReader reader;
+	Graph G = reader.read("input/PGPgiantcompo.graph");
+	CSRMatrix L = CSRMatrix::laplacianMatrix(G);
+	char name[32];
+	std::snprintf(name, sizeof(name), "%016llx.lamg", static_cast<unsigned long long>(LevelHierarchy<CSRMatrix>::fingerprint(L)));
+	std::string path = std::string("output/") + name;
+	std::remove(path.c_str());
+
+	Lamg<CSRMatrix>::setHierarchyCacheDirectory("output");
+	Lamg<CSRMatrix> first(1e-6);
+	first.setupConnected(L);
+	EXPECT_TRUE(std::ifstream(path).good());
+
+	// the second solver loads the hierarchy of the first one
+	Lamg<CSRMatrix> second(1e-6);
+	second.setupConnected(L);
+	Lamg<CSRMatrix>::setHierarchyCacheDirectory("");
+	EXPECT_EQ(first.getHierarchy().getFingerprint(), second.getHierarchy().getFingerprint());
+
+	Vector b = randZeroSum(G, 4711);
+	Vector x(G.numberOfNodes(), 0.0);
+	EXPECT_TRUE(second.solve(b, x).converged);
+
+	// a cache file that is cut after its first levels is recomputed and replaced, the levels that could be read are
+	// not mixed into the new hierarchy
+	std::string data;
+	{
+		std::ifstream is(path, std::ios::binary);
+		data.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+	}
+	for (double fraction : {0.5, 0.9, 0.99, 0.999}) {
+		{
+			std::ofstream os(path, std::ios::trunc | std::ios::binary);
+			os.write(data.data(), data.size() * fraction);
+		}
+		Lamg<CSRMatrix>::setHierarchyCacheDirectory("output");
+		Lamg<CSRMatrix> third(1e-6);
+		third.setupConnected(L);
+		Lamg<CSRMatrix>::setHierarchyCacheDirectory("");
+		LevelHierarchy<CSRMatrix> fresh;
+		GaussSeidelRelaxation<CSRMatrix> smoother;
+		MultiLevelSetup<CSRMatrix>(smoother).setup(L, fresh);
+		EXPECT_LE(third.getHierarchy().size(), fresh.size() + 1);
+		x = Vector(G.numberOfNodes(), 0.0);
+		EXPECT_TRUE(third.solve(b, x).converged);
+
+		LevelHierarchy<CSRMatrix> replaced;
+		replaced.load(path);
+		EXPECT_EQ(LevelHierarchy<CSRMatrix>::fingerprint(L), replaced.getFingerprint());
+		EXPECT_EQ(third.getHierarchy().size(), replaced.size());
+	}
+	std::remove(path.c_str());
+}
+
 
 Vector LAMGGTest::randVector(count dimension, double lower, double upper) const {
 	Vector randVector(dimension);
@@ -101,8 +234,8 @@ Vector LAMGGTest::randVector(count dimension, double lower, double upper) const
 
 
 Vector LAMGGTest::randZeroSum(const Graph& G, size_t seed) const {
-	mt19937 rand(seed);
-	auto rand_value = uniform_real_distribution<double>(-1.0, 1.0);
+	std::mt19937 rand(seed);
+	auto rand_value = std::uniform_real_distribution<double>(-1.0, 1.0);
 	ConnectedComponents con(G);
 	count n = G.numberOfNodes();
 	con.run();
@@ -0,0 +1,370 @@
+/*
+ * EdgeSwitching.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <omp.h>
+#include <sstream>
+
+#include "../auxiliary/Parallel.h"
+#include "../auxiliary/Random.h"
+#include "../auxiliary/SignalHandling.h"
+#include "../graph/GraphBuilder.h"
+
+#include "EdgeSwitching.h"
+
+namespace NetworKit {
+
+namespace {
+
+using NodePair = std::pair<node, node>;
+
+//! Loops over fewer elements are not worth the overhead of a parallel region
+constexpr count minParallelSize = 4096;
+
+inline uint64_t mixBits(uint64_t key) {
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+}
+
+inline count tableSizeFor(count numKeys) {
+    count size = 16;
+    while (size < 2 * numKeys)
+        size *= 2;
+    return size;
+}
+
+/**
+ * Open addressing hash set of edge keys with linear probing. Erased keys leave
+ * tombstones that are reused by later insertions.
+ *
+ * contains() may be called concurrently with other calls of contains(). insert()
+ * and erase() may be called concurrently, also mixed with each other, as long as
+ * the threads work on distinct keys: insert() only turns an empty slot or a
+ * tombstone into a key, and erase() only turns a key into a tombstone. A slot
+ * never becomes empty again, so no probe sequence of another key is cut short.
+ */
+class ConcurrentEdgeSet {
+public:
+    explicit ConcurrentEdgeSet(count maxKeys) :
+        slots(tableSizeFor(maxKeys)), mask(slots.size() - 1), tombstones(0) {
+        clear();
+    }
+
+    void clear() {
+        #pragma omp parallel for if(slots.size() >= minParallelSize)
+        for (omp_index i = 0; i < static_cast<omp_index>(slots.size()); ++i)
+            slots[i].store(emptyKey, std::memory_order_relaxed);
+        tombstones.store(0, std::memory_order_relaxed);
+    }
+
+    bool contains(uint64_t key) const {
+        for (index i = mixBits(key) & mask; ; i = (i + 1) & mask) {
+            const uint64_t slot = slots[i].load(std::memory_order_relaxed);
+            if (slot == key) return true;
+            if (slot == emptyKey) return false;
+        }
+    }
+
+    // key must not be contained
+    void insert(uint64_t key) {
+        for (index i = mixBits(key) & mask; ; i = (i + 1) & mask) {
+            uint64_t slot = slots[i].load(std::memory_order_relaxed);
+            while (slot == emptyKey || slot == tombstoneKey) {
+                const bool wasTombstone = (slot == tombstoneKey);
+                if (slots[i].compare_exchange_weak(slot, key, std::memory_order_relaxed)) {
+                    if (wasTombstone)
+                        tombstones.fetch_sub(1, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        }
+    }
+
+    // key must be contained
+    void erase(uint64_t key) {
+        for (index i = mixBits(key) & mask; ; i = (i + 1) & mask) {
+            if (slots[i].load(std::memory_order_relaxed) == key) {
+                slots[i].store(tombstoneKey, std::memory_order_relaxed);
+                tombstones.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    bool needsRebuild() const {
+        return 4 * tombstones.load(std::memory_order_relaxed) > slots.size();
+    }
+
+private:
+    static constexpr uint64_t emptyKey = std::numeric_limits<uint64_t>::max();
+    static constexpr uint64_t tombstoneKey = emptyKey - 1;
+
+    std::vector<std::atomic<uint64_t> > slots;
+    const uint64_t mask;
+    std::atomic<count> tombstones;
+};
+
+/**
+ * Concurrent map from edge keys to the smallest switch index that wants to create the edge.
+ */
+class ConcurrentClaimMap {
+public:
+    explicit ConcurrentClaimMap(count maxKeys) :
+        keys(tableSizeFor(maxKeys)), owners(keys.size()), mask(keys.size() - 1) {
+        clear();
+    }
+
+    void clear() {
+        #pragma omp parallel for if(keys.size() >= minParallelSize)
+        for (omp_index i = 0; i < static_cast<omp_index>(keys.size()); ++i) {
+            keys[i].store(emptyKey, std::memory_order_relaxed);
+            owners[i].store(none, std::memory_order_relaxed);
+        }
+    }
+
+    void claim(uint64_t key, index owner) {
+        for (index i = mixBits(key) & mask; ; i = (i + 1) & mask) {
+            uint64_t slot = keys[i].load(std::memory_order_relaxed);
+            if (slot == emptyKey)
+                keys[i].compare_exchange_strong(slot, key, std::memory_order_relaxed);
+            // on failure, slot contains the key of the concurrent claim
+            if (slot == emptyKey || slot == key) {
+                Aux::Parallel::atomic_min(owners[i], owner);
+                return;
+            }
+        }
+    }
+
+    index ownerOf(uint64_t key) const {
+        for (index i = mixBits(key) & mask; ; i = (i + 1) & mask) {
+            const uint64_t slot = keys[i].load(std::memory_order_relaxed);
+            if (slot == key) return owners[i].load(std::memory_order_relaxed);
+            if (slot == emptyKey) return none;
+        }
+    }
+
+private:
+    static constexpr uint64_t emptyKey = std::numeric_limits<uint64_t>::max();
+
+    std::vector<std::atomic<uint64_t> > keys;
+    std::vector<std::atomic<index> > owners;
+    const uint64_t mask;
+};
+
+struct SwitchRecord {
+    index e1, e2;
+    NodePair new1, new2;
+    bool candidate;
+};
+
+} // namespace
+
+EdgeSwitching::EdgeSwitching(const Graph &G, double numberOfSwitchesPerEdge) :
+    numNodes(G.upperNodeIdBound()), numberOfSwitchesPerEdge(numberOfSwitchesPerEdge),
+    batchSize(0), hasSeed(false), seed(0), attemptedSwitches(0), performedSwitches(0) {
+    if (G.isDirected()) {
+        throw std::runtime_error("EdgeSwitching supports only undirected graphs");
+    }
+
+    if (G.numberOfSelfLoops() > 0) {
+        throw std::runtime_error("EdgeSwitching supports only graphs without self-loops");
+    }
+
+    if (numNodes > std::numeric_limits<uint32_t>::max()) {
+        throw std::runtime_error("EdgeSwitching supports at most 2^32 nodes");
+    }
+
+    edges.reserve(G.numberOfEdges());
+    G.forEdges([&](node u, node v) {
+        edges.emplace_back(std::min(u, v), std::max(u, v));
+    });
+
+    for (node u = 0; u < numNodes; ++u) {
+        if (!G.hasNode(u))
+            deletedNodes.push_back(u);
+    }
+}
+
+void EdgeSwitching::run() {
+    const count m = edges.size();
+    const count neededSwitches = static_cast<count>(numberOfSwitchesPerEdge * m);
+    const count maxAttempts = 2 * neededSwitches;
+
+    if (m < 2) {
+        hasRun = true;
+        return;
+    }
+
+    const count batch = batchSize ? batchSize : std::max<count>(1, m / 32);
+    auto edgeKey = [&](const NodePair &e) -> uint64_t {
+        return static_cast<uint64_t>(e.first) * numNodes + e.second;
+    };
+
+    ConcurrentEdgeSet edgeSet(m);
+    auto insertAllEdges = [&]() {
+        #pragma omp parallel for if(m >= minParallelSize)
+        for (omp_index e = 0; e < static_cast<omp_index>(m); ++e)
+            edgeSet.insert(edgeKey(edges[e]));
+    };
+    insertAllEdges();
+
+    ConcurrentClaimMap claims(2 * batch);
+    std::vector<std::atomic<index> > owner(m);
+    #pragma omp parallel for if(m >= minParallelSize)
+    for (omp_index e = 0; e < static_cast<omp_index>(m); ++e)
+        owner[e].store(none, std::memory_order_relaxed);
+
+    std::vector<SwitchRecord> records(batch);
+    const uint64_t runSeed = hasSeed ? seed : Aux::Random::integer();
+    Aux::SignalHandler handler;
+
+    count attempts = 0, performed = 0;
+    while (performed < neededSwitches && attempts < maxAttempts) {
+        handler.assureRunning();
+
+        // the last batch is shortened so that no more than the needed switches are performed
+        const count size = std::min(batch, std::min(maxAttempts - attempts, neededSwitches - performed));
+
+        // check each switch against the edges before the batch and claim its old and new edges
+        #pragma omp parallel for if(size >= minParallelSize)
+        for (omp_index i = 0; i < static_cast<omp_index>(size); ++i) {
+            SwitchRecord &r = records[i];
+            r.candidate = false;
+
+            // the streams are numbered across all calls of run(), so that a fixed seed continues the chain
+            const uint64_t bits1 = Aux::Random::streamSeed(runSeed, 2 * (attemptedSwitches + i));
+            const uint64_t bits2 = Aux::Random::streamSeed(runSeed, 2 * (attemptedSwitches + i) + 1);
+            r.e1 = bits1 % m;
+            r.e2 = bits2 % m;
+            if (r.e1 == r.e2) continue;
+
+            const node s1 = edges[r.e1].first, t1 = edges[r.e1].second;
+            node s2 = edges[r.e2].first, t2 = edges[r.e2].second;
+            if (bits1 >> 63)
+                std::swap(s2, t2);
+
+            if (s1 == t2 || s2 == t1) continue;
+
+            r.new1 = std::minmax(s1, t2);
+            r.new2 = std::minmax(s2, t1);
+            if (edgeSet.contains(edgeKey(r.new1)) || edgeSet.contains(edgeKey(r.new2))) continue;
+
+            r.candidate = true;
+            Aux::Parallel::atomic_min(owner[r.e1], static_cast<index>(i));
+            Aux::Parallel::atomic_min(owner[r.e2], static_cast<index>(i));
+            claims.claim(edgeKey(r.new1), i);
+            claims.claim(edgeKey(r.new2), i);
+        }
+
+        // execute the switches that won all their claims
+        count performedInBatch = 0;
+        #pragma omp parallel for reduction(+:performedInBatch) if(size >= minParallelSize)
+        for (omp_index i = 0; i < static_cast<omp_index>(size); ++i) {
+            const SwitchRecord &r = records[i];
+            if (!r.candidate) continue;
+
+            if (owner[r.e1].load(std::memory_order_relaxed) != static_cast<index>(i)
+                || owner[r.e2].load(std::memory_order_relaxed) != static_cast<index>(i)
+                || claims.ownerOf(edgeKey(r.new1)) != static_cast<index>(i)
+                || claims.ownerOf(edgeKey(r.new2)) != static_cast<index>(i))
+                continue;
+
+            edgeSet.erase(edgeKey(edges[r.e1]));
+            edgeSet.erase(edgeKey(edges[r.e2]));
+            edgeSet.insert(edgeKey(r.new1));
+            edgeSet.insert(edgeKey(r.new2));
+            edges[r.e1] = r.new1;
+            edges[r.e2] = r.new2;
+            ++performedInBatch;
+        }
+
+        #pragma omp parallel for if(size >= minParallelSize)
+        for (omp_index i = 0; i < static_cast<omp_index>(size); ++i) {
+            const SwitchRecord &r = records[i];
+            if (!r.candidate) continue;
+            owner[r.e1].store(none, std::memory_order_relaxed);
+            owner[r.e2].store(none, std::memory_order_relaxed);
+        }
+        claims.clear();
+
+        if (edgeSet.needsRebuild()) {
+            edgeSet.clear();
+            insertAllEdges();
+        }
+
+        attempts += size;
+        performed += performedInBatch;
+        attemptedSwitches += size;
+        performedSwitches += performedInBatch;
+
+        if (progressCallback)
+            progressCallback(attemptedSwitches, performedSwitches);
+    }
+
+    if (performed < neededSwitches) {
+        INFO("Did only perform ", performed, " instead of ", neededSwitches, " edge switches but made ", attempts, " attempts to switch an edge");
+    }
+
+    hasRun = true;
+}
+
+Graph EdgeSwitching::getGraph() const {
+    std::vector<NodePair> sortedEdges(edges);
+    Aux::Parallel::sort(sortedEdges.begin(), sortedEdges.end());
+
+    // chunks that start at row boundaries can be inserted in parallel
+    GraphBuilder builder(numNodes);
+    const count numChunks = 4 * omp_get_max_threads();
+    #pragma omp parallel for schedule(dynamic, 1)
+    for (omp_index chunk = 0; chunk < static_cast<omp_index>(numChunks); ++chunk) {
+        auto rowStart = [&](index i) {
+            while (i > 0 && i < sortedEdges.size() && sortedEdges[i].first == sortedEdges[i - 1].first) ++i;
+            return i;
+        };
+        const index end = rowStart(sortedEdges.size() * (chunk + 1) / numChunks);
+        for (index i = rowStart(sortedEdges.size() * chunk / numChunks); i < end; ++i)
+            builder.addHalfOutEdge(sortedEdges[i].first, sortedEdges[i].second);
+    }
+
+    Graph result = builder.toGraph(true, true);
+
+    for (node u : deletedNodes)
+        result.removeNode(u);
+
+    return result;
+}
+
+void EdgeSwitching::setBatchSize(count batchSize) {
+    this->batchSize = batchSize;
+}
+
+void EdgeSwitching::setProgressCallback(ProgressCallback callback) {
+    progressCallback = std::move(callback);
+}
+
+void EdgeSwitching::setSeed(uint64_t seed) {
+    this->seed = seed;
+    hasSeed = true;
+}
+
+count EdgeSwitching::getNumberOfAttemptedSwitches() const {
+    return attemptedSwitches;
+}
+
+count EdgeSwitching::getNumberOfPerformedSwitches() const {
+    return performedSwitches;
+}
+
+std::string EdgeSwitching::toString() const {
+    std::stringstream stream;
+    stream << "EdgeSwitching(" << numberOfSwitchesPerEdge << ")";
+    return stream.str();
+}
+
+} // namespace NetworKit
@@ -0,0 +1,112 @@
+/*
+ * EdgeSwitching.h
+ *
+ *  Created on: 17.10.2026
+ */
+
+#ifndef RANDOMIZATION_EDGE_SWITCHING_H_
+#define RANDOMIZATION_EDGE_SWITCHING_H_
+
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "../base/Algorithm.h"
+#include "../graph/Graph.h"
+
+namespace NetworKit {
+
+/**
+ * Randomizes a simple undirected graph with the edge switching Markov chain, which
+ * preserves the degree sequence. A switch selects two edges {s1, t1} and {s2, t2}
+ * uniformly at random and replaces them by {s1, t2} and {s2, t1}; it is rejected if
+ * this would create a self-loop or a multi-edge.
+ *
+ * The switches are executed in parallel batches. All switches of a batch are checked
+ * against a concurrent hash set of the edges present before the batch. A valid switch
+ * that shares an edge, or one of the created edges, with a valid switch of smaller
+ * index in the same batch is rejected. Hence for a fixed seed the result does not depend on the
+ * number of threads.
+ *
+ * The chain stops after numberOfSwitchesPerEdge * m successful switches or after
+ * twice as many attempts, as certain degree sequences admit only few switches.
+ */
+class EdgeSwitching : public Algorithm {
+public:
+    /**
+     * Called after each batch with the number of attempted and performed switches so far.
+     */
+    using ProgressCallback = std::function<void(count attempted, count performed)>;
+
+    /**
+     * @param G                        Undirected graph without self-loops and multi-edges;
+     *                                 edge weights are ignored
+     * @param numberOfSwitchesPerEdge  Number of successful switches per edge (10 is a
+     *                                 common choice to obtain a well mixed sample)
+     */
+    explicit EdgeSwitching(const Graph &G, double numberOfSwitchesPerEdge = 10.0);
+
+    /**
+     * Executes the switches. May be called again to continue the chain.
+     */
+    virtual void run() override;
+
+    /**
+     * Returns a new graph instance with the same degree sequence as the input
+     * graph, but with randomized neighbourhoods.
+     */
+    Graph getGraph() const;
+
+    /**
+     * Sets the number of switches per batch; 0 (the default) chooses m / 32.
+     * Larger batches expose more parallelism but reject more switches due to conflicts.
+     */
+    void setBatchSize(count batchSize);
+
+    /**
+     * Sets a callback that is invoked after each batch to report the mixing progress.
+     */
+    void setProgressCallback(ProgressCallback callback);
+
+    /**
+     * Sets the seed of the random streams of the switches. By default, run() draws the
+     * seed from Aux::Random. Algorithms that run several chains in parallel set the seed
+     * explicitly, as the generator of Aux::Random belongs to the calling thread.
+     */
+    void setSeed(uint64_t seed);
+
+    /**
+     * Returns the number of switches attempted by all calls of run().
+     */
+    count getNumberOfAttemptedSwitches() const;
+
+    /**
+     * Returns the number of switches performed by all calls of run().
+     */
+    count getNumberOfPerformedSwitches() const;
+
+    virtual std::string toString() const override;
+
+    virtual bool isParallel() const override {
+        return true;
+    }
+
+private:
+    count numNodes;
+    std::vector<node> deletedNodes;
+    std::vector<std::pair<node, node> > edges;
+
+    double numberOfSwitchesPerEdge;
+    count batchSize;
+    ProgressCallback progressCallback;
+    bool hasSeed;
+    uint64_t seed;
+
+    count attemptedSwitches;
+    count performedSwitches;
+};
+
+} // namespace NetworKit
+
+#endif // RANDOMIZATION_EDGE_SWITCHING_H_
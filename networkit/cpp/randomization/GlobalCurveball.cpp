@@ -9,13 +9,15 @@
 
 #include "GlobalCurveball.h"
 #include "GlobalCurveballImpl.h"
+#include "ParallelGlobalCurveballImpl.h"
 
 namespace NetworKit {
 
 GlobalCurveball::GlobalCurveball(const Graph &G,
-                                 unsigned number_of_global_trades) :
-    impl(new CurveballDetails::GlobalCurveballImpl{G}),
-    numGlobalTrades{number_of_global_trades}
+                                 unsigned number_of_global_trades,
+                                 bool parallel) :
+    numGlobalTrades{number_of_global_trades},
+    parallel{parallel}
 {
     if (G.isDirected()) {
         throw std::runtime_error("GlobalCurveball supports only undirected graphs");
@@ -24,6 +26,11 @@ GlobalCurveball::GlobalCurveball(const Graph &G,
     if (G.isWeighted()) {
         throw std::runtime_error("GlobalCurveball supports only unweighted graphs");
     }
+
+    if (parallel)
+        parallelImpl.reset(new CurveballDetails::ParallelGlobalCurveballImpl{G});
+    else
+        impl.reset(new CurveballDetails::GlobalCurveballImpl{G});
 }
 
 // We have to define a "default" destructor here, since the definition of
@@ -35,20 +42,27 @@ void GlobalCurveball::run() {
 
     auto& prng = Aux::Random::getURNG();
 
-    CurveballDetails::GlobalTradeSequence<CurveballDetails::FixedLinearCongruentialMap<node> > hash{
-        impl->getInputGraph().numberOfNodes(), numGlobalTrades, prng};
-    impl->run(hash);
+    if (parallel) {
+        const uint64_t seed = Aux::Random::integer();
+        CurveballDetails::GlobalTradeSequence<CurveballDetails::FixedLinearCongruentialMap<node> > hash{
+            parallelImpl->getInputGraph().upperNodeIdBound(), numGlobalTrades, prng};
+        parallelImpl->run(hash, seed);
+    } else {
+        CurveballDetails::GlobalTradeSequence<CurveballDetails::FixedLinearCongruentialMap<node> > hash{
+            impl->getInputGraph().numberOfNodes(), numGlobalTrades, prng};
+        impl->run(hash);
+    }
 
     hasRun = true;
 }
 
 Graph GlobalCurveball::getGraph() {
     assureFinished();
-    return impl->getGraph();
+    return parallel ? parallelImpl->getGraph() : impl->getGraph();
 }
 
 std::string GlobalCurveball::toString() const  {
-    return "GlobalCurveball";
+    return parallel ? "GlobalCurveball (parallel)" : "GlobalCurveball";
 }
 
 }
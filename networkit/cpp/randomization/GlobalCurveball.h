@@ -16,7 +16,10 @@
 namespace NetworKit {
 
 // pImpl
-namespace CurveballDetails { struct GlobalCurveballImpl; }
+namespace CurveballDetails {
+    struct GlobalCurveballImpl;
+    class ParallelGlobalCurveballImpl;
+}
 
 
 class GlobalCurveball : public Algorithm {
@@ -27,9 +30,14 @@ public:
      * @param G                        Undirected and unweighted graph to be randomized
      * @param number_of_global_trades  Number of global trades to be executed (each edge
      *                                 is considered exactly twice per global traded)
+     * @param parallel                 If true, the independent trades of each global trade
+     *                                 are executed concurrently. The result is a sample
+     *                                 of the same distribution and does not depend on the
+     *                                 number of threads, but differs from the sequential one.
      */
     explicit GlobalCurveball(const Graph &G,
-                             unsigned number_of_global_trades = 20);
+                             unsigned number_of_global_trades = 20,
+                             bool parallel = false);
 
 
     virtual ~GlobalCurveball();
@@ -49,12 +57,14 @@ public:
     virtual std::string toString() const override final;
 
     virtual bool isParallel() const override final {
-        return false;
+        return parallel;
     }
 
 private:
     std::unique_ptr<CurveballDetails::GlobalCurveballImpl> impl;
+    std::unique_ptr<CurveballDetails::ParallelGlobalCurveballImpl> parallelImpl;
     unsigned numGlobalTrades;
+    bool parallel;
 
 };
 
@@ -0,0 +1,366 @@
+/*
+ * ParallelGlobalCurveballImpl.h
+ *
+ *  Created on: 17.10.2026
+ */
+#ifndef RANDOMIZATION_PARALLEL_GLOBAL_CURVEBALL_IMPL_H_
+#define RANDOMIZATION_PARALLEL_GLOBAL_CURVEBALL_IMPL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <iterator>
+#include <limits>
+#include <omp.h>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "../auxiliary/Log.h"
+#include "../auxiliary/Parallel.h"
+#include "../auxiliary/Random.h"
+#include "../auxiliary/SignalHandling.h"
+#include "../auxiliary/Timer.h"
+#include "../graph/Graph.h"
+#include "../graph/GraphBuilder.h"
+
+namespace NetworKit {
+namespace CurveballDetails {
+
+/**
+ * Small counter based random bit generator (splitmix64); every trade seeds
+ * its own instance, so the outcome of a trade does not depend on the thread
+ * executing it.
+ */
+class SplitMixURNG {
+public:
+    using result_type = uint64_t;
+
+    explicit SplitMixURNG(uint64_t seed) : state(seed) {}
+
+    static constexpr result_type min() {return 0;}
+    static constexpr result_type max() {return std::numeric_limits<result_type>::max();}
+
+    result_type operator()() {
+        uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+private:
+    uint64_t state;
+};
+
+/**
+ * Parallel variant of GlobalCurveballImpl. Within a global trade, the nodes
+ * with at least one neighbour are paired in the order given by the hash
+ * function of the round, exactly as in the sequential implementation.
+ *
+ * Trades are node-disjoint, but they interact through edges: a trade may
+ * move an edge {u, w} to the trade partner of u and thereby changes the
+ * neighbourhood of w. Since a trade only redistributes the neighbours of
+ * its two nodes among them, the set of trades adjacent to a given trade
+ * does not change during a global trade. Hence trade i is executed as soon
+ * as all adjacent trades j < i have been executed; the trades become ready
+ * in waves of independent, node-disjoint sets which are processed
+ * concurrently. The resulting graph equals the one obtained by executing the
+ * trades one after another, so each global trade remains a sequence of
+ * uniform Curveball trades and the output is a uniform sample in the limit.
+ *
+ * Changes to the neighbourhoods of third nodes are collected in per-thread
+ * buffers and applied between the waves. Every trade draws its random bits
+ * from a stream derived from (seed, round, trade index), hence the result
+ * does not depend on the number of threads.
+ */
+class ParallelGlobalCurveballImpl {
+    struct Rename {
+        node target;   //< node whose neighbourhood changes
+        node from;     //< neighbour that is replaced ...
+        node to;       //< ... by this one
+
+        bool operator<(const Rename& o) const {
+            return target < o.target;
+        }
+    };
+
+public:
+    ParallelGlobalCurveballImpl(const Graph &G) :
+        inputGraph(G)
+    {}
+
+    template <typename TradeSequence>
+    void run(TradeSequence& trade_sequence, uint64_t seed) {
+        Aux::SignalHandler handler;
+
+        if (hasRun) {
+            throw std::runtime_error {"Cannot invoke run several times"};
+        }
+
+        Aux::Timer timer;
+        timer.start();
+
+        const node n = inputGraph.upperNodeIdBound();
+        const int num_threads = omp_get_max_threads();
+
+        // each thread allocates the neighbourhoods of the nodes it later
+        // traverses first, which keeps them local on NUMA systems
+        neighbours.resize(n);
+        #pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+            if (!inputGraph.hasNode(u)) continue;
+            neighbours[u].reserve(inputGraph.degree(u));
+            inputGraph.forNeighborsOf(u, [&](node v) {
+                neighbours[u].push_back(v);
+            });
+        }
+
+        std::vector<std::pair<uint64_t, node> > order(n);
+        std::vector<index> trade_of(n);
+        std::vector<std::atomic<count> > pending;
+        std::vector<index> wave;
+        std::vector<std::vector<index> > next_wave(num_threads);
+        std::vector<std::vector<Rename> > renames(num_threads);
+        std::vector<Rename> all_renames;
+
+        for(size_t round = 0; round < trade_sequence.numberOfRounds(); round++) {
+            handler.assureRunning();
+            trade_sequence.switchToRound(round);
+            const uint64_t round_seed = Aux::Random::streamSeed(seed, round);
+
+            // pair the nodes with neighbours by increasing hash values
+            #pragma omp parallel for
+            for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+                const bool has_neighbours = !neighbours[u].empty();
+                order[u] = {has_neighbours ? static_cast<uint64_t>(trade_sequence.hash(u)) : std::numeric_limits<uint64_t>::max(), u};
+                trade_of[u] = none;
+            }
+
+            Aux::Parallel::sort(order.begin(), order.end());
+
+            const count num_active = static_cast<count>(std::lower_bound(order.begin(), order.end(),
+                std::make_pair(std::numeric_limits<uint64_t>::max(), node{0})) - order.begin());
+            const count num_trades = num_active / 2;
+
+            #pragma omp parallel for
+            for (omp_index i = 0; i < static_cast<omp_index>(2 * num_trades); ++i) {
+                trade_of[order[i].second] = i / 2;
+            }
+
+            // count the earlier adjacent trades of each trade
+            pending = std::vector<std::atomic<count> >(num_trades);
+
+            #pragma omp parallel
+            {
+                std::vector<index> adjacent;
+                const int tid = omp_get_thread_num();
+                next_wave[tid].clear();
+
+                #pragma omp for schedule(dynamic, 64)
+                for (omp_index t = 0; t < static_cast<omp_index>(num_trades); ++t) {
+                    collectAdjacentTrades(t, order, trade_of, adjacent, false);
+                    pending[t].store(adjacent.size(), std::memory_order_relaxed);
+                    if (adjacent.empty())
+                        next_wave[tid].push_back(t);
+                }
+            }
+
+            count executed = 0;
+            while (true) {
+                gatherBuffers(next_wave, wave);
+                if (wave.empty()) break;
+                executed += wave.size();
+
+                #pragma omp parallel
+                {
+                    std::vector<node> common, only_u, only_v, adjacent;
+                    std::vector<std::pair<node, bool> > disjoint;
+                    const int tid = omp_get_thread_num();
+                    next_wave[tid].clear();
+                    renames[tid].clear();
+
+                    #pragma omp for schedule(dynamic, 16)
+                    for (omp_index w = 0; w < static_cast<omp_index>(wave.size()); ++w) {
+                        const index t = wave[w];
+                        executeTrade(order[2 * t].second, order[2 * t + 1].second,
+                                     SplitMixURNG(Aux::Random::streamSeed(round_seed, t)),
+                                     common, only_u, only_v, disjoint, renames[tid]);
+
+                        // notify the later adjacent trades
+                        collectAdjacentTrades(t, order, trade_of, adjacent, true);
+                        for (index s : adjacent) {
+                            if (pending[s].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                                next_wave[tid].push_back(s);
+                        }
+                    }
+                }
+
+                applyRenames(renames, all_renames);
+            }
+
+            assert(executed == num_trades);
+            DEBUG("Global trade ", round, " executed ", executed, " trades");
+        }
+
+        hasRun = true;
+
+        timer.stop();
+        DEBUG("Trading took ", timer.elapsedMilliseconds(), " milliseconds.");
+    }
+
+    Graph getGraph() {
+        const node n = inputGraph.upperNodeIdBound();
+        GraphBuilder builder(n, false, false);
+
+        #pragma omp parallel for schedule(guided)
+        for (omp_index u = 0; u < static_cast<omp_index>(n); ++u) {
+            for (node v : neighbours[u])
+                builder.addHalfOutEdge(u, v);
+        }
+
+        Graph result = builder.toGraph(false, true);
+        for (node u = 0; u < n; ++u) {
+            if (!inputGraph.hasNode(u))
+                result.removeNode(u);
+        }
+
+        return result;
+    }
+
+    const Graph& getInputGraph() const {
+        return inputGraph;
+    }
+
+protected:
+    bool hasRun {false};
+    std::vector<std::vector<node> > neighbours;
+
+    const Graph& inputGraph;
+
+    // collects the distinct trades adjacent to trade t that come before
+    // (later == false) or after (later == true) it
+    void collectAdjacentTrades(index t,
+                               const std::vector<std::pair<uint64_t, node> >& order,
+                               const std::vector<index>& trade_of,
+                               std::vector<index>& adjacent, bool later) const {
+        adjacent.clear();
+        for (index k = 2 * t; k < 2 * t + 2; ++k) {
+            for (node x : neighbours[order[k].second]) {
+                const index s = trade_of[x];
+                if (s == none || s == t || (s > t) != later) continue;
+                adjacent.push_back(s);
+            }
+        }
+        std::sort(adjacent.begin(), adjacent.end());
+        adjacent.erase(std::unique(adjacent.begin(), adjacent.end()), adjacent.end());
+    }
+
+    // a Curveball trade between u and v; the neighbours that change sides
+    // are recorded as renames for their own neighbourhoods
+    void executeTrade(node u, node v, SplitMixURNG urng,
+                      std::vector<node>& common, std::vector<node>& only_u,
+                      std::vector<node>& only_v,
+                      std::vector<std::pair<node, bool> >& disjoint,
+                      std::vector<Rename>& rename_buffer) {
+        std::vector<node>& nu = neighbours[u];
+        std::vector<node>& nv = neighbours[v];
+
+        // filter out the edge between the trade partners
+        bool edge_between_uv = false;
+        {
+            auto it = std::find(nu.begin(), nu.end(), v);
+            if (it != nu.end()) {
+                *it = nu.back();
+                nu.pop_back();
+                nv.erase(std::find(nv.begin(), nv.end(), u));
+                edge_between_uv = true;
+            }
+        }
+
+        std::sort(nu.begin(), nu.end());
+        std::sort(nv.begin(), nv.end());
+
+        common.clear();
+        only_u.clear();
+        only_v.clear();
+        std::set_intersection(nu.begin(), nu.end(), nv.begin(), nv.end(), std::back_inserter(common));
+        std::set_difference(nu.begin(), nu.end(), nv.begin(), nv.end(), std::back_inserter(only_u));
+        std::set_difference(nv.begin(), nv.end(), nu.begin(), nu.end(), std::back_inserter(only_v));
+
+        disjoint.clear();
+        for (node x : only_u) disjoint.emplace_back(x, true);
+        for (node x : only_v) disjoint.emplace_back(x, false);
+
+        // choose uniformly at random which of the disjoint neighbours end up at u
+        const size_t u_setsize = only_u.size();
+        const size_t setsize = disjoint.size();
+        {
+            const size_t k = std::min(u_setsize, setsize - u_setsize);
+            for (size_t i = 0; i < k; ++i) {
+                std::uniform_int_distribution<size_t> distr(i, setsize - 1);
+                std::swap(disjoint[i], disjoint[distr(urng)]);
+            }
+            // the shuffled prefix belongs to the smaller side
+            if (k != u_setsize)
+                std::rotate(disjoint.begin(), disjoint.begin() + k, disjoint.end());
+        }
+
+        nu.assign(common.begin(), common.end());
+        nv.assign(common.begin(), common.end());
+
+        for (size_t i = 0; i < setsize; ++i) {
+            const node x = disjoint[i].first;
+            const bool was_at_u = disjoint[i].second;
+            const bool now_at_u = (i < u_setsize);
+
+            (now_at_u ? nu : nv).push_back(x);
+            if (was_at_u != now_at_u)
+                rename_buffer.push_back({x, was_at_u ? u : v, now_at_u ? u : v});
+        }
+
+        if (edge_between_uv) {
+            nu.push_back(v);
+            nv.push_back(u);
+        }
+    }
+
+    static void gatherBuffers(std::vector<std::vector<index> >& buffers, std::vector<index>& result) {
+        result.clear();
+        for (auto& buffer : buffers) {
+            result.insert(result.end(), buffer.begin(), buffer.end());
+            buffer.clear();
+        }
+    }
+
+    void applyRenames(std::vector<std::vector<Rename> >& buffers, std::vector<Rename>& all) {
+        all.clear();
+        for (auto& buffer : buffers) {
+            all.insert(all.end(), buffer.begin(), buffer.end());
+            buffer.clear();
+        }
+        if (all.empty()) return;
+
+        Aux::Parallel::sort(all.begin(), all.end());
+
+        // chunks that start at target boundaries can be applied in parallel
+        const count num_chunks = 4 * omp_get_max_threads();
+        #pragma omp parallel for schedule(dynamic, 1)
+        for (omp_index chunk = 0; chunk < static_cast<omp_index>(num_chunks); ++chunk) {
+            auto targetStart = [&](index i) {
+                while (i > 0 && i < all.size() && all[i].target == all[i - 1].target) ++i;
+                return i;
+            };
+            const index end = targetStart(all.size() * (chunk + 1) / num_chunks);
+            for (index i = targetStart(all.size() * chunk / num_chunks); i < end; ++i) {
+                auto& list = neighbours[all[i].target];
+                *std::find(list.begin(), list.end(), all[i].from) = all[i].to;
+            }
+        }
+    }
+};
+
+} // ! namespace CurveballDetails
+} // ! namespace NetworKit
+
+#endif // ! RANDOMIZATION_PARALLEL_GLOBAL_CURVEBALL_IMPL_H_
@@ -0,0 +1,158 @@
+/*
+ * EdgeSwitchingGTest.cpp
+ *
+ *  Created on: 17.10.2026
+ */
+
+#include <gtest/gtest.h>
+#include <omp.h>
+#include <vector>
+
+#include "../EdgeSwitching.h"
+#include "../../auxiliary/Random.h"
+#include "../../graph/Graph.h"
+#include "../../generators/ErdosRenyiGenerator.h"
+#include "../../generators/HyperbolicGenerator.h"
+
+namespace NetworKit {
+
+class EdgeSwitchingGTest : public ::testing::Test {
+protected:
+    void checkWithGraph(const Graph&);
+};
+
+void EdgeSwitchingGTest::checkWithGraph(const Graph& G) {
+    EdgeSwitching algo(G);
+
+    count lastAttempted = 0, lastPerformed = 0, numCallbacks = 0;
+    algo.setProgressCallback([&](count attempted, count performed) {
+        EXPECT_GT(attempted, lastAttempted);
+        EXPECT_GE(performed, lastPerformed);
+        EXPECT_LE(performed, attempted);
+        lastAttempted = attempted;
+        lastPerformed = performed;
+        ++numCallbacks;
+    });
+
+    algo.run();
+
+    EXPECT_GT(numCallbacks, 0u);
+    EXPECT_EQ(lastAttempted, algo.getNumberOfAttemptedSwitches());
+    EXPECT_EQ(lastPerformed, algo.getNumberOfPerformedSwitches());
+    EXPECT_LE(algo.getNumberOfPerformedSwitches(), 10 * G.numberOfEdges());
+    EXPECT_LE(algo.getNumberOfAttemptedSwitches(), 20 * G.numberOfEdges());
+
+    Graph outG = algo.getGraph();
+    EXPECT_TRUE(outG.checkConsistency());
+    EXPECT_EQ(0u, outG.numberOfSelfLoops());
+    EXPECT_EQ(G.numberOfNodes(), outG.numberOfNodes());
+    EXPECT_EQ(G.numberOfEdges(), outG.numberOfEdges());
+    G.forNodes([&](node u) {
+        ASSERT_EQ(G.degree(u), outG.degree(u));
+    });
+
+    // most edges should have been replaced
+    count keptEdges = 0;
+    outG.forEdges([&](node u, node v) {
+        if (G.hasEdge(u, v)) ++keptEdges;
+    });
+    EXPECT_LT(keptEdges, G.numberOfEdges() / 2);
+}
+
+TEST_F(EdgeSwitchingGTest, testEdgeSwitchingErdosRenyi) {
+    Aux::Random::setSeed(1, false);
+
+    ErdosRenyiGenerator generator(1000, 0.01);
+    Graph G = generator.generate();
+
+    this->checkWithGraph(G);
+}
+
+TEST_F(EdgeSwitchingGTest, testEdgeSwitchingHyperbolic) {
+    Aux::Random::setSeed(1, false);
+
+    HyperbolicGenerator generator(1000);
+    Graph G = generator.generate();
+
+    this->checkWithGraph(G);
+}
+
+TEST_F(EdgeSwitchingGTest, testEdgeSwitchingDeletedNodes) {
+    Aux::Random::setSeed(1, false);
+
+    ErdosRenyiGenerator generator(200, 0.1);
+    Graph G = generator.generate();
+    std::vector<node> neighbors;
+    G.forNeighborsOf(17, [&](node v) {
+        neighbors.push_back(v);
+    });
+    for (node v : neighbors)
+        G.removeEdge(17, v);
+    G.removeNode(17);
+
+    EdgeSwitching algo(G);
+    algo.run();
+    Graph outG = algo.getGraph();
+
+    EXPECT_FALSE(outG.hasNode(17));
+    EXPECT_EQ(G.numberOfNodes(), outG.numberOfNodes());
+    G.forNodes([&](node u) {
+        ASSERT_EQ(G.degree(u), outG.degree(u));
+    });
+}
+
+TEST_F(EdgeSwitchingGTest, testEdgeSwitchingReproducibility) {
+    Aux::Random::setSeed(1, false);
+
+    // large enough for batches that are processed in parallel
+    ErdosRenyiGenerator generator(20000, 0.001);
+    const Graph G = generator.generate();
+
+    auto randomizeWithThreads = [&](int threads) {
+        const int oldThreads = omp_get_max_threads();
+        omp_set_num_threads(threads);
+        Aux::Random::setSeed(42, false);
+        EdgeSwitching algo(G, 2.0);
+        algo.run();
+        omp_set_num_threads(oldThreads);
+        return algo.getGraph();
+    };
+
+    Graph G1 = randomizeWithThreads(1);
+    Graph G2 = randomizeWithThreads(4);
+
+    ASSERT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+    G1.forEdges([&](node u, node v) {
+        EXPECT_TRUE(G2.hasEdge(u, v));
+    });
+}
+
+TEST_F(EdgeSwitchingGTest, testEdgeSwitchingSeed) {
+    Aux::Random::setSeed(1, false);
+    ErdosRenyiGenerator generator(1000, 0.01);
+    const Graph G = generator.generate();
+
+    // the result only depends on the given seed, not on Aux::Random
+    auto randomize = [&](uint64_t auxSeed) {
+        Aux::Random::setSeed(auxSeed, false);
+        EdgeSwitching algo(G, 2.0);
+        algo.setSeed(42);
+        algo.run();
+        return algo.getGraph();
+    };
+
+    Graph G1 = randomize(1);
+    Graph G2 = randomize(2);
+
+    ASSERT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+    G1.forEdges([&](node u, node v) {
+        EXPECT_TRUE(G2.hasEdge(u, v));
+    });
+}
+
+TEST_F(EdgeSwitchingGTest, testEdgeSwitchingDirected) {
+    Graph G(10, false, true);
+    EXPECT_THROW(EdgeSwitching algo(G), std::runtime_error);
+}
+
+} // namespace NetworKit
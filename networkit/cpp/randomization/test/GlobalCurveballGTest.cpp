@@ -6,6 +6,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <omp.h>
 
 #include "../GlobalCurveball.h"
 #include "../../graph/Graph.h"
@@ -16,10 +17,10 @@ namespace NetworKit {
 
 class GlobalCurveballGTest : public ::testing::Test  {
 protected:
-    void checkWithGraph(Graph&);
+    void checkWithGraph(Graph&, bool parallel = false);
 };
 
-void GlobalCurveballGTest::checkWithGraph(Graph& G) {
+void GlobalCurveballGTest::checkWithGraph(Graph& G, bool parallel) {
     node numNodes = G.numberOfNodes();
     const count numTrades = 5;
 
@@ -45,7 +46,7 @@ void GlobalCurveballGTest::checkWithGraph(Graph& G) {
     });
 
 
-    GlobalCurveball algo(G, numTrades);
+    GlobalCurveball algo(G, numTrades, parallel);
     algo.run();
 
     // check degrees
@@ -77,4 +78,57 @@ TEST_F(GlobalCurveballGTest, testCurveballHyperbolic) {
     this->checkWithGraph(G);
 }
 
+TEST_F(GlobalCurveballGTest, testParallelCurveballErdosRenyi) {
+    Aux::Random::setSeed(1, false);
+
+    node numNodes = 1000;
+    ErdosRenyiGenerator generator(numNodes, 0.01);
+    Graph G = generator.generate();
+
+    this->checkWithGraph(G, true);
+}
+
+TEST_F(GlobalCurveballGTest, testParallelCurveballHyperbolic) {
+    Aux::Random::setSeed(1, false);
+
+    node numNodes = 1000;
+    HyperbolicGenerator generator(numNodes);
+    Graph G = generator.generate();
+
+    this->checkWithGraph(G, true);
+}
+
+TEST_F(GlobalCurveballGTest, testParallelCurveballReproducibility) {
+    Aux::Random::setSeed(1, false);
+
+    HyperbolicGenerator generator(10000);
+    const Graph G = generator.generate();
+
+    auto randomizeWithThreads = [&](int threads) {
+        const int oldThreads = omp_get_max_threads();
+        omp_set_num_threads(threads);
+        Aux::Random::setSeed(42, false);
+        GlobalCurveball algo(G, 5, true);
+        algo.run();
+        omp_set_num_threads(oldThreads);
+        return algo.getGraph();
+    };
+
+    Graph G1 = randomizeWithThreads(1);
+    Graph G2 = randomizeWithThreads(4);
+
+    ASSERT_EQ(G.numberOfEdges(), G1.numberOfEdges());
+    ASSERT_EQ(G1.numberOfEdges(), G2.numberOfEdges());
+    G1.forEdges([&](node u, node v) {
+        EXPECT_TRUE(G2.hasEdge(u, v));
+    });
+
+    // most edges should have been replaced
+    count keptEdges = 0;
+    G1.forEdges([&](node u, node v) {
+        if (G.hasEdge(u, v)) ++keptEdges;
+    });
+    EXPECT_LT(keptEdges, G.numberOfEdges() / 2);
+}
+
 } // namespace NetworKit